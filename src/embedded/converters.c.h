@@ -1,65 +1,308 @@
 #define RSTR(somestr) mkCharCE(somestr, CE_UTF8)
 
-#define BAT_TO_SXP(bat,tpe,retsxp,newfun,ptrfun,ctype,naval,memcopy)\
-	do {													\
-		tpe v; BUN j, n = BATcount(bat);									\
-		ctype *valptr = NULL;                               \
-		tpe* p = (tpe*) Tloc(bat, 0);                       \
-		retsxp = PROTECT(newfun(n));		    \
-		if (!retsxp) break;                                 \
-		valptr = ptrfun(retsxp);                            \
-		if (bat->tnonil && !bat->tnil) {                    \
-			if (memcopy) {									\
-				memcpy(valptr, p,                           \
-					BATcount(bat) * sizeof(tpe));           \
-			} else {                                        \
-				for (j = 0; j < n; j++) {\
-					valptr[j] = (ctype) p[j];               \
-				}                                           \
-			} 												\
-		} else {                                            \
-		for (j = 0; j < n; j++) {		                    \
-			v = p[j];                                       \
-			if (v == tpe##_nil)							\
-				valptr[j] = naval;	                        \
-			else											\
-				valptr[j] = (ctype) v;	                    \
-		}}													\
+/* conversion statistics: bytes shared between BATs and R vectors without
+ * copying (mmap masquerade, wrapped append vectors), bytes copied or
+ * converted into R vectors, and bytes of result columns stored in memory
+ * mapped files, i.e. the ones the masquerade can share at all */
+static lng monetdb_r_bytes_shared = 0;
+static lng monetdb_r_bytes_copied = 0;
+static lng monetdb_r_bytes_mapped = 0;
+
+/* once the R vector is allocated, converting a fixed-width column only touches
+ * plain memory, so it can be cut into slices that run on GDK threads; the main
+ * thread (the only one allowed to call into R) allocates all vectors and does
+ * the string columns before it starts them */
+typedef struct {
+	BAT *b;
+	int battype;
+	void *dst;
+	BUN lo, hi;
+	timestamp epoch;
+} sexp_fill_task;
+
+typedef struct sexp_fill_worker sexp_fill_worker;
+
+typedef struct {
+	sexp_fill_task *tasks;
+	size_t ntasks, maxtasks;
+	sexp_fill_worker *workers;
+	int nworkers;
+} sexp_fill_queue;
+
+struct sexp_fill_worker {
+	sexp_fill_queue *queue;
+	int id;
+	MT_Id tid;
+};
+
+/* rows per slice handed to a single worker */
+#define SEXP_FILL_CHUNK ((BUN) 1 << 20)
+
+#define SXP_FILL(tpe,ctype,naval)										\
+	do {																\
+		const tpe *p = (const tpe *) Tloc(t->b, 0);						\
+		ctype *valptr = (ctype *) t->dst;								\
+		BUN j;															\
+		if (t->b->tnonil && !t->b->tnil) {								\
+			for (j = t->lo; j < t->hi; j++)								\
+				valptr[j] = (ctype) p[j];								\
+		} else {														\
+			for (j = t->lo; j < t->hi; j++)								\
+				valptr[j] = p[j] == tpe##_nil ? naval : (ctype) p[j];	\
+		}																\
 	} while (0)
 
-#define BAT_TO_INTSXP(bat,tpe,retsxp,memcopy)						\
-	BAT_TO_SXP(bat,tpe,retsxp,NEW_INTEGER,INTEGER_POINTER,int,NA_INTEGER,memcopy)\
+static void sexp_fill(sexp_fill_task *t) {
+	BUN j;
+	switch (t->battype) {
+	case TYPE_bit:
+		SXP_FILL(bte, int, NA_LOGICAL);
+		break;
+	case TYPE_bte:
+		SXP_FILL(bte, int, NA_INTEGER);
+		break;
+	case TYPE_sht:
+		SXP_FILL(sht, int, NA_INTEGER);
+		break;
+	case TYPE_int:
+		// int_nil is NA_INTEGER, no need to look at the values
+		memcpy((int *) t->dst + t->lo, (const int *) Tloc(t->b, 0) + t->lo, (t->hi - t->lo) * sizeof(int));
+		break;
+	case TYPE_lng:
+		SXP_FILL(lng, double, NA_REAL);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge: /* R's integers are stored as int, so we cannot be sure hge will fit */
+		SXP_FILL(hge, double, NA_REAL);
+		break;
+#endif
+	case TYPE_flt:
+		SXP_FILL(flt, double, NA_REAL);
+		break;
+	case TYPE_dbl:
+		if (t->b->tnonil && !t->b->tnil) {
+			memcpy((double *) t->dst + t->lo, (const double *) Tloc(t->b, 0) + t->lo, (t->hi - t->lo) * sizeof(double));
+		} else {
+			SXP_FILL(dbl, double, NA_REAL);
+		}
+		break;
+	default:
+		if (t->battype == TYPE_date) {
+			const date *d = (const date *) Tloc(t->b, 0);
+			double *valptr = (double *) t->dst;
+			for (j = t->lo; j < t->hi; j++) {
+				valptr[j] = d[j] == date_nil ? NA_REAL : (double) (d[j] - 719528);
+			}
+		} else if (t->battype == TYPE_timestamp) {
+			const timestamp *ts = (const timestamp *) Tloc(t->b, 0);
+			double *valptr = (double *) t->dst;
+			for (j = t->lo; j < t->hi; j++) {
+				if (ts_isnil(ts[j])) {
+					valptr[j] = NA_REAL;
+				} else {
+					valptr[j] = ((double) (ts[j].days - t->epoch.days)) * ((lng) 24 * 60 * 60) + ((double) (ts[j].msecs - t->epoch.msecs)/1000);
+				}
+			}
+		} else if (t->battype == TYPE_daytime) {
+			const daytime *dt = (const daytime *) Tloc(t->b, 0);
+			double *valptr = (double *) t->dst;
+			for (j = t->lo; j < t->hi; j++) {
+				if (dt[j] == daytime_nil) {
+					valptr[j] = NA_REAL;
+				} else {
+					daytime n = dt[j];
+					int h;
+					double frac;
+					h = n / 3600000;
+					n -= h * 3600000;
+					frac = (n / 60000.0)/60.0;
+					valptr[j]  = h + frac;
+				}
+			}
+		}
+		break;
+	}
+}
 
-#define BAT_TO_REALSXP(bat,tpe,retsxp,memcopy)						\
-	BAT_TO_SXP(bat,tpe,retsxp,NEW_NUMERIC,NUMERIC_POINTER,double,NA_REAL,memcopy)\
+static void sexp_fill_enqueue(sexp_fill_queue *queue, sexp_fill_task *t) {
+	BUN lo;
+	for (lo = t->lo; lo < t->hi; lo += SEXP_FILL_CHUNK) {
+		sexp_fill_task *slice;
+		if (queue->ntasks == queue->maxtasks) {
+			size_t maxtasks = queue->maxtasks ? queue->maxtasks * 2 : 64;
+			sexp_fill_task *tasks = GDKrealloc(queue->tasks, maxtasks * sizeof(sexp_fill_task));
+			if (!tasks) {
+				// whatever did not make it into the queue is converted right here
+				t->lo = lo;
+				sexp_fill(t);
+				return;
+			}
+			queue->tasks = tasks;
+			queue->maxtasks = maxtasks;
+		}
+		slice = &queue->tasks[queue->ntasks++];
+		*slice = *t;
+		slice->lo = lo;
+		slice->hi = t->hi - lo > SEXP_FILL_CHUNK ? lo + SEXP_FILL_CHUNK : t->hi;
+	}
+}
 
-#define SXP_TO_BAT(tpe,access_fun,na_check)								\
+static void sexp_fill_worker_run(void *arg) {
+	sexp_fill_worker *w = (sexp_fill_worker *) arg;
+	size_t i;
+	for (i = w->id; i < w->queue->ntasks; i += w->queue->nworkers) {
+		sexp_fill(&w->queue->tasks[i]);
+	}
+}
+
+/* start converting the queued slices in the background */
+static void sexp_fill_start(sexp_fill_queue *queue) {
+	int i, nworkers = GDKnr_threads;
+	queue->nworkers = 0;
+	if (nworkers > (int) queue->ntasks) {
+		nworkers = (int) queue->ntasks;
+	}
+	if (nworkers <= 1 ||
+			!(queue->workers = GDKzalloc(nworkers * sizeof(sexp_fill_worker)))) {
+		return;
+	}
+	queue->nworkers = nworkers;
+	for (i = 0; i < nworkers; i++) {
+		queue->workers[i].queue = queue;
+		queue->workers[i].id = i;
+		if (MT_create_thread(&queue->workers[i].tid, sexp_fill_worker_run, &queue->workers[i], MT_THR_JOINABLE) < 0) {
+			// could not start this one, let the ones already running finish and do the rest here
+			int j;
+			for (j = 0; j < i; j++) {
+				MT_join_thread(queue->workers[j].tid);
+			}
+			GDKfree(queue->workers);
+			queue->workers = NULL;
+			queue->nworkers = 0;
+			return;
+		}
+	}
+}
+
+/* wait for all queued slices to be converted and reset the queue */
+static void sexp_fill_wait(sexp_fill_queue *queue) {
+	size_t i;
+	if (queue->nworkers > 0) {
+		int w;
+		for (w = 0; w < queue->nworkers; w++) {
+			MT_join_thread(queue->workers[w].tid);
+		}
+		GDKfree(queue->workers);
+	} else {
+		for (i = 0; i < queue->ntasks; i++) {
+			sexp_fill(&queue->tasks[i]);
+		}
+	}
+	GDKfree(queue->tasks);
+	memset(queue, 0, sizeof(sexp_fill_queue));
+}
+
+/* allocate the R vector for a fixed-width column and convert it, either right
+ * away or, given a queue, later on through sexp_fill_start/sexp_fill_wait */
+static SEXP sexp_alloc_fill(BAT *b, int battype, SEXPTYPE rtype, sexp_fill_queue *queue) {
+	BUN n = BATcount(b);
+	sexp_fill_task t;
+	SEXP varvalue;
+	if (battype == TYPE_timestamp && MTIMEunix_epoch(&t.epoch) != MAL_SUCCEED) {
+		return NULL;
+	}
+	varvalue = PROTECT(allocVector(rtype, n));
+	if (!varvalue) {
+		return NULL;
+	}
+	t.b = b;
+	t.battype = battype;
+	t.lo = 0;
+	t.hi = n;
+	if (rtype == REALSXP) {
+		t.dst = NUMERIC_POINTER(varvalue);
+		monetdb_r_bytes_copied += (lng) (n * sizeof(double));
+	} else {
+		t.dst = rtype == LGLSXP ? LOGICAL_POINTER(varvalue) : INTEGER_POINTER(varvalue);
+		monetdb_r_bytes_copied += (lng) (n * sizeof(int));
+	}
+	if (queue) {
+		sexp_fill_enqueue(queue, &t);
+	} else {
+		sexp_fill(&t);
+	}
+	return varvalue;
+}
+
+/* nil and sortedness properties of a freshly filled BAT, in blocks of
+ * branch-free passes the compiler can vectorise; stops early once nothing
+ * is left to find out */
+#define SXP_PROPS_BLOCK ((BUN) 4096)
+#define SXP_BAT_PROPS(tpe)												\
 	do {																\
-		tpe *p, prev = tpe##_nil; BUN j;								\
+		const tpe *v = (const tpe *) Tloc(b, 0);						\
+		BUN lo, hi, j;													\
+		int nonil = 1, sorted = 1, revsorted = 1;						\
+		for (lo = 0; lo < cnt && (nonil | sorted | revsorted); lo = hi) { \
+			hi = cnt - lo > SXP_PROPS_BLOCK ? lo + SXP_PROPS_BLOCK : cnt; \
+			for (j = lo; j < hi; j++)									\
+				nonil &= v[j] != tpe##_nil;								\
+			for (j = lo > 0 ? lo : 1; j < hi; j++) {					\
+				sorted &= v[j - 1] <= v[j];								\
+				revsorted &= v[j - 1] >= v[j];							\
+			}															\
+		}																\
+		b->tnonil = nonil; b->tnil = !nonil;							\
+		b->tsorted = sorted; b->trevsorted = revsorted;					\
+		b->tkey = 0; b->tdense = 0;										\
+	} while (0)
+
+/* na_check is evaluated on the R value v */
+#define SXP_TO_BAT(tpe,ctype,access_fun,na_check)						\
+	do {																\
+		const ctype *src = (const ctype *) access_fun(s);				\
+		tpe *p; BUN j;													\
 		b = COLnew(0, TYPE_##tpe, cnt, TRANSIENT);						\
 		if (!b) break;                                                  \
-		b->tnil = 0; b->tnonil = 1; b->tkey = 0;						\
-		b->tsorted = 1; b->trevsorted = 1;b->tdense = 0;				\
-		p = (tpe*) Tloc(b, 0);								\
-		for(j = 0; j < cnt; j++, p++){								    \
-			*p = (tpe) access_fun(s)[j];							    \
-			if (na_check){ b->tnil = 1; 	b->tnonil = 0; 	*p= tpe##_nil;} \
-			if (j > 0){													\
-				if (*p > prev && b->trevsorted){						\
-					b->trevsorted = 0;									\
-				} else													\
-					if (*p < prev && b->tsorted){						\
-						b->tsorted = 0;									\
-					}													\
-			}															\
-			prev = *p;													\
+		p = (tpe*) Tloc(b, 0);											\
+		for (j = 0; j < cnt; j++) {										\
+			ctype v = src[j];											\
+			p[j] = (na_check) ? tpe##_nil : (tpe) v;					\
 		}																\
 		BATsetcount(b, cnt);											\
+		SXP_BAT_PROPS(tpe);												\
 		BATsettrivprop(b);												\
 	} while (0)
 
+/* borrow the memory of the R vector instead of copying it; the BAT is
+ * read-only and has to be gone before the vector can be collected, which
+ * holds for the append BATs that only live during monetdb_append_R */
+#define SXP_WRAP_BAT(tpe,access_fun)									\
+	do {																\
+		b = BATwrap(0, TYPE_##tpe, access_fun(s), cnt);					\
+		if (!b) break;                                                  \
+		SXP_BAT_PROPS(tpe);												\
+		BATsettrivprop(b);												\
+		monetdb_r_bytes_shared += cnt * sizeof(tpe);					\
+	} while (0)
+
+/* NA, NaN and the infinities all have to become dbl_nil */
+static int sexp_all_finite(const double *v, BUN cnt) {
+	BUN lo, hi, j;
+	int finite = 1;
+	for (lo = 0; lo < cnt && finite; lo = hi) {
+		hi = cnt - lo > SXP_PROPS_BLOCK ? lo + SXP_PROPS_BLOCK : cnt;
+		for (j = lo; j < hi; j++)
+			finite &= v[j] - v[j] == 0;
+	}
+	return finite;
+}
+
 #ifndef NATIVE_WIN32
 
+/* below this size setting up the mappings costs more than a memcpy */
+#define MONETDB_R_DRESSUP_MINSIZE ((size_t) 1 << 20)
+
 typedef struct R_MASQ_BAT {
 	char* base_map;
 	char* data_map;
@@ -122,33 +365,100 @@ static int monetdb_r_hdrsize() {
     return siz;
 }
 
+/* can the tail heap of b be handed to R through monetdb_r_dressup?  we need a
+ * file-backed shared mapping (the file contents are then identical to what
+ * GDK sees) and the data has to start on a page boundary in that file so we
+ * can map it right behind the R vector header */
+static int monetdb_r_dressup_ok(BAT *b) {
+	Heap *h = &b->T.heap;
+	size_t offset = 0;
+	if (BATcount(b) == 0 || BATcount(b) > R_SHORT_LEN_MAX) {
+		return 0;
+	}
+	if (VIEWtparent(b)) {
+		BAT *pb = BBPquickdesc(abs(VIEWtparent(b)), 0);
+		if (pb == NULL) {
+			return 0;
+		}
+		h = &pb->T.heap;
+		offset = (size_t) (Tloc(b, 0) - h->base);
+	}
+	if (h->storage != STORE_MMAP || h->filename == NULL ||
+		offset % MT_pagesize() != 0 ||
+		BATcount(b) * Tsize(b) < MONETDB_R_DRESSUP_MINSIZE) {
+		return 0;
+	}
+	monetdb_r_bytes_mapped += (lng) (BATcount(b) * Tsize(b));
+	return 1;
+}
+
 static SEXP monetdb_r_dressup(BAT *b, SEXPTYPE target_type) {
 	R_MASQ_BAT* masq = malloc(sizeof(R_MASQ_BAT));
 	SEXP varvalue;
 	size_t hdr_len = monetdb_r_hdrsize() + sizeof(R_allocator_t);//40 +  // sizeof(SEXPREC_ALIGNED) is 40 but not exported
 	R_allocator_t allocator;
-
-	char* filename = GDKfilepath(b->T.heap.farmid, BATDIR, b->T.heap.filename, NULL);
+	Heap *h = &b->T.heap;
+	size_t offset = 0, pagesize = MT_pagesize();
+	/* doubles with NULLs need to be rewritten from dbl_nil to NA_REAL, so
+	 * map writable: the mapping is private, so only the pages that actually
+	 * contain a NULL are copied */
+	int rewrite_nils = target_type == REALSXP && !b->tnonil;
+	char* filename;
 	int fd = -1;
+
+	if (VIEWtparent(b)) {
+		BAT *pb = BBPquickdesc(abs(VIEWtparent(b)), 0);
+		h = &pb->T.heap;
+		offset = (size_t) (Tloc(b, 0) - h->base);
+	}
+	filename = GDKfilepath(h->farmid, BATDIR, h->filename, NULL);
 	if (!masq || !filename) {
+		free(masq);
+		GDKfree(filename);
 		return NULL;
 	}
 
 	// secret mmap sauce follows
-	masq->data_map_len = b->T.heap.size;
+	masq->data_map_len = (BATcount(b) * Tsize(b) + pagesize - 1) & ~(pagesize - 1);
 	fd = open(filename, O_RDONLY, NULL);
 	GDKfree(filename);
-	masq->base_map = mmap(NULL,                           masq->data_map_len + MT_pagesize(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-	masq->data_map = mmap(masq->base_map + MT_pagesize(), masq->data_map_len,                 PROT_READ,              MAP_PRIVATE | MAP_FIXED,     fd, 0);
+	masq->base_map = mmap(NULL,                           masq->data_map_len + pagesize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	masq->data_map = mmap(masq->base_map + pagesize, masq->data_map_len,                 PROT_READ | (rewrite_nils ? PROT_WRITE : 0), MAP_PRIVATE | MAP_FIXED, fd, (off_t) offset);
 	masq->bat_cache_id = b->batCacheid;
 	close(fd);
 
 	// check if the MAP_FIXED worked as expected
-	if (masq->base_map == NULL ||  masq->data_map == NULL || masq->base_map + MT_pagesize() != masq->data_map) {
+	if (masq->base_map == MAP_FAILED) {
+		masq->base_map = NULL;
+	}
+	if (masq->data_map == MAP_FAILED) {
+		masq->data_map = NULL;
+	}
+	if (masq->base_map == NULL ||  masq->data_map == NULL || masq->base_map + pagesize != masq->data_map) {
 		monetdb_r_masq_free(masq);
 		return NULL;
 	}
 
+	if (rewrite_nils) {
+		double *d = (double *) masq->data_map;
+		BUN j, n = BATcount(b);
+		size_t dirty_pages = 0, last_page = BUN_NONE;
+		for (j = 0; j < n; j++) {
+			if (d[j] == dbl_nil) {
+				size_t page = (j * sizeof(double)) / pagesize;
+				d[j] = NA_REAL;
+				if (page != last_page) {
+					dirty_pages++;
+					last_page = page;
+				}
+			}
+		}
+		monetdb_r_bytes_copied += (lng) (dirty_pages * pagesize);
+		monetdb_r_bytes_shared += (lng) (n * sizeof(double)) - (lng) (dirty_pages * pagesize);
+	} else {
+		monetdb_r_bytes_shared += (lng) (BATcount(b) * Tsize(b));
+	}
+
 	allocator.mem_alloc = monetdb_r_alloc;
 	allocator.mem_free  = monetdb_r_free;
 	allocator.res = NULL;
@@ -170,7 +480,30 @@ static SEXP monetdb_r_dressup(BAT *b, SEXPTYPE target_type) {
 #endif
 
 
-static SEXP bat_to_sexp(BAT* b, sql_subtype *subtype, int *unfix) {
+/* fixed-width columns that sexp_fill can convert */
+static int bat_to_sexp_fillable(int battype) {
+	switch (battype) {
+	case TYPE_bit:
+	case TYPE_bte:
+	case TYPE_sht:
+	case TYPE_int:
+	case TYPE_lng:
+#ifdef HAVE_HGE
+	case TYPE_hge:
+#endif
+	case TYPE_flt:
+	case TYPE_dbl:
+		return 1;
+	default:
+		return (battype == TYPE_date && ATOMstorage(battype) == TYPE_int) ||
+			(battype == TYPE_timestamp && ATOMstorage(battype) == TYPE_lng) ||
+			(battype == TYPE_daytime && ATOMstorage(battype) == TYPE_int);
+	}
+}
+
+/* given a queue, fixed-width columns are only allocated here and converted
+ * once the caller runs the queue; b then has to stay fixed until then */
+static SEXP bat_to_sexp(BAT* b, sql_subtype *subtype, int *unfix, sexp_fill_queue *queue) {
 	SEXP varvalue = NULL;
 	int battype = getBatType(b->ttype);
 	// TODO: deal with more esoteric SQL types (TIME)
@@ -208,8 +541,8 @@ static SEXP bat_to_sexp(BAT* b, sql_subtype *subtype, int *unfix) {
 		battype = TYPE_dbl;
 		// now convert double to sexp later normally, using zero-copy if applicable
 	}
-	if (battype == TYPE_bte) {
-		BAT_TO_INTSXP(b, bte, varvalue, 0);
+	if (battype == TYPE_bte || battype == TYPE_sht) {
+		varvalue = sexp_alloc_fill(b, battype, INTSXP, queue);
 	} else if (battype == TYPE_void) {
 		size_t i = 0;
 		varvalue = PROTECT(NEW_LOGICAL(BATcount(b)));
@@ -220,45 +553,37 @@ static SEXP bat_to_sexp(BAT* b, sql_subtype *subtype, int *unfix) {
 			LOGICAL_POINTER(varvalue)[i] = NA_LOGICAL;
 		}
 	} else if (battype == TYPE_bit) {
-		BAT_TO_SXP(b,bte,varvalue,NEW_LOGICAL,LOGICAL_POINTER,int,NA_LOGICAL,0);
-	} else if (battype == TYPE_sht) {
-		BAT_TO_INTSXP(b, sht, varvalue, 0);
+		varvalue = sexp_alloc_fill(b, battype, LGLSXP, queue);
 	} else if (battype == TYPE_int) {
 #ifndef NATIVE_WIN32
-		// special case: bulk memcpy/masquerade
-		if (b->T.heap.storage != STORE_MMAP ||
-				BATcount(b) < 2000000 || BATcount(b) > R_SHORT_LEN_MAX) {
-			BAT_TO_INTSXP(b, int, varvalue, 1);
+		// special case: bulk memcpy/masquerade, int_nil is NA_INTEGER
+		if (!monetdb_r_dressup_ok(b) ||
+				!(varvalue = monetdb_r_dressup(b, INTSXP))) {
+			varvalue = sexp_alloc_fill(b, battype, INTSXP, queue);
 		} else {
-			varvalue = monetdb_r_dressup(b, INTSXP);
 			*unfix = 0;
 		}
 #else
-		BAT_TO_INTSXP(b, int, varvalue, 1);
-#endif
-	}
-#ifdef HAVE_HGE
-	else if   (battype == TYPE_hge) { /* R's integers are stored as int, so we cannot be sure hge will fit */
-			BAT_TO_REALSXP(b, hge, varvalue, 0);
-	}
+		varvalue = sexp_alloc_fill(b, battype, INTSXP, queue);
 #endif
-	else if   (battype == TYPE_flt) {
-		BAT_TO_REALSXP(b, flt, varvalue, 0);
 	} else if (battype == TYPE_dbl) {
 #ifndef NATIVE_WIN32
-		// special case: bulk memcpy/masquerade, but only if there are no NULLs
-		if (!b->tnonil || b->tnil || b->T.heap.storage != STORE_MMAP ||
-				BATcount(b) < 1000000 || BATcount(b) > R_SHORT_LEN_MAX) {
-			BAT_TO_REALSXP(b, dbl, varvalue, 1);
+		// special case: bulk memcpy/masquerade, NULLs are rewritten copy-on-write
+		if (!monetdb_r_dressup_ok(b) ||
+				!(varvalue = monetdb_r_dressup(b, REALSXP))) {
+			varvalue = sexp_alloc_fill(b, battype, REALSXP, queue);
 		} else {
-			varvalue = monetdb_r_dressup(b, REALSXP);
 			*unfix = 0;
 		}
 #else
-			BAT_TO_REALSXP(b, dbl, varvalue, 1);
+		varvalue = sexp_alloc_fill(b, battype, REALSXP, queue);
+#endif
+	} else if (battype == TYPE_lng || battype == TYPE_flt
+#ifdef HAVE_HGE
+			|| battype == TYPE_hge
 #endif
-	} else if (battype == TYPE_lng) {
-		BAT_TO_REALSXP(b, lng, varvalue, 0);
+			) {
+		varvalue = sexp_alloc_fill(b, battype, REALSXP, queue);
 	} else if (battype == TYPE_str) {
 		BUN j = 0, n = BATcount(b);
 		BATiter li = bat_iterator(b);
@@ -266,28 +591,31 @@ static SEXP bat_to_sexp(BAT* b, sql_subtype *subtype, int *unfix) {
 		if (varvalue == NULL) {
 			return NULL;
 		}
-		/* special case where we exploit the duplicate-eliminated string heap */
-		if (GDK_ELIMDOUBLES(b->tvheap)) {
-			size_t n_protects = 0;
-			SEXP* sexp_ptrs = GDKzalloc(b->tvheap->free * sizeof(SEXP));
-			if (!sexp_ptrs) {
-				return NULL;
-			}
+		/* convert every distinct heap offset only once: below GDK_ELIMLIMIT
+		 * equal strings share their offset, and projections (e.g. join
+		 * results) repeat the offsets of their parent on any heap. strings
+		 * are GDK_VARALIGN aligned, so that is what we index the dictionary
+		 * by. for sparse views into huge heaps the dictionary would be far
+		 * larger than the column, so there we convert every row */
+		size_t nslots = b->tvheap->free / GDK_VARALIGN + 1;
+		SEXP* sexp_ptrs = NULL;
+		if (nslots <= 4 * (size_t) n + 1024) {
+			sexp_ptrs = GDKzalloc(nslots * sizeof(SEXP));
+		}
+		if (sexp_ptrs) {
 			for (j = 0; j < n; j++) {
 				const char *t = (const char *) BUNtvar(li, j);
-				ptrdiff_t offset = t - b->tvheap->base;
-				if (!sexp_ptrs[offset]) {
+				size_t slot = (size_t) (t - b->tvheap->base) / GDK_VARALIGN;
+				if (!sexp_ptrs[slot]) {
 					if (strcmp(t, str_nil) == 0) {
-						sexp_ptrs[offset] = NA_STRING;
+						sexp_ptrs[slot] = NA_STRING;
 					} else {
-						sexp_ptrs[offset] = PROTECT(RSTR(t));
-						n_protects++;
+						/* reachable through varvalue, no need to protect */
+						sexp_ptrs[slot] = RSTR(t);
 					}
 				}
-				assert(sexp_ptrs[offset]);
-				SET_STRING_ELT(varvalue, j, sexp_ptrs[offset]);
+				SET_STRING_ELT(varvalue, j, sexp_ptrs[slot]);
 			}
-			UNPROTECT(n_protects);
 			GDKfree(sexp_ptrs);
 		}
 		else {
@@ -309,38 +637,24 @@ static SEXP bat_to_sexp(BAT* b, sql_subtype *subtype, int *unfix) {
 			}
 		}
 	} else if (battype == TYPE_date && ATOMstorage(battype) == TYPE_int) {
-		ValRecord val;
-		val.vtype = TYPE_int;
-		val.val.ival = 719528;
-		b = BATcalcsubcst(b, &val, NULL, TYPE_int, 1);
-		BAT_TO_REALSXP(b, int, varvalue, 0);
+		varvalue = sexp_alloc_fill(b, battype, REALSXP, queue);
+		if (!varvalue) {
+			return NULL;
+		}
 	    setAttrib(varvalue, R_ClassSymbol, mkString("Date"));
 	} else if (battype == TYPE_timestamp && ATOMstorage(battype) == TYPE_lng) {
-		BUN j, n = BATcount(b);
-		const timestamp *t = (const timestamp *) Tloc(b, 0);
-		double *valptr = NULL;
-	    SEXP class = PROTECT(NEW_STRING(2));
-		timestamp epoch;
+		SEXP class;
 
-		varvalue = PROTECT(NEW_NUMERIC(n));
-		if (!varvalue || !class || MTIMEunix_epoch(&epoch) != MAL_SUCCEED) {
+		varvalue = sexp_alloc_fill(b, battype, REALSXP, queue);
+		if (!varvalue) {
 			return NULL;
 		}
-
-		valptr = NUMERIC_POINTER(varvalue);
+	    class = PROTECT(NEW_STRING(2));
 	    SET_STRING_ELT(class, 0, mkChar("POSIXct"));
 	    SET_STRING_ELT(class, 1, mkChar("POSIXt"));
 		SET_CLASS(varvalue, class);
 		UNPROTECT(1);
 		setAttrib(varvalue, install("tzone"), mkString("UTC"));
-
-		for (j = 0; j < n; j++, t++) {
-			if (ts_isnil(*t)) {
-				valptr[j] = NA_REAL;
-			} else {
-				valptr[j] = ((double) (t->days - epoch.days)) * ((lng) 24 * 60 * 60) + ((double) (t->msecs - epoch.msecs)/1000);
-			}
-		}
 	} else if (battype == TYPE_sqlblob) {
 		BUN j, n = BATcount(b);
 		BATiter li = bat_iterator(b);
@@ -366,31 +680,12 @@ static SEXP bat_to_sexp(BAT* b, sql_subtype *subtype, int *unfix) {
 			}
 		}
 	} else if (battype == TYPE_daytime && ATOMstorage(battype) == TYPE_int) {
-		BUN j, n = BATcount(b);
-		const daytime *t = (const daytime *) Tloc(b, 0);
-		double *valptr = NULL;
-
-		varvalue = PROTECT(NEW_NUMERIC(n));
+		varvalue = sexp_alloc_fill(b, battype, REALSXP, queue);
 		if (!varvalue) {
 			return NULL;
 		}
 		SET_CLASS(varvalue, mkString("difftime"));
 		setAttrib(varvalue, install("units"), mkString("hours"));
-
-		valptr = NUMERIC_POINTER(varvalue);
-		for (j = 0; j < n; j++, t++) {
-			if (*t == daytime_nil) {
-				valptr[j] = NA_REAL;
-			} else {
-				daytime n = *t;
-				int h;
-				double frac;
-				h = n / 3600000;
-				n -= h * 3600000;
-				frac = (n / 60000.0)/60.0;
-				valptr[j]  = h + frac;
-			}
-		}
 	}
 
 	return varvalue;
@@ -418,14 +713,15 @@ static BAT* sexp_to_bat(SEXP s, int type) {
 		if (!IS_INTEGER(s)) {
 			return NULL;
 		}
-		SXP_TO_BAT(int, INTEGER_POINTER, *p==NA_INTEGER);
+		/* NA_INTEGER is int_nil, so the vector can be used as is */
+		SXP_WRAP_BAT(int, INTEGER_POINTER);
 		break;
 	}
 	case TYPE_lng: {
 		if (!IS_INTEGER(s)) {
 			return NULL;
 		}
-		SXP_TO_BAT(lng, INTEGER_POINTER, *p==NA_INTEGER);
+		SXP_TO_BAT(lng, int, INTEGER_POINTER, v == NA_INTEGER);
 		break;
 	}
 #ifdef HAVE_HGE
@@ -433,7 +729,7 @@ static BAT* sexp_to_bat(SEXP s, int type) {
 		if (!IS_INTEGER(s)) {
 			return NULL;
 		}
-		SXP_TO_BAT(hge, INTEGER_POINTER, *p==NA_INTEGER);
+		SXP_TO_BAT(hge, int, INTEGER_POINTER, v == NA_INTEGER);
 		break;
 	}
 #endif
@@ -442,15 +738,19 @@ static BAT* sexp_to_bat(SEXP s, int type) {
 		if (!IS_LOGICAL(s)) {
 			return NULL;
 		}
-		// logicals are 4-byte integers in R, we lose NA's if we compare after the cast to char
-		SXP_TO_BAT(bit, LOGICAL_POINTER, LOGICAL_POINTER(s)[j] == NA_LOGICAL);
+		// logicals are 4-byte integers in R, check for NA before the cast to char
+		SXP_TO_BAT(bit, int, LOGICAL_POINTER, v == NA_LOGICAL);
 		break;
 	}
 	case TYPE_dbl: {
 		if (!IS_NUMERIC(s)) {
 			return NULL;
 		}
-		SXP_TO_BAT(dbl, NUMERIC_POINTER, (ISNA(*p) || MNisnan(*p) || MNisinf(*p)));
+		if (sexp_all_finite(NUMERIC_POINTER(s), cnt)) {
+			SXP_WRAP_BAT(dbl, NUMERIC_POINTER);
+		} else {
+			SXP_TO_BAT(dbl, double, NUMERIC_POINTER, (ISNA(v) || MNisnan(v) || MNisinf(v)));
+		}
 		break;
 	}
 	case TYPE_str: {
@@ -531,7 +831,7 @@ static BAT* sexp_to_bat(SEXP s, int type) {
 		ValRecord val;
 		val.vtype = TYPE_int;
 		val.val.ival = 719528;
-		SXP_TO_BAT(int, NUMERIC_POINTER, ISNA(*p));
+		SXP_TO_BAT(int, double, NUMERIC_POINTER, (ISNA(v) || MNisnan(v)));
 		b = BATcalcaddcst(b, &val, NULL, TYPE_int, 1);
 	}
 
@@ -42,6 +42,8 @@
 #include <locale.h>
 
 static int monetdb_embedded_initialized = 0;
+static opt *startup_set = NULL;
+static int startup_setlen = 0;
 
 FILE* embedded_stdout;
 FILE* embedded_stderr;
@@ -86,6 +88,7 @@ char* monetdb_startup(char* dbdir, char silent, char sequential) {
 	char* sqres = NULL;
 	void* res = NULL;
 	void* c;
+	int i;
 
 // we probably don't want this.
 //	if (setlocale(LC_CTYPE, "") == NULL) {
@@ -126,6 +129,8 @@ char* monetdb_startup(char* dbdir, char silent, char sequential) {
 
 	setlen = mo_builtin_settings(&set);
 	setlen = mo_add_option(&set, setlen, opt_cmdline, "gdk_dbpath", dbdir);
+	for (i = 0; i < startup_setlen; i++)
+		setlen = mo_add_option(&set, setlen, opt_cmdline, startup_set[i].name, startup_set[i].value);
 
 	BBPaddfarm(dbdir, (1 << PERSISTENT) | (1 << TRANSIENT));
 	if (GDKinit(set, setlen) == 0) {
@@ -180,6 +185,31 @@ cleanup:
 	return retval;
 }
 
+char* monetdb_startup_option(const char* name, const char* value) {
+	int i;
+
+	if (monetdb_embedded_initialized) {
+		return GDKstrdup("Options have to be set before startup");
+	}
+	if (name == NULL || value == NULL) {
+		return GDKstrdup("Option name and value are required");
+	}
+	// GDKinit keeps the first of equal options, so replace an earlier value
+	for (i = 0; i < startup_setlen; i++) {
+		if (strcmp(startup_set[i].name, name) == 0) {
+			char *v = strdup(value);
+			if (v == NULL) {
+				return GDKstrdup("Memory allocation failed");
+			}
+			free(startup_set[i].value);
+			startup_set[i].value = v;
+			return NULL;
+		}
+	}
+	startup_setlen = mo_add_option(&startup_set, startup_setlen, opt_cmdline, name, value);
+	return NULL;
+}
+
 int monetdb_is_initialized(void) {
 	return monetdb_embedded_initialized > 0;
 }
@@ -278,13 +308,111 @@ cleanup:
 	return res;
 }
 
-char* monetdb_append(void* conn, const char* schema, const char* table, append_data *data, int ncols) {
-	Client c = (Client) conn;
-	mvc* m;
+/* tables without keys, indices or triggers take appends straight into the
+ * column deltas, there is nothing for a relational plan to check */
+static int monetdb_append_direct_ok(sql_table *t) {
+	return isTable(t) && t->access != TABLE_READONLY &&
+		list_length(t->keys.set) == 0 && list_length(t->idxs.set) == 0 &&
+		list_length(t->triggers.set) == 0;
+}
+
+/* hand the BATs to append_col in the current transaction, sets *done
+ * unless the BATs need the type conversions of the insert plan */
+static str monetdb_append_direct(mvc *m, sql_table *t, append_data *data, int ncols, int *done) {
+	BAT **bats;
+	node *n;
+	int i;
+	str res = MAL_SUCCEED;
+
+	*done = 0;
+	if (!monetdb_append_direct_ok(t)) {
+		return MAL_SUCCEED;
+	}
+	if ((bats = GDKzalloc(ncols * sizeof(BAT*))) == NULL) {
+		return createException(MAL, "embedded", MAL_MALLOC_FAIL);
+	}
+	for (i = 0, n = t->columns.set->h; i < ncols && n; i++, n = n->next) {
+		sql_column *col = n->data;
+		int tpe = col->type.type->localtype;
 
+		if ((bats[i] = BATdescriptor((bat) data[i].batid)) == NULL) {
+			res = createException(MAL, "embedded", "Could not access column %s", col->base.name);
+			goto cleanup;
+		}
+		if (ATOMstorage(bats[i]->ttype) != ATOMstorage(tpe) ||
+				(ATOMvarsized(tpe) && bats[i]->ttype != tpe)) {
+			goto cleanup;
+		}
+		if (BATcount(bats[i]) != BATcount(bats[0])) {
+			res = createException(MAL, "embedded", "Columns have unequal lengths");
+			goto cleanup;
+		}
+		if (!col->null && !bats[i]->tnonil && BATcount_no_nil(bats[i]) != BATcount(bats[i])) {
+			res = createException(SQL, "sql.append", "INSERT INTO: NOT NULL constraint violated for column %s.%s", t->base.name, col->base.name);
+			goto cleanup;
+		}
+	}
+	for (i = 0, n = t->columns.set->h; i < ncols && n; i++, n = n->next) {
+		if (store_funcs.append_col(m->session->tr, n->data, bats[i], TYPE_bat) != LOG_OK) {
+			m->session->status = -1;
+			res = createException(SQL, "sql.append", "Append to table %s failed", t->base.name);
+			break;
+		}
+	}
+	*done = 1;
+
+cleanup:
+	for (i = 0; i < ncols; i++) {
+		if (bats[i]) {
+			BBPunfix(bats[i]->batCacheid);
+		}
+	}
+	GDKfree(bats);
+	if (res != MAL_SUCCEED || *done) {
+		/* the BATs were handed to us, like they are to the insert plan */
+		for (i = 0; i < ncols; i++) {
+			BBPrelease((bat) data[i].batid);
+		}
+		*done = 1;
+	}
+	return res;
+}
 
+static str monetdb_append_plan(Client c, mvc *m, sql_table *t, append_data *data, int ncols) {
+	sql_rel *rel;
+	node *n;
 	int i;
 	str res = MAL_SUCCEED;
+	list *exps = sa_list(m->sa), *args = sa_list(m->sa), *types = sa_list(m->sa);
+	sql_subfunc *f = sql_find_func(m->sa, mvc_bind_schema(m, "sys"), "append", 1, F_UNION, NULL);
+
+	for (i = 0, n = t->columns.set->h; i < ncols && n; i++, n = n->next) {
+		sql_column *c = n->data;
+		append(args, exp_atom_lng(m->sa, data[i].batid));
+		append(exps, exp_column(m->sa, t->base.name, c->base.name, &c->type, CARD_MULTI, c->null, 0));
+		append(types, &c->type);
+	}
+
+	f->res = types;
+	rel = rel_insert(m, rel_basetable(m, t, t->base.name), rel_table_func(m->sa, NULL, exp_op(m->sa,  args, f), exps, 1));
+	m->scanner.rs = NULL;
+
+	if (rel && backend_dumpstmt((backend *) c->sqlcontext, c->curprg->def, rel, 1, 1, "append") < 0) {
+		return GDKstrdup("Append plan generation failure");
+	}
+	if ((res = SQLoptimizeQuery(c, c->curprg->def)) != MAL_SUCCEED ||
+			c->curprg->def->errors || (res = SQLengine(c)) != MAL_SUCCEED) {
+		return(res);
+	}
+	return MAL_SUCCEED;
+}
+
+static char* monetdb_append_table(Client c, const char* schema, const char* table, append_data *data, int ncols) {
+	mvc* m;
+	str res = MAL_SUCCEED;
+	sql_schema *s;
+	sql_table *t;
+	int done = 0;
 
 	if (!monetdb_is_initialized()) {
 		return GDKstrdup("Embedded MonetDB is not started");
@@ -303,41 +431,225 @@ char* monetdb_append(void* conn, const char* schema, const char* table, append_d
 	}
 
 	SQLtrans(m);
-	{
-		sql_rel *rel;
-		node *n;
-		list *exps = sa_list(m->sa), *args = sa_list(m->sa), *types = sa_list(m->sa);
-		sql_schema *s = mvc_bind_schema(m, schema);
-		sql_table *t = mvc_bind_table(m, s, table);
-		sql_subfunc *f = sql_find_func(m->sa, mvc_bind_schema(m, "sys"), "append", 1, F_UNION, NULL);
-
-		if (!t) {
-			return GDKstrdup("Can't find table.");
+	s = mvc_bind_schema(m, schema);
+	t = s ? mvc_bind_table(m, s, table) : NULL;
+	if (!t) {
+		return GDKstrdup("Can't find table.");
+	}
+	if (ncols != list_length(t->columns.set)) {
+		return GDKstrdup("Incorrect number of columns.");
+	}
+	if ((res = monetdb_append_direct(m, t, data, ncols, &done)) != MAL_SUCCEED) {
+		SQLautocommit(c, m);
+		return res;
+	}
+	if (!done && (res = monetdb_append_plan(c, m, t, data, ncols)) != MAL_SUCCEED) {
+		/* leave the client ready for the next query, like monetdb_query does */
+		MSresetInstructions(c->curprg->def, 1);
+		SQLautocommit(c, m);
+		return res;
+	}
+	SQLautocommit(c, m);
+	return NULL;
+}
+
+char* monetdb_append(void* conn, const char* schema, const char* table, append_data *data, int ncols) {
+	return monetdb_append_table((Client) conn, schema, table, data, ncols);
+}
+
+typedef struct append_handle {
+	Client conn;
+	char *schema;
+	char *table;
+	int ncols;
+	char **colnames;
+	int *coltypes;
+} append_handle;
+
+char* monetdb_append_prepare(void* conn, const char* schema, const char* table, void** handle) {
+	Client c = (Client) conn;
+	append_handle *h;
+	mvc* m;
+	sql_schema *s;
+	sql_table *t;
+	node *n;
+	str res = MAL_SUCCEED;
+
+	if (!monetdb_is_initialized()) {
+		return GDKstrdup("Embedded MonetDB is not started");
+	}
+	if (schema == NULL || table == NULL || handle == NULL) {
+		return GDKstrdup("Invalid parameters");
+	}
+	if (!MCvalid(c)) {
+		return GDKstrdup("Invalid connection");
+	}
+	if ((res = getSQLContext(c, NULL, &m, NULL)) != MAL_SUCCEED) {
+		return res;
+	}
+	SQLtrans(m);
+	s = mvc_bind_schema(m, schema);
+	t = s ? mvc_bind_table(m, s, table) : NULL;
+	if (!t) {
+		SQLautocommit(c, m);
+		return GDKstrdup("Can't find table.");
+	}
+	h = GDKzalloc(sizeof(append_handle));
+	if (h == NULL || (h->schema = GDKstrdup(schema)) == NULL || (h->table = GDKstrdup(table)) == NULL) {
+		monetdb_append_release(h);
+		SQLautocommit(c, m);
+		return GDKstrdup("Memory allocation failed");
+	}
+	h->conn = c;
+	h->ncols = list_length(t->columns.set);
+	h->colnames = GDKzalloc(h->ncols * sizeof(char*));
+	h->coltypes = GDKzalloc(h->ncols * sizeof(int));
+	if (h->colnames == NULL || h->coltypes == NULL) {
+		monetdb_append_release(h);
+		SQLautocommit(c, m);
+		return GDKstrdup("Memory allocation failed");
+	}
+	for (n = t->columns.set->h; n; n = n->next) {
+		sql_column *col = n->data;
+		h->coltypes[col->colnr] = col->type.type->localtype;
+		if ((h->colnames[col->colnr] = GDKstrdup(col->base.name)) == NULL) {
+			monetdb_append_release(h);
+			SQLautocommit(c, m);
+			return GDKstrdup("Memory allocation failed");
+		}
+	}
+	SQLautocommit(c, m);
+	*handle = h;
+	return MAL_SUCCEED;
+}
+
+void monetdb_append_columns(void* handle, int *column_count, char ***column_names, int **column_types) {
+	append_handle *h = (append_handle *) handle;
+
+	*column_count = h->ncols;
+	*column_names = h->colnames;
+	*column_types = h->coltypes;
+}
+
+char* monetdb_append_prepared(void* handle, append_data *data, int ncols) {
+	append_handle *h = (append_handle *) handle;
+
+	if (h == NULL) {
+		return GDKstrdup("Invalid parameters");
+	}
+	if (ncols != h->ncols) {
+		return GDKstrdup("Incorrect number of columns.");
+	}
+	return monetdb_append_table(h->conn, h->schema, h->table, data, ncols);
+}
+
+void monetdb_append_release(void* handle) {
+	append_handle *h = (append_handle *) handle;
+
+	int i;
+
+	if (h == NULL) {
+		return;
+	}
+	if (h->colnames) {
+		for (i = 0; i < h->ncols; i++) {
+			GDKfree(h->colnames[i]);
+		}
+	}
+	GDKfree(h->colnames);
+	GDKfree(h->coltypes);
+	GDKfree(h->schema);
+	GDKfree(h->table);
+	GDKfree(h);
+}
+
+char* monetdb_result_fetch(void* conn, void* result, size_t offset, size_t nrows, void** chunk) {
+	Client c = (Client) conn;
+	res_table *r = (res_table *) result, *t;
+	mvc* m;
+	str res = MAL_SUCCEED;
+	int i;
+
+	if (!monetdb_is_initialized()) {
+		return GDKstrdup("Embedded MonetDB is not started");
+	}
+	if (r == NULL || chunk == NULL) {
+		return GDKstrdup("Invalid parameters");
+	}
+	if (!MCvalid(c)) {
+		return GDKstrdup("Invalid connection");
+	}
+	if ((res = getSQLContext(c, NULL, &m, NULL)) != MAL_SUCCEED) {
+		return res;
+	}
+
+	t = res_table_create(m->session->tr, r->id, r->query_id, r->nr_cols, r->query_type, NULL, NULL);
+	if (!t) {
+		return GDKstrdup("Memory allocation failed");
+	}
+	for (i = 0; i < r->nr_cols; i++) {
+		res_col *rc = r->cols + i;
+		BAT *b = BATdescriptor(rc->b), *s;
+		BUN lo, hi;
+
+		if (!b) {
+			res_table_destroy(t);
+			return GDKstrdup("Could not access result column");
 		}
-		if (ncols != list_length(t->columns.set)) {
-			return GDKstrdup("Incorrect number of columns.");
+		lo = offset < BATcount(b) ? (BUN) offset : BATcount(b);
+		hi = nrows < BATcount(b) - lo ? lo + (BUN) nrows : BATcount(b);
+		if (lo == 0 && hi == BATcount(b)) {
+			/* the whole column, hand out the result BAT itself */
+			s = b;
+		} else {
+			/* a view for read-only results, so only the window is converted later on */
+			s = BATslice(b, lo, hi);
+			BBPunfix(b->batCacheid);
 		}
-		for (i = 0, n = t->columns.set->h; i < ncols && n; i++, n = n->next) {
-			sql_column *c = n->data;
-			append(args, exp_atom_lng(m->sa, data[i].batid));
-			append(exps, exp_column(m->sa, t->base.name, c->base.name, &c->type, CARD_MULTI, c->null, 0));
-			append(types, &c->type);
+		if (!s) {
+			res_table_destroy(t);
+			return GDKstrdup("Could not slice result column");
 		}
+		if (!res_col_create(m->session->tr, t, rc->tn, rc->name, rc->type.type->sqlname, rc->type.digits, rc->type.scale, TYPE_bat, s)) {
+			BBPunfix(s->batCacheid);
+			res_table_destroy(t);
+			return GDKstrdup("Memory allocation failed");
+		}
+		BBPunfix(s->batCacheid);
+	}
+	*chunk = t;
+	return MAL_SUCCEED;
+}
+
+char* monetdb_result_export(void* conn, void* result, const char** filenames, int compression) {
+	res_table *r = (res_table *) result;
+	int i;
 
-		f->res = types;
-		rel = rel_insert(m, rel_basetable(m, t, t->base.name), rel_table_func(m->sa, NULL, exp_op(m->sa,  args, f), exps, 1));
-		m->scanner.rs = NULL;
+	if (!monetdb_is_initialized()) {
+		return GDKstrdup("Embedded MonetDB is not started");
+	}
+	if (r == NULL || filenames == NULL) {
+		return GDKstrdup("Invalid parameters");
+	}
+	if (!MCvalid((Client) conn)) {
+		return GDKstrdup("Invalid connection");
+	}
+	for (i = 0; i < r->nr_cols; i++) {
+		BAT *b = BATdescriptor(r->cols[i].b);
+		gdk_return ret;
 
-		if (rel && backend_dumpstmt((backend *) c->sqlcontext, c->curprg->def, rel, 1, 1, "append") < 0) {
-			return GDKstrdup("Append plan generation failure");
+		if (!b) {
+			return GDKstrdup("Could not access result column");
 		}
-		if ((res = SQLoptimizeQuery(c, c->curprg->def)) != MAL_SUCCEED ||
-				c->curprg->def->errors || (res = SQLengine(c)) != MAL_SUCCEED) {
-			return(res);
+		ret = BATwritecolumn(b, filenames[i], compression);
+		BBPunfix(b->batCacheid);
+		if (ret != GDK_SUCCEED) {
+			str msg = createException(MAL, "embedded.export", "Could not write column file %s: %s", filenames[i], GDKerrbuf);
+			GDKclrerr();
+			return msg;
 		}
 	}
-	SQLautocommit(c, m);
-	return NULL;
+	return MAL_SUCCEED;
 }
 
 void monetdb_cleanup_result(void* conn, void* output) {
@@ -414,6 +726,36 @@ void monetdb_unregister_progress(void* conn) {
 
 
 
+void monetdb_get_commit_stats(monetdb_commit_stats *stats) {
+	logger_stats st;
+
+	memset(stats, 0, sizeof(*stats));
+	if (!monetdb_embedded_initialized || logger_funcs.get_stats == NULL)
+		return;
+	logger_funcs.get_stats(&st);
+	stats->commits = st.commits;
+	stats->syncs = st.syncs;
+	stats->max_batch = st.maxbatch;
+	stats->latency_usec = st.latency;
+	stats->max_latency_usec = st.maxlatency;
+}
+
+void monetdb_get_checkpoint_stats(monetdb_checkpoint_stats *stats) {
+	logger_stats st;
+
+	memset(stats, 0, sizeof(*stats));
+	if (!monetdb_embedded_initialized || logger_funcs.get_stats == NULL)
+		return;
+	logger_funcs.get_stats(&st);
+	stats->checkpoints = st.checkpoints;
+	stats->last_usec = st.ckptime;
+	stats->max_usec = st.maxckptime;
+	stats->flushed_bats = st.flushbats;
+	stats->flushed_bytes = st.flushbytes;
+	stats->progress = st.flushprogress;
+	stats->pending_changes = logger_funcs.changes();
+}
+
 void monetdb_shutdown(void) {
 	if (monetdb_embedded_initialized) {
 		mserver_reset(0);
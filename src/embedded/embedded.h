@@ -23,11 +23,22 @@ typedef struct append_data {
 
 void* monetdb_connect(void);
 void  monetdb_disconnect(void* conn);
+// set a server option (e.g. gdk_commit_delay) for the next monetdb_startup
+char* monetdb_startup_option(const char* name, const char* value);
 char* monetdb_startup(char* dbdir, char silent, char sequential);
 int   monetdb_is_initialized(void);
 char* monetdb_query(void* conn, char* query, char execute, void** result, long *affected_rows, long* prepare_id);
 char* monetdb_append(void* conn, const char* schema, const char* table, append_data *data, int ncols);
+// the append BATs are handed over, prepared handles keep the column names and types for repeated appends
+char* monetdb_append_prepare(void* conn, const char* schema, const char* table, void** handle);
+void  monetdb_append_columns(void* handle, int *column_count, char ***column_names, int **column_types);
+char* monetdb_append_prepared(void* handle, append_data *data, int ncols);
+void  monetdb_append_release(void* handle);
+// rows [offset, offset + nrows) of a result as a new result, to be cleaned up like any other
+char* monetdb_result_fetch(void* conn, void* result, size_t offset, size_t nrows, void** chunk);
 void  monetdb_cleanup_result(void* conn, void* output);
+// write each column of a result to a column file for COPY BINARY, compression 0 (none), 1 (snappy) or 2 (lz4)
+char* monetdb_result_export(void* conn, void* result, const char** filenames, int compression);
 char* monetdb_get_columns(void* conn, const char* schema_name, const char *table_name, int *column_count, char ***column_names, int **column_types);
 
 // progress monitoring
@@ -35,6 +46,27 @@ typedef int (*monetdb_progress_callback)(void* conn, void* data, size_t num_stat
 void monetdb_register_progress(void* conn, monetdb_progress_callback callback, void* data);
 void monetdb_unregister_progress(void* conn);
 
+// write-ahead log group commit counters, latency is the total time commits waited for their log sync
+typedef struct monetdb_commit_stats {
+	long long commits;
+	long long syncs;
+	long long max_batch;
+	long long latency_usec;
+	long long max_latency_usec;
+} monetdb_commit_stats;
+void monetdb_get_commit_stats(monetdb_commit_stats *stats);
+// checkpoint counters, dirty columns are written ahead of a checkpoint at gdk_checkpoint_rate MB/s
+typedef struct monetdb_checkpoint_stats {
+	long long checkpoints;
+	long long last_usec;
+	long long max_usec;
+	long long flushed_bats;
+	long long flushed_bytes;
+	int progress; // percentage of the current pass over the dirty columns
+	long long pending_changes; // logged changes since the last checkpoint
+} monetdb_checkpoint_stats;
+void monetdb_get_checkpoint_stats(monetdb_checkpoint_stats *stats);
+
 
 void  monetdb_shutdown(void);
 
@@ -97,7 +97,146 @@ static int monetdb_progress_R(void* conn, void* data, size_t num_statements, siz
 
 
 
-SEXP monetdb_query_R(SEXP connsexp, SEXP querysexp, SEXP executesexp, SEXP resultconvertsexp, SEXP progressbarsexp) {
+typedef struct {
+	res_table *output;
+	int convert;
+	char *msg;
+	BAT **bats;
+	int *unfix;
+	sexp_fill_queue queue;
+} monetdb_result_conversion;
+
+/* runs under R_ExecWithCleanup, so an R error that longjmps out of one of the
+ * conversions still gets the BATs released by monetdb_result_to_R_cleanup */
+static SEXP monetdb_result_to_R_run(void *data) {
+	monetdb_result_conversion *rc = (monetdb_result_conversion *) data;
+	res_table *output = rc->output;
+	int i, ncols = output->nr_cols;
+	SEXP retlist, names;
+
+	PROTECT(retlist = allocVector(VECSXP, ncols));
+	PROTECT(names = NEW_STRING(ncols));
+	for (i = 0; i < ncols; i++) {
+		SEXP varname = RSTR(output->cols[i].name), varvalue;
+		if (!varname || !(rc->bats[i] = BATdescriptor(output->cols[i].b))) {
+			rc->msg = "Memory allocation failed";
+			UNPROTECT(2);
+			return R_NilValue;
+		}
+		SET_STRING_ELT(names, i, varname);
+		rc->unfix[i] = 1;
+		if (!rc->convert) {
+			BATsetcount(rc->bats[i], 0); // hehe
+		}
+		// fixed-width columns are only allocated here, the workers fill them below
+		if (!(varvalue = bat_to_sexp(rc->bats[i], &output->cols[i].type, &rc->unfix[i], &rc->queue))) {
+			rc->msg = "Conversion error";
+			UNPROTECT(2);
+			return R_NilValue;
+		}
+		SET_VECTOR_ELT(retlist, i, varvalue);
+		UNPROTECT(1); /* varvalue, now reachable through retlist */
+	}
+	/* every vector is allocated and protected through retlist, the workers
+	 * only write into them and nothing calls into R until they are joined */
+	sexp_fill_start(&rc->queue);
+	sexp_fill_wait(&rc->queue);
+	SET_NAMES(retlist, names);
+	UNPROTECT(2);
+	return retlist;
+}
+
+static void monetdb_result_to_R_cleanup(void *data) {
+	monetdb_result_conversion *rc = (monetdb_result_conversion *) data;
+	int i;
+
+	// slices are only left over after an error, no worker was started for them
+	GDKfree(rc->queue.tasks);
+	for (i = 0; i < rc->output->nr_cols; i++) {
+		if (rc->bats[i] && rc->unfix[i]) {
+			BBPunfix(rc->bats[i]->batCacheid);
+		}
+	}
+	GDKfree(rc->bats);
+	GDKfree(rc->unfix);
+}
+
+/* convert the columns of a result into a list of R vectors, NULL with *msg set
+ * on failure */
+static SEXP monetdb_result_to_R(res_table *output, int convert, char **msg) {
+	monetdb_result_conversion rc;
+	SEXP retlist;
+
+	memset(&rc, 0, sizeof(rc));
+	rc.output = output;
+	rc.convert = convert;
+	rc.bats = GDKzalloc(output->nr_cols * sizeof(BAT*));
+	rc.unfix = GDKzalloc(output->nr_cols * sizeof(int));
+	if (!rc.bats || !rc.unfix) {
+		GDKfree(rc.bats);
+		GDKfree(rc.unfix);
+		*msg = "Memory allocation failed";
+		return NULL;
+	}
+	retlist = R_ExecWithCleanup(monetdb_result_to_R_run, &rc, monetdb_result_to_R_cleanup, &rc);
+	if (rc.msg) {
+		*msg = rc.msg;
+		return NULL;
+	}
+	return retlist;
+}
+
+static double monetdb_result_rows(res_table *output) {
+	BAT *b = BATdescriptor(output->cols[0].b);
+	double nrows = 0;
+	if (b) {
+		nrows = (double) BATcount(b);
+		BBPunfix(b->batCacheid);
+	}
+	return nrows;
+}
+
+/* streaming results that are still open in R; they are closed when their
+ * connection is disconnected or the database is shut down, so a finalizer that
+ * runs later never touches a connection or BATs that are gone */
+typedef struct monetdb_cursor {
+	void* conn;
+	res_table* output;
+	struct monetdb_cursor* next;
+} monetdb_cursor;
+
+static monetdb_cursor* monetdb_cursors = NULL;
+
+// close the open streaming results of a connection, or all of them for NULL
+static void monetdb_cursors_close(void* conn) {
+	monetdb_cursor* cur;
+	for (cur = monetdb_cursors; cur; cur = cur->next) {
+		if (cur->output && (!conn || cur->conn == conn)) {
+			monetdb_cleanup_result(cur->conn, cur->output);
+			cur->output = NULL;
+		}
+	}
+}
+
+static void monetdb_result_finalize_R(SEXP cursorsexp) {
+	monetdb_cursor *cur = R_ExternalPtrAddr(cursorsexp), **p;
+	if (!cur) {
+		return;
+	}
+	if (cur->output) {
+		monetdb_cleanup_result(cur->conn, cur->output);
+	}
+	for (p = &monetdb_cursors; *p; p = &(*p)->next) {
+		if (*p == cur) {
+			*p = cur->next;
+			break;
+		}
+	}
+	free(cur);
+	R_ClearExternalPtr(cursorsexp);
+}
+
+SEXP monetdb_query_R(SEXP connsexp, SEXP querysexp, SEXP executesexp, SEXP resultconvertsexp, SEXP progressbarsexp, SEXP streamsexp) {
 	res_table* output = NULL;
 	long affected_rows = 0, prepare_id = 0;
 	char* err = NULL;
@@ -122,49 +261,56 @@ SEXP monetdb_query_R(SEXP connsexp, SEXP querysexp, SEXP executesexp, SEXP resul
 		return monetdb_error_R(err);
 	}
 	if (output && output->nr_cols > 0) {
-		int i = 0, ncols = output->nr_cols;
-		ssize_t nrows = -1;
-		SEXP retlist = NULL, names = NULL;
-		PROTECT(retlist = allocVector(VECSXP, ncols));
-		if (!retlist) {
-			UNPROTECT(1);
-			return monetdb_error_R("Memory allocation failed");
-		}
-		PROTECT(names = NEW_STRING(ncols));
-		if (!names) {
-			UNPROTECT(2);
-			return monetdb_error_R("Memory allocation failed");
-		}
-
-		for (i = 0; i < ncols; i++) {
-			BAT* b = BATdescriptor(output->cols[i].b);
-			SEXP varvalue = NULL;
-			SEXP varname = PROTECT(RSTR(output->cols[i].name));
-			int unfix = 1;
-			if (!varname) {
-				UNPROTECT(i * 2 + 3);
-				return monetdb_error_R("Memory allocation failed");
-			}
-			if (nrows < 0) {
-				nrows = BATcount(b);
-			}
-			if (!LOGICAL(resultconvertsexp)[0]) {
-				BATsetcount(b, 0); // hehe
+		SEXP retlist = NULL;
+		char *msg = NULL;
+		if (LOGICAL(streamsexp)[0]) {
+			/* only convert an empty window to get names and classes, the rows
+			 * are fetched through the cursor by monetdb_result_fetch_R */
+			res_table* chunk = NULL;
+			monetdb_cursor* cur;
+			SEXP cursor;
+			err = monetdb_result_fetch(connptr, output, 0, 0, (void**)&chunk);
+			if (err) {
+				monetdb_cleanup_result(connptr, output);
+				PutRNGstate();
+				return monetdb_error_R(err);
 			}
-			if (!(varvalue = bat_to_sexp(b, &output->cols[i].type, &unfix))) {
-				UNPROTECT(i * 2 + 4);
+			retlist = monetdb_result_to_R(chunk, 1, &msg);
+			monetdb_cleanup_result(connptr, chunk);
+			if (!retlist) {
+				monetdb_cleanup_result(connptr, output);
 				PutRNGstate();
-				return monetdb_error_R("Conversion error");
+				return monetdb_error_R(msg);
 			}
-			SET_VECTOR_ELT(retlist, i, varvalue);
-			SET_STRING_ELT(names, i, varname);
-			if (unfix) {
-				BBPunfix(b->batCacheid);
+			PROTECT(retlist);
+			if (!(cur = malloc(sizeof(monetdb_cursor)))) {
+				monetdb_cleanup_result(connptr, output);
+				UNPROTECT(1);
+				PutRNGstate();
+				return monetdb_error_R("Memory allocation failed");
 			}
+			cur->conn = connptr;
+			cur->output = output;
+			cur->next = monetdb_cursors;
+			monetdb_cursors = cur;
+			SET_ATTR(retlist, install("__rows"), Rf_ScalarReal(monetdb_result_rows(output)));
+			cursor = PROTECT(R_MakeExternalPtr(cur, R_NilValue, connsexp));
+			R_RegisterCFinalizer(cursor, monetdb_result_finalize_R);
+			SET_ATTR(retlist, install("__cursor"), cursor);
+			UNPROTECT(2);
+			PutRNGstate();
+			return retlist;
 		}
+		double nrows = monetdb_result_rows(output);
+		retlist = monetdb_result_to_R(output, LOGICAL(resultconvertsexp)[0], &msg);
+		if (!retlist) {
+			monetdb_cleanup_result(connptr, output);
+			PutRNGstate();
+			return monetdb_error_R(msg);
+		}
+		PROTECT(retlist);
 		SET_ATTR(retlist, install("__rows"), Rf_ScalarReal(nrows));
-		monetdb_cleanup_result(R_ExternalPtrAddr(connsexp), output);
-		SET_NAMES(retlist, names);
+		monetdb_cleanup_result(connptr, output);
 		/*
 	PROTECT(tmp = mkString("data.frame"));
     setAttrib(data, R_ClassSymbol, tmp);
@@ -178,7 +324,7 @@ SEXP monetdb_query_R(SEXP connsexp, SEXP querysexp, SEXP executesexp, SEXP resul
 	setAttrib(data, R_RowNamesSymbol, row_names);
 	UNPROTECT(1);
 		 */
-		UNPROTECT(ncols * 2 + 2);
+		UNPROTECT(1);
 		PutRNGstate();
 		return retlist;
 	}
@@ -186,6 +332,75 @@ SEXP monetdb_query_R(SEXP connsexp, SEXP querysexp, SEXP executesexp, SEXP resul
 	return ScalarReal(affected_rows);
 }
 
+SEXP monetdb_result_fetch_R(SEXP cursorsexp, SEXP offsetsexp, SEXP nsexp) {
+	monetdb_cursor* cur = R_ExternalPtrAddr(cursorsexp);
+	res_table* chunk = NULL;
+	SEXP retlist;
+	char *err, *msg = NULL;
+	double offset = NUMERIC_POINTER(offsetsexp)[0], n = NUMERIC_POINTER(nsexp)[0];
+
+	if (!cur || !cur->output) {
+		return monetdb_error_R("Result set was already cleared");
+	}
+	if (offset < 0 || n < 0) {
+		return monetdb_error_R("Invalid window");
+	}
+	err = monetdb_result_fetch(cur->conn, cur->output, (size_t) offset, (size_t) n, (void**)&chunk);
+	if (err) {
+		return monetdb_error_R(err);
+	}
+	retlist = monetdb_result_to_R(chunk, 1, &msg);
+	if (!retlist) {
+		monetdb_cleanup_result(cur->conn, chunk);
+		return monetdb_error_R(msg);
+	}
+	PROTECT(retlist);
+	SET_ATTR(retlist, install("__rows"), Rf_ScalarReal(monetdb_result_rows(chunk)));
+	monetdb_cleanup_result(cur->conn, chunk);
+	UNPROTECT(1);
+	return retlist;
+}
+
+SEXP monetdb_result_cleanup_R(SEXP cursorsexp) {
+	monetdb_result_finalize_R(cursorsexp);
+	return R_NilValue;
+}
+
+SEXP monetdb_export_R(SEXP connsexp, SEXP querysexp, SEXP filessexp, SEXP compressionsexp) {
+	res_table* output = NULL;
+	long affected_rows = 0, prepare_id = 0;
+	const char** filenames = NULL;
+	void* connptr = R_ExternalPtrAddr(connsexp);
+	char* err;
+	int i;
+
+	err = monetdb_query(connptr, (char*)CHAR(STRING_ELT(querysexp, 0)), 1, (void**)&output, &affected_rows, &prepare_id);
+	if (err) {
+		return monetdb_error_R(err);
+	}
+	if (!output || output->nr_cols != LENGTH(filessexp)) {
+		if (output) {
+			monetdb_cleanup_result(connptr, output);
+		}
+		return monetdb_error_R("Need one file name per result column");
+	}
+	filenames = malloc(output->nr_cols * sizeof(char*));
+	if (!filenames) {
+		monetdb_cleanup_result(connptr, output);
+		return monetdb_error_R("Memory allocation failed");
+	}
+	for (i = 0; i < output->nr_cols; i++) {
+		filenames[i] = CHAR(STRING_ELT(filessexp, i));
+	}
+	err = monetdb_result_export(connptr, output, filenames, INTEGER(compressionsexp)[0]);
+	free(filenames);
+	monetdb_cleanup_result(connptr, output);
+	if (err) {
+		return monetdb_error_R(err);
+	}
+	return ScalarLogical(1);
+}
+
 SEXP monetdb_startup_R(SEXP dbdirsexp, SEXP silentsexp, SEXP sequentialsexp) {
 	char* res = NULL;
 
@@ -216,11 +431,43 @@ SEXP monetdb_startup_R(SEXP dbdirsexp, SEXP silentsexp, SEXP sequentialsexp) {
 }
 
 
+/* converts the columns of tabledatasexp into BATs of the table's column types */
+static str monetdb_append_bats_R(SEXP tabledatasexp, int t_column_count, char **t_column_names, int *t_column_types, append_data **adp) {
+	int col_ct = LENGTH(tabledatasexp), i;
+	append_data *ad;
+	BAT *b;
+
+	if (t_column_count != col_ct) {
+		return GDKstrdup("Unequal number of columns");
+	}
+	ad = GDKmalloc(col_ct * sizeof(append_data));
+	if (ad == NULL) {
+		return GDKstrdup("Memory allocation failed");
+	}
+
+	for (i = 0; i < col_ct; i++) {
+		SEXP ret_col = VECTOR_ELT(tabledatasexp, i);
+		int bat_type = t_column_types[i];
+		b = sexp_to_bat(ret_col, bat_type);
+		if (b == NULL) {
+			str msg = createException(MAL, "embedded", "Could not convert column %i %s to type %i ", i, t_column_names[i], bat_type);
+			while (--i >= 0) {
+				BBPrelease((bat) ad[i].batid);
+			}
+			GDKfree(ad);
+			return msg;
+		}
+		ad[i].colname = t_column_names[i];
+		ad[i].batid = b->batCacheid;
+	}
+	*adp = ad;
+	return MAL_SUCCEED;
+}
+
 SEXP monetdb_append_R(SEXP connsexp, SEXP schemasexp, SEXP namesexp, SEXP tabledatasexp) {
 	const char *schema = NULL, *name = NULL;
 	str msg;
-	int col_ct, i;
-	BAT *b = NULL;
+	int col_ct;
 	append_data *ad = NULL;
 	int t_column_count;
 	char** t_column_names = NULL;
@@ -238,25 +485,9 @@ SEXP monetdb_append_R(SEXP connsexp, SEXP schemasexp, SEXP namesexp, SEXP tabled
 	if (msg != MAL_SUCCEED)
 		goto wrapup;
 
-	if (t_column_count != col_ct) {
-		msg = GDKstrdup("Unequal number of columns");
+	msg = monetdb_append_bats_R(tabledatasexp, t_column_count, t_column_names, t_column_types, &ad);
+	if (msg != MAL_SUCCEED)
 		goto wrapup;
-	}
-
-	ad = GDKmalloc(col_ct * sizeof(append_data));
-	assert(ad);
-
-	for (i = 0; i < col_ct; i++) {
-		SEXP ret_col = VECTOR_ELT(tabledatasexp, i);
-		int bat_type = t_column_types[i];
-		b = sexp_to_bat(ret_col, bat_type);
-		if (b == NULL) {
-			msg = createException(MAL, "embedded", "Could not convert column %i %s to type %i ", i, t_column_names[i], bat_type);
-			goto wrapup;
-		}
-		ad[i].colname = t_column_names[i];
-		ad[i].batid = b->batCacheid;
-	}
 
 	msg = monetdb_append(R_ExternalPtrAddr(connsexp), schema, name, ad, col_ct);
 
@@ -277,6 +508,63 @@ SEXP monetdb_append_R(SEXP connsexp, SEXP schemasexp, SEXP namesexp, SEXP tabled
 		return monetdb_error_R(msg);
 }
 
+static void monetdb_append_finalize_R(SEXP handlesexp) {
+	void* handle = R_ExternalPtrAddr(handlesexp);
+	if (handle) {
+		monetdb_append_release(handle);
+	}
+	R_ClearExternalPtr(handlesexp);
+}
+
+SEXP monetdb_append_prepare_R(SEXP connsexp, SEXP schemasexp, SEXP namesexp) {
+	void* handle = NULL;
+	SEXP handlesexp;
+	str msg;
+
+	if (!IS_CHARACTER(schemasexp) || !IS_CHARACTER(namesexp)) {
+		return ScalarInteger(-1);
+	}
+	msg = monetdb_append_prepare(R_ExternalPtrAddr(connsexp), CHAR(STRING_ELT(schemasexp, 0)), CHAR(STRING_ELT(namesexp, 0)), &handle);
+	if (msg != MAL_SUCCEED) {
+		return monetdb_error_R(msg);
+	}
+	/* keep the connection alive as long as the handle */
+	handlesexp = PROTECT(R_MakeExternalPtr(handle, R_NilValue, connsexp));
+	R_RegisterCFinalizer(handlesexp, monetdb_append_finalize_R);
+	UNPROTECT(1);
+	return handlesexp;
+}
+
+SEXP monetdb_append_prepared_R(SEXP handlesexp, SEXP tabledatasexp) {
+	void* handle = R_ExternalPtrAddr(handlesexp);
+	str msg;
+	append_data *ad = NULL;
+	int t_column_count;
+	char** t_column_names = NULL;
+	int* t_column_types = NULL;
+
+	if (!handle) {
+		return monetdb_error_R("Append handle was already released");
+	}
+	GetRNGstate();
+	monetdb_append_columns(handle, &t_column_count, &t_column_names, &t_column_types);
+	msg = monetdb_append_bats_R(tabledatasexp, t_column_count, t_column_names, t_column_types, &ad);
+	if (msg == MAL_SUCCEED) {
+		msg = monetdb_append_prepared(handle, ad, t_column_count);
+		GDKfree(ad);
+	}
+	PutRNGstate();
+	if (!msg) {
+		return ScalarLogical(1);
+	}
+	return monetdb_error_R(msg);
+}
+
+SEXP monetdb_append_release_R(SEXP handlesexp) {
+	monetdb_append_finalize_R(handlesexp);
+	return R_NilValue;
+}
+
 
 SEXP monetdb_connect_R(void) {
 	void* llconn = monetdb_connect();
@@ -296,6 +584,7 @@ SEXP monetdb_connect_R(void) {
 SEXP monetdb_disconnect_R(SEXP connsexp) {
 	void* addr = R_ExternalPtrAddr(connsexp);
 	if (addr) {
+		monetdb_cursors_close(addr);
 		monetdb_disconnect(addr);
 		R_ClearExternalPtr(connsexp);
 	}
@@ -303,10 +592,79 @@ SEXP monetdb_disconnect_R(SEXP connsexp) {
 }
 
 SEXP monetdb_shutdown_R(void) {
+	monetdb_cursors_close(NULL);
 	monetdb_shutdown();
 	return R_NilValue;
 }
 
+SEXP monetdb_conversion_stats_R(void) {
+	SEXP stats = PROTECT(NEW_NUMERIC(3));
+	SEXP names = PROTECT(NEW_STRING(3));
+	NUMERIC_POINTER(stats)[0] = (double) monetdb_r_bytes_shared;
+	NUMERIC_POINTER(stats)[1] = (double) monetdb_r_bytes_copied;
+	NUMERIC_POINTER(stats)[2] = (double) monetdb_r_bytes_mapped;
+	SET_STRING_ELT(names, 0, mkChar("bytes_shared"));
+	SET_STRING_ELT(names, 1, mkChar("bytes_copied"));
+	SET_STRING_ELT(names, 2, mkChar("bytes_mapped"));
+	SET_NAMES(stats, names);
+	UNPROTECT(2);
+	return stats;
+}
+
+SEXP monetdb_startup_option_R(SEXP namesexp, SEXP valuesexp) {
+	char* res = monetdb_startup_option(CHAR(STRING_ELT(namesexp, 0)), CHAR(STRING_ELT(valuesexp, 0)));
+	if (!res) {
+		return ScalarLogical(1);
+	}
+	return monetdb_error_R(res);
+}
+
+SEXP monetdb_commit_stats_R(void) {
+	monetdb_commit_stats st;
+	SEXP stats = PROTECT(NEW_NUMERIC(5));
+	SEXP names = PROTECT(NEW_STRING(5));
+
+	monetdb_get_commit_stats(&st);
+	NUMERIC_POINTER(stats)[0] = (double) st.commits;
+	NUMERIC_POINTER(stats)[1] = (double) st.syncs;
+	NUMERIC_POINTER(stats)[2] = (double) st.max_batch;
+	NUMERIC_POINTER(stats)[3] = (double) st.latency_usec;
+	NUMERIC_POINTER(stats)[4] = (double) st.max_latency_usec;
+	SET_STRING_ELT(names, 0, mkChar("commits"));
+	SET_STRING_ELT(names, 1, mkChar("syncs"));
+	SET_STRING_ELT(names, 2, mkChar("max_batch"));
+	SET_STRING_ELT(names, 3, mkChar("latency_usec"));
+	SET_STRING_ELT(names, 4, mkChar("max_latency_usec"));
+	SET_NAMES(stats, names);
+	UNPROTECT(2);
+	return stats;
+}
+
+SEXP monetdb_checkpoint_stats_R(void) {
+	monetdb_checkpoint_stats st;
+	SEXP stats = PROTECT(NEW_NUMERIC(7));
+	SEXP names = PROTECT(NEW_STRING(7));
+
+	monetdb_get_checkpoint_stats(&st);
+	NUMERIC_POINTER(stats)[0] = (double) st.checkpoints;
+	NUMERIC_POINTER(stats)[1] = (double) st.last_usec;
+	NUMERIC_POINTER(stats)[2] = (double) st.max_usec;
+	NUMERIC_POINTER(stats)[3] = (double) st.flushed_bats;
+	NUMERIC_POINTER(stats)[4] = (double) st.flushed_bytes;
+	NUMERIC_POINTER(stats)[5] = (double) st.progress;
+	NUMERIC_POINTER(stats)[6] = (double) st.pending_changes;
+	SET_STRING_ELT(names, 0, mkChar("checkpoints"));
+	SET_STRING_ELT(names, 1, mkChar("last_usec"));
+	SET_STRING_ELT(names, 2, mkChar("max_usec"));
+	SET_STRING_ELT(names, 3, mkChar("flushed_bats"));
+	SET_STRING_ELT(names, 4, mkChar("flushed_bytes"));
+	SET_STRING_ELT(names, 5, mkChar("progress"));
+	SET_STRING_ELT(names, 6, mkChar("pending_changes"));
+	SET_NAMES(stats, names);
+	UNPROTECT(2);
+	return stats;
+}
+
 // ehem
 #include "mapisplit-r.h"
 
@@ -314,11 +672,21 @@ SEXP monetdb_shutdown_R(void) {
 #define CALLDEF(name, n)  {#name, (DL_FUNC) &name, n}
 static const R_CallMethodDef R_CallDef[] = {
    CALLDEF(monetdb_startup_R, 3),
+   CALLDEF(monetdb_startup_option_R, 2),
    CALLDEF(monetdb_connect_R, 0),
-   CALLDEF(monetdb_query_R, 5),
+   CALLDEF(monetdb_query_R, 6),
+   CALLDEF(monetdb_result_fetch_R, 3),
+   CALLDEF(monetdb_result_cleanup_R, 1),
+   CALLDEF(monetdb_export_R, 4),
    CALLDEF(monetdb_append_R, 4),
+   CALLDEF(monetdb_append_prepare_R, 3),
+   CALLDEF(monetdb_append_prepared_R, 2),
+   CALLDEF(monetdb_append_release_R, 1),
    CALLDEF(monetdb_disconnect_R, 1),
    CALLDEF(monetdb_shutdown_R, 0),
+   CALLDEF(monetdb_conversion_stats_R, 0),
+   CALLDEF(monetdb_commit_stats_R, 0),
+   CALLDEF(monetdb_checkpoint_stats_R, 0),
    CALLDEF(mapi_split, 2),
    {NULL, NULL, 0}
 };
@@ -18,12 +18,19 @@
 #include <R_ext/Rdynload.h>
 #include "embedded.h"
 
-SEXP monetdb_query_R(SEXP connsexp, SEXP querysexp, SEXP executesexp, SEXP resultconvertsexp, SEXP progressbarsexp);
+SEXP monetdb_query_R(SEXP connsexp, SEXP querysexp, SEXP executesexp, SEXP resultconvertsexp, SEXP progressbarsexp, SEXP streamsexp);
+SEXP monetdb_result_fetch_R(SEXP cursorsexp, SEXP offsetsexp, SEXP nsexp);
+SEXP monetdb_result_cleanup_R(SEXP cursorsexp);
+SEXP monetdb_export_R(SEXP connsexp, SEXP querysexp, SEXP filessexp, SEXP compressionsexp);
 SEXP monetdb_startup_R(SEXP dbdirsexp, SEXP silentsexp, SEXP sequentialsexp);
+SEXP monetdb_startup_option_R(SEXP namesexp, SEXP valuesexp);
 SEXP monetdb_append_R(SEXP connsexp, SEXP schemaname, SEXP tablename, SEXP tabledata);
 SEXP monetdb_connect_R(void);
 SEXP monetdb_disconnect_R(SEXP connsexp);
 SEXP monetdb_shutdown_R(void);
+SEXP monetdb_conversion_stats_R(void);
+SEXP monetdb_commit_stats_R(void);
+SEXP monetdb_checkpoint_stats_R(void);
 
 void R_init_libmonetdb5(DllInfo *dll);
 
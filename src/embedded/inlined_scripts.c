@@ -53,27 +53,27 @@ unsigned char mal_init_inline_arr[] =
 79,7,80,156,78,205,223,202,29,68,14,167,80,230,123,87,172,149,5,182,27,253,253,110,123,170,2,25,131,135,235,146,196,99,198,81,129,48,161,25,19,113,26,154,49,130,9,216,140,9,36,241,152,113,52,215,19,154,49,17,167,161,25,35,152,128,205,152,64,18,143,25,71,165,155,132,102,76,196,105,104,198,8,38,96,51,38,144,196,99,198,81,54,150,208,140,137,56,13,205,24,193,4,108,198,4,146,216,68,81,190,59,77,108,212,132,243,196,198,154,211,28,177,113,204,120,198,216,216,154,17,31,177,92,102,76,196,105,142,216,24,98,198,76,177,177,53,35,62,98,185,204,152,136,211,28,177,49,196,140,153,98,99,107,70,124,196,114,153,49,17,167,57,98,99,136,25,51,197,70,53,233,211,56,85,77,56,143,83,173,57,205,225,84,199,140,103,116,170,173,25,241,174,206,101,198,68,156,230,112,170,33,102,204,228,84,91,51,226,93,157,203,140,137,56,205,225,84,67,204,152,201,169,42,180,164,153,141,154,112,158,217,88,115,154,99,54,142,25,207,56,27,91,51,226,231,136,203,140,137,56,205,49,27,67,204,152,105,54,222,236,106,167,58,218,77,2,80,174,38,108,27,87,34,78,67,51,70,48,97,152,113,204,24,60,92,129,25,241,115,196,101,198,68,156,230,152,141,33,102,204,52,27,21,155,52,102,212,132,243,152,177,230,52,135,25,199,140,115,155,241,254,120,216,144,207,141,245,69,126,126,250,138,135,117,53,81,241,152,124,216,227,84,32,63,234,25,50,143,21,101,88,31,251,20,67,151,152,119,90,218,77,107,222,164,252,168,250,249,188,230,77,37,143,207,188,211,234,68,90,243,38,229,71,149,128,230,53,111,42,121,124,230,157,230,73,105,205,155,148,31,149,140,206,107,222,84,242,248,204,59,13,245,105,205,155,148,31,181,158,154,215,188,169,228,177,10,228,124,94,141,81,119,248,83,107,32,191,249,98,175,236,9,118,122,243,166,138,133,225,79,179,147,153,55,103,236,149,61,217,78,111,222,84,177,48,252,41,119,50,243,230,140,189,178,39,222,233,205,155,42,22,134,63,253,78,102,222,156,177,87,246,36,60,161,121,157,207,195,49,234,14,127,42,14,228,55,159,115,150,61,33,79,111,222,84,206,50,252,105,121,50,243,230,116,206,178,39,231,233,205,155,202,89,134,63,69,79,102,222,156,206,89,246,68,61,161,121,157,207,213,49,234,14,127,186,14,228,55,223,236,149,61,105,79,111,222,84,179,41,252,169,123,50,243,230,156,189,178,39,240,9,205,235,124,14,143,81,119,248,211,120,32,63,234,153,124,58,243,202,158,204,167,55,111,170,217,20,254,148,62,153,121,115,206,94,217,19,251,132,230,117,62,183,199,168,59,252,233,61,144,223,124,230,149,61,201,7,153,119,248,191,246,13,113,37,202,233,183,221,87,231,143,245,223,70,83,133,213,177,186,120,82,55,20,41,58,161,126,254,207,215,39,245,239,246,96,116,62,248,185,126,249,189,126,147,254,120,88,235,95,247,183,250,66,77,162,42,245,53,131,62,4,53,225,231,45,101,11,225,231,4,229,251,99,169,46,184,223,238,202,141,22,217,193,101,187,223,86,22,30,250,235,87,251,199,237,241,176,215,183,24,175,235,171,31,182,171,221,246,159,101,81,189,43,139,178,191,166,184,57,28,139,191,124,243,122,208,240,224,113,173,136,155,105,172,162,173,190,236,233,125,95,86,53,161,187,135,93,181,213,77,218,213,200,148,97,170,213,238,112,91,172,15,251,170,252,80,61,45,62,253,177,44,55,106,28,154,197,250,112,84,35,171,250,241,20,155,242,190,220,111,202,253,122,91,158,62,189,216,214,22,122,250,112,175,45,123,89,156,222,29,30,118,155,226,90,65,225,70,201,84,255,118,189,221,111,212,200,53,253,245,131,162,166,104,148,31,202,245,67,165,152,63,209,242,63,236,79,171,27,5,153,118,24,213,113,165,190,88,235,159,47,158,152,67,49,126,48,205,161,45,87,172,246,197,234,161,58,232,111,183,149,73,98,208,218,191,254,117,72,180,249,174,39,247,203,113,123,123,171,36,215,106,106,169,29,238,203,227,74,211,170,53,178,210,106,47,174,119,135,245,175,38,237,213,245,225,56,34,93,127,101,167,92,255,228,39,220,81,46,31,87,187,139,245,221,166,110,191,96,65,254,217,50,198,132,108,144,88,183,170,104,84,173,254,46,52,78,155,9,213,91,211,
 240,10,38,155,203,226,240,80,221,63,84,181,3,0,179,44,46,244,53,135,123,61,238,213,238,99,113,42,245,199,154,93,161,52,161,181,211,126,82,130,148,171,187,39,195,9,180,222,61,108,202,139,155,253,234,174,116,40,164,189,134,148,109,48,75,207,172,111,212,133,38,67,173,149,111,118,183,229,245,113,101,40,71,9,127,167,38,101,175,158,142,255,155,111,184,202,249,253,177,220,173,26,101,20,171,134,211,239,7,6,234,100,81,174,85,121,206,242,120,161,92,99,35,72,167,134,75,245,227,238,234,84,221,85,205,167,211,246,182,209,142,233,13,12,217,158,79,133,211,163,55,68,49,236,85,147,190,83,145,64,203,127,22,162,80,19,99,117,42,238,212,165,55,15,251,122,170,93,22,74,176,167,181,76,23,74,128,253,170,122,56,150,79,204,78,34,55,187,135,211,187,43,229,108,46,138,113,211,124,101,184,238,215,94,184,250,171,90,52,237,161,246,135,247,131,41,119,58,149,106,206,53,253,80,238,78,183,61,30,6,179,176,190,202,244,129,123,61,235,180,53,148,49,214,101,13,196,226,253,187,114,95,92,191,120,161,155,162,24,147,162,99,161,143,161,34,88,252,176,15,228,242,217,139,47,109,44,244,9,70,4,139,215,251,91,14,139,62,186,149,213,219,213,113,187,186,222,149,23,42,32,212,163,41,30,87,199,30,62,117,3,155,166,135,76,49,68,141,113,175,225,116,219,64,82,223,166,131,188,130,115,19,40,53,217,250,98,147,255,45,193,191,24,183,175,185,181,49,253,62,140,233,40,156,40,224,232,73,125,161,255,227,242,26,74,166,171,246,186,158,221,171,189,166,248,197,102,123,210,255,22,167,213,163,14,244,90,128,161,63,83,193,102,61,108,106,180,87,97,244,170,150,242,162,56,245,58,62,149,191,61,168,184,121,30,177,89,210,208,2,244,119,245,50,180,237,121,52,83,253,115,63,244,90,140,150,222,160,61,121,189,122,122,58,149,160,121,202,81,29,255,49,150,163,232,179,244,129,56,234,91,140,72,202,150,124,101,116,55,89,25,159,215,17,78,222,35,12,40,178,245,194,209,37,192,101,179,254,211,82,88,100,105,239,190,82,119,152,210,212,95,14,56,55,11,221,70,168,250,215,65,36,209,43,106,189,22,218,110,62,244,147,224,180,126,87,222,173,26,25,42,141,179,230,79,117,89,249,161,249,115,181,214,107,204,186,35,92,99,169,122,166,140,108,165,174,191,82,116,181,205,222,31,87,247,95,25,7,53,116,191,164,102,106,156,13,164,87,124,90,49,191,111,56,61,173,153,60,173,233,255,190,80,249,67,163,168,134,73,241,171,250,254,143,159,126,242,101,241,185,66,239,169,108,36,250,244,147,103,234,243,118,175,189,222,233,211,79,158,171,15,205,26,243,4,214,233,197,195,118,99,164,63,15,202,122,230,136,159,100,211,115,148,32,255,146,186,191,84,243,83,77,171,253,177,249,176,63,94,233,207,243,65,29,34,207,255,117,150,88,202,4,73,38,227,156,22,35,85,177,62,236,30,238,246,99,93,20,4,30,167,170,79,200,136,212,95,67,122,97,10,228,67,6,168,84,25,243,127,69,69,123,102,109,54,16,71,202,192,82,187,166,188,109,18,177,127,1,3,204,56,9,18,200,149,115,126,156,43,26,155,114,87,173,46,244,24,123,1,255,67,229,88,195,1,20,195,17,232,11,20,97,243,139,226,201,167,159,124,50,248,162,27,227,159,94,189,254,229,27,245,203,164,39,109,51,28,157,242,53,163,169,101,249,253,169,88,221,223,239,182,229,230,233,160,29,237,241,240,223,229,186,106,197,61,149,59,245,193,20,16,48,128,194,35,126,203,62,106,8,167,135,235,177,182,91,217,213,175,3,89,93,162,55,159,59,193,245,199,78,108,253,97,40,179,226,55,145,183,171,218,105,137,85,222,217,40,178,108,113,240,20,128,12,175,26,213,47,207,23,5,131,16,163,63,95,128,213,189,86,126,30,99,230,118,144,19,241,6,31,142,132,36,202,33,237,202,155,106,50,75,94,235,150,208,167,170,188,111,170,93,250,26,93,28,47,143,197,127,31,182,123,5,229,242,204,191,246,118,219,253,190,253,169,184,216,93,30,159,20,135,199,246,121,67,125,231,118,95,87,213,183,155,178,184,80,210,62,249,93,63,10,93,111,107,30,7,93,172,149,9,246,149,82,102,157,246,88,234,50,237,133,19,165,105,62,202,63,174,106,23,122,126,184,
 164,152,41,98,55,91,37,71,243,140,163,33,63,120,186,171,204,94,14,226,72,95,164,169,250,63,215,253,159,122,6,235,198,234,131,58,165,150,174,161,52,10,6,223,212,95,234,231,117,205,51,157,26,123,53,225,167,53,205,226,226,254,112,58,109,175,119,31,187,194,126,125,245,177,188,223,173,214,101,171,89,29,6,206,112,48,110,126,90,52,163,63,245,69,160,253,195,221,117,59,220,195,113,163,254,234,158,152,149,131,97,55,209,132,49,236,227,118,83,143,251,82,223,106,87,64,67,115,164,128,191,213,95,246,165,211,211,185,98,54,213,5,111,56,182,167,119,235,93,185,58,94,213,17,244,194,54,162,209,94,46,45,180,113,203,72,242,239,244,47,181,168,85,83,131,173,101,108,228,53,85,169,224,122,81,120,21,249,196,112,249,131,103,138,219,141,101,246,183,138,169,157,83,171,182,173,194,196,195,189,146,161,71,244,73,215,238,15,235,237,74,123,134,238,90,171,164,225,130,6,44,86,131,6,209,137,114,210,76,219,17,61,181,24,76,185,180,146,134,225,181,29,111,205,205,35,171,253,169,254,82,169,241,120,120,95,220,28,15,119,234,207,102,1,22,142,174,118,174,76,235,184,15,187,234,231,178,186,168,174,119,237,138,178,170,142,173,180,247,173,172,187,114,127,94,144,174,212,34,180,254,179,92,239,86,231,133,167,142,12,205,185,12,90,169,131,241,232,59,20,22,235,105,50,26,213,95,149,63,88,29,203,243,88,90,89,244,227,145,90,250,122,62,213,190,77,15,121,95,125,174,70,65,15,193,168,202,215,3,49,62,235,225,24,31,245,160,140,205,176,245,200,250,207,218,190,181,111,120,250,244,169,109,92,202,18,87,13,231,248,81,101,30,212,121,125,241,15,199,208,26,191,17,57,184,173,158,7,55,43,253,235,119,63,191,213,191,222,173,42,203,64,203,15,247,7,53,59,27,247,102,60,125,189,57,63,120,213,34,151,247,231,71,178,235,238,239,223,84,216,110,254,218,63,236,118,199,243,215,57,49,208,202,174,161,192,86,211,119,63,253,245,255,20,63,252,248,203,79,237,67,121,165,154,127,57,205,80,64,50,71,0,209,208,212,211,42,39,116,44,55,191,212,58,42,250,135,159,22,97,206,215,18,226,156,47,107,228,250,221,87,197,148,105,245,93,237,250,47,142,173,247,51,156,186,225,233,63,222,151,253,167,205,246,118,91,157,70,62,116,252,192,222,34,101,19,100,218,26,193,68,144,227,225,254,79,110,13,76,31,200,234,27,252,122,208,87,132,41,97,204,251,164,152,31,155,152,26,200,250,100,227,93,169,255,239,71,252,79,181,0,38,231,43,189,65,66,45,205,110,143,171,77,121,117,80,25,209,151,207,254,159,139,118,133,61,124,239,232,111,127,253,190,187,195,8,168,53,47,189,59,165,221,105,209,47,66,54,197,245,71,245,73,217,178,223,179,165,175,252,169,225,82,180,92,7,187,160,20,60,85,204,182,10,213,7,255,27,203,105,47,74,58,227,102,99,153,86,127,57,148,112,83,158,214,199,237,117,35,224,141,64,190,199,109,249,222,35,223,163,87,62,125,179,85,62,253,131,64,54,171,179,251,233,188,125,235,194,54,55,90,119,210,237,241,26,225,231,85,253,243,217,147,232,28,179,174,84,125,97,108,93,43,212,26,233,184,109,1,53,146,96,117,115,83,103,164,111,14,239,79,253,218,77,97,122,122,170,111,157,24,181,151,107,239,63,70,114,35,104,243,64,191,89,141,233,100,179,189,65,175,225,78,90,77,230,99,119,45,215,71,219,218,255,112,255,241,74,47,248,46,138,74,31,122,116,89,124,250,73,239,243,187,191,78,221,95,251,211,100,31,83,51,132,75,37,195,141,114,175,205,223,122,75,92,185,105,134,120,93,158,170,230,175,155,247,45,70,47,134,174,125,48,240,237,157,211,169,255,80,255,212,249,244,122,161,122,221,56,239,226,212,175,231,63,253,228,118,251,88,238,219,213,127,93,146,40,107,155,30,84,2,112,161,254,254,66,143,76,167,66,159,76,140,212,36,182,122,16,117,204,241,9,218,166,174,122,255,198,72,206,95,222,109,79,250,188,38,157,124,174,15,15,251,234,248,241,179,243,238,217,110,131,79,93,174,184,248,80,23,98,158,27,69,237,231,255,24,55,225,170,175,156,218,174,81,84,235,152,237,57,64,103,37,37,124,241,196,55,152,235,237,158,171,249,243,230,59,165,211,154,207,96,223,
-216,63,203,227,225,234,112,188,58,236,203,81,69,237,217,63,38,39,121,25,23,247,44,183,55,250,190,122,143,235,74,37,243,106,6,171,57,166,51,254,253,121,63,81,183,189,100,123,122,90,252,176,95,235,42,134,154,8,119,7,21,104,143,171,237,105,180,207,170,62,42,171,189,103,191,173,15,61,220,238,119,219,189,225,2,245,70,156,211,195,245,64,248,107,83,244,203,226,246,222,44,19,221,158,23,53,205,199,230,40,178,115,211,173,254,54,133,180,139,219,203,242,242,157,250,250,69,113,123,60,60,220,63,173,255,123,113,123,255,68,253,120,167,191,214,91,177,159,234,211,213,222,233,175,214,95,234,239,84,40,95,63,221,158,244,137,104,119,205,183,207,186,175,247,135,234,98,253,101,253,109,255,229,203,139,187,203,103,181,75,169,191,239,127,80,70,81,87,63,187,92,63,211,191,232,129,182,219,216,212,69,151,197,239,158,63,251,242,203,47,63,51,6,254,71,117,219,113,179,221,171,60,186,250,168,156,240,161,217,103,216,44,47,84,138,175,124,208,177,221,202,165,254,172,61,207,239,52,229,86,193,6,37,45,194,245,87,159,234,138,206,84,191,6,100,86,187,29,13,21,189,177,110,183,203,139,18,43,76,106,105,255,7,27,161,216,40,76,112,40,221,141,64,161,190,49,144,160,164,191,122,216,111,127,123,232,167,223,185,16,187,53,86,221,253,101,69,15,8,21,147,215,191,22,219,155,182,156,178,221,21,39,229,185,244,194,65,57,227,235,98,115,40,79,251,223,87,197,187,213,99,89,180,55,215,87,181,231,1,22,134,24,231,218,226,241,116,113,246,157,117,238,98,253,243,137,185,19,242,175,219,251,242,187,102,147,190,121,88,229,153,94,91,244,59,13,55,159,247,236,154,242,159,89,111,61,222,190,41,215,135,227,230,226,201,224,100,74,61,27,206,63,25,187,46,53,236,171,131,146,227,221,121,91,188,210,175,222,10,105,108,184,155,146,94,157,51,81,20,139,62,214,253,182,187,58,239,247,84,131,238,149,214,111,89,53,175,176,110,32,108,2,79,29,227,199,91,72,79,195,179,112,175,30,78,181,201,10,11,159,243,175,163,240,118,230,83,243,80,206,161,190,166,101,166,119,142,174,85,170,117,220,30,6,47,56,169,41,242,94,171,77,95,219,174,108,77,189,41,78,231,75,70,204,218,114,223,249,87,5,197,211,187,51,211,193,72,30,238,238,175,214,43,5,104,5,191,122,1,103,0,175,94,86,24,111,174,247,124,187,187,140,204,71,125,215,150,143,247,149,254,166,173,38,215,68,139,250,226,9,99,133,198,43,189,99,86,99,255,88,190,63,110,171,50,152,125,119,175,69,132,14,229,69,75,181,222,151,187,61,85,219,245,105,34,68,189,81,87,9,240,233,39,165,90,208,25,12,47,149,3,219,253,106,8,244,233,39,247,235,193,199,234,157,90,22,110,6,119,40,22,191,158,140,55,92,149,63,58,157,254,242,237,224,155,199,187,209,23,154,202,240,166,90,234,225,87,119,219,253,205,174,26,126,181,250,239,241,87,251,199,245,233,253,224,155,122,251,191,197,133,244,131,183,104,176,254,222,161,181,149,126,65,227,159,229,133,18,72,69,139,182,30,176,186,83,235,224,218,239,15,115,30,61,233,218,27,190,10,164,80,111,25,176,236,119,143,33,213,84,142,18,209,108,30,144,122,137,91,31,187,116,143,197,122,61,159,139,21,230,43,104,135,227,234,182,1,104,187,149,98,0,193,122,71,133,249,77,187,177,98,112,209,199,251,225,53,119,135,205,240,11,149,75,213,225,117,68,169,155,128,45,150,84,122,115,247,126,187,169,222,13,103,73,205,241,84,191,250,98,92,252,174,92,221,15,191,80,78,104,4,234,123,253,93,219,231,110,91,19,83,9,194,81,209,29,94,214,132,215,193,117,199,242,209,242,237,175,229,199,193,231,250,233,193,118,243,193,120,131,127,96,158,86,187,19,47,189,26,196,130,230,162,66,77,192,186,2,172,227,130,205,68,93,126,244,63,182,90,148,173,154,71,204,245,30,44,253,70,234,177,45,170,248,109,104,62,37,252,31,115,46,218,156,78,159,73,60,59,255,31,187,46,219,174,141,18,166,69,224,70,2,189,253,250,226,28,138,207,145,248,28,136,7,18,141,239,50,223,164,86,161,119,95,109,207,17,185,121,216,92,95,164,95,253,92,89,68,208,133,120,174,0,195,123,44,21,124,15,223,115,162,216,100,
-226,117,129,191,250,120,209,86,244,138,63,78,94,115,109,175,24,167,2,39,69,180,77,69,245,243,247,246,50,189,95,97,176,111,73,217,116,200,232,218,44,26,154,187,148,10,115,155,146,151,177,30,160,157,245,233,233,232,37,53,15,111,181,236,170,7,251,68,191,121,122,186,54,123,19,212,63,244,26,255,107,172,64,159,14,42,215,199,82,239,164,210,185,222,133,186,250,188,157,172,158,69,197,205,110,179,53,215,255,133,126,83,211,120,0,185,221,223,219,150,222,250,169,96,75,246,43,43,179,102,243,203,133,245,142,230,55,115,82,104,165,233,73,127,81,60,234,110,193,69,179,153,166,56,223,251,151,255,253,234,255,232,159,191,42,38,102,110,238,50,26,13,15,94,252,27,80,80,223,214,68,236,108,79,239,42,41,91,221,99,81,202,182,125,84,39,97,171,237,37,101,91,191,16,40,99,91,115,18,178,109,224,47,98,59,216,212,250,175,49,90,149,217,74,217,234,238,52,82,182,155,235,157,148,173,238,154,34,101,171,156,156,148,109,83,226,229,50,62,30,244,171,202,87,31,14,199,171,154,218,187,38,183,221,95,119,207,248,31,27,202,22,169,70,247,126,53,145,111,74,220,112,154,6,139,235,81,29,190,159,153,131,1,60,236,126,189,154,240,236,247,2,255,182,123,186,41,245,110,166,135,253,166,245,129,245,230,218,198,21,234,127,58,63,170,62,92,117,215,142,11,116,250,59,253,132,209,120,157,252,81,111,249,220,43,127,91,158,170,83,211,32,229,190,41,223,233,50,154,49,236,169,16,93,239,118,67,148,206,205,14,4,210,175,156,225,132,26,232,101,168,147,246,97,105,171,252,90,172,209,193,45,90,28,90,12,37,236,86,183,120,120,188,216,92,158,158,212,187,98,219,221,33,197,117,249,238,252,150,197,230,80,21,23,91,37,84,241,117,241,165,126,68,123,163,31,135,180,191,60,153,170,207,166,58,135,196,231,11,38,106,204,38,251,112,93,118,42,215,7,253,250,224,94,205,47,221,48,69,101,152,231,57,84,43,190,252,181,29,199,175,70,200,26,131,242,249,136,138,241,188,65,111,248,214,24,58,11,175,164,214,93,14,6,151,255,206,55,37,84,144,213,234,107,195,180,254,167,95,160,190,171,114,78,137,186,165,114,47,74,191,4,24,8,148,99,74,212,58,177,3,204,108,184,175,197,89,198,148,104,84,231,153,18,250,130,137,26,151,55,37,106,197,251,167,68,11,74,98,74,104,12,137,167,68,171,190,150,249,96,171,157,250,144,115,74,52,169,67,39,74,31,4,7,2,229,152,18,181,78,236,0,51,247,14,105,113,150,49,37,26,213,121,166,132,190,96,162,198,229,77,137,102,55,186,119,74,180,160,36,166,196,118,31,49,37,234,21,224,209,92,240,119,220,213,135,156,83,162,89,41,118,162,244,11,219,129,64,57,166,68,173,19,59,192,76,235,104,113,150,49,37,26,213,121,166,196,160,167,207,89,141,203,155,18,181,226,253,83,162,5,37,49,37,52,134,196,83,66,165,146,90,125,109,50,170,255,233,184,171,15,41,208,231,156,19,117,207,213,94,150,62,211,29,72,148,99,78,180,74,105,48,101,118,241,213,2,208,140,111,118,135,85,85,183,199,60,104,163,62,198,99,201,58,17,206,250,50,160,175,191,154,104,107,14,129,181,180,119,167,171,234,248,176,95,27,26,109,182,126,143,53,90,95,53,18,176,254,174,219,94,157,68,190,1,2,55,215,59,45,96,91,29,209,255,24,187,80,118,89,231,65,221,156,182,151,165,47,189,12,36,202,49,15,90,165,52,0,51,251,225,106,1,22,51,15,206,250,50,230,129,254,106,162,173,37,204,131,86,163,205,60,24,107,116,166,121,176,218,221,191,91,93,40,44,53,210,169,203,170,149,254,115,36,161,238,26,123,170,174,234,171,175,212,95,131,141,205,187,186,41,96,243,156,75,239,163,63,85,199,195,254,112,247,177,168,47,239,118,125,254,81,239,101,84,124,155,103,20,199,213,102,251,112,106,24,182,111,64,234,193,181,61,73,245,251,37,219,253,234,220,205,118,4,129,94,104,3,3,166,232,83,28,168,1,104,24,88,6,160,59,99,108,131,7,225,149,198,80,161,217,183,219,42,77,175,206,65,159,11,185,52,245,146,67,77,3,141,52,189,83,199,124,167,105,82,42,212,45,175,159,239,31,238,174,116,125,108,184,162,80,176,186,174,154,93,255,205,86,208,250,69,213,199,
-242,168,0,248,222,88,159,249,248,25,239,80,217,89,107,231,101,101,173,126,184,168,231,50,201,255,92,142,109,69,48,54,10,143,198,109,169,75,174,42,128,2,66,4,24,43,194,45,75,132,70,172,38,25,189,213,54,49,131,250,29,137,0,247,75,116,118,206,137,0,208,60,153,12,1,0,96,252,33,2,4,1,32,86,35,163,180,227,93,229,242,1,131,218,104,55,5,116,65,112,194,85,95,26,134,0,7,191,209,200,167,172,245,128,173,172,245,128,213,15,12,8,180,34,248,125,192,176,16,107,250,0,185,2,66,4,176,65,192,46,75,132,70,172,38,177,248,128,97,117,252,60,7,48,8,240,251,128,41,231,68,0,112,250,128,137,210,1,227,15,17,32,8,0,177,26,25,237,165,217,59,125,192,160,24,220,77,129,237,222,194,85,95,26,134,0,7,191,209,200,167,172,245,128,173,172,245,128,235,133,114,176,5,90,17,252,62,96,88,121,54,125,128,92,1,33,2,216,32,96,151,37,66,35,86,147,88,124,192,192,12,221,28,192,32,192,239,3,166,156,19,1,192,233,3,38,74,7,140,63,68,128,32,0,196,106,100,104,145,221,254,214,229,3,6,213,239,110,10,236,204,86,251,103,174,245,246,136,32,4,56,248,141,70,62,101,173,7,108,101,173,7,92,191,219,29,108,129,86,4,191,15,24,150,218,77,31,32,87,64,136,0,54,8,216,101,137,208,136,213,36,22,31,48,48,67,55,7,48,8,240,251,128,41,231,68,0,112,250,128,137,210,1,227,15,17,32,8,0,177,26,25,90,164,218,222,233,166,253,119,247,231,153,169,25,119,95,142,38,226,85,247,131,121,208,85,195,184,251,105,108,243,9,135,177,202,93,220,244,247,54,142,235,49,199,128,177,158,181,63,16,102,186,55,176,251,217,50,231,184,131,247,179,180,226,206,199,30,169,141,169,92,109,195,25,139,41,106,184,197,27,222,226,97,92,204,0,35,13,150,227,82,191,27,122,85,253,147,39,83,245,79,176,84,221,135,0,29,117,95,81,154,234,110,133,205,21,237,175,40,176,138,240,226,103,201,153,43,104,4,133,75,54,134,18,83,202,72,76,185,229,236,69,224,232,49,57,202,106,105,55,171,143,250,30,51,246,180,95,141,35,79,251,245,20,78,237,15,227,233,53,162,60,30,186,157,75,61,210,9,167,245,144,19,99,6,25,66,76,99,77,251,163,45,210,48,6,235,99,101,181,183,155,45,106,244,99,121,218,216,50,81,121,227,41,34,12,107,137,41,118,38,145,35,11,228,63,118,0,180,44,182,57,47,150,166,253,147,212,72,251,133,87,43,231,155,32,168,31,68,13,43,252,216,72,240,177,10,71,61,18,27,161,18,89,163,68,152,116,81,104,113,201,119,102,29,174,53,56,126,186,23,51,154,78,106,117,168,185,232,145,59,120,38,218,94,50,225,122,62,6,175,105,93,122,234,186,178,245,208,177,178,105,34,165,185,206,178,113,179,196,62,23,63,115,113,51,158,169,213,40,206,85,150,32,103,125,188,163,190,181,90,178,114,70,150,202,17,86,60,228,237,210,118,190,187,178,56,110,169,176,35,135,80,57,188,65,0,249,166,178,94,29,27,255,215,188,102,162,69,54,173,88,55,255,126,126,165,59,199,140,65,90,213,8,85,191,76,159,143,252,182,187,222,29,174,13,21,180,223,140,181,208,126,109,121,56,208,252,96,123,18,208,211,158,170,163,253,209,166,17,6,43,83,47,103,193,45,170,105,127,178,106,231,124,91,175,160,193,11,84,53,113,179,129,244,230,89,91,193,120,54,118,115,221,187,84,147,71,77,99,113,212,48,53,111,203,8,171,227,214,87,100,153,188,69,203,20,111,208,99,204,246,96,72,155,104,180,85,36,66,218,161,153,30,174,155,27,46,154,198,143,109,147,199,250,164,129,65,155,168,95,222,116,151,254,178,218,238,190,10,37,211,182,18,242,18,28,11,117,119,216,87,239,140,141,169,237,98,103,186,33,117,208,84,115,112,147,13,83,202,224,245,30,212,225,149,193,154,26,111,151,117,74,53,120,153,98,120,151,79,172,209,165,33,49,203,174,44,199,107,79,110,101,89,222,118,226,41,106,56,57,167,138,10,120,17,139,126,1,11,171,36,199,139,48,193,74,210,143,95,177,74,10,121,53,135,124,37,7,171,36,199,171,17,193,74,210,215,99,149,20,240,178,6,253,146,6,86,73,142,205,242,193,74,210,5,124,172,146,2,182,239,211,
-219,246,99,148,84,55,107,184,232,2,175,245,24,178,166,129,198,160,87,71,125,155,251,92,227,250,231,65,175,153,119,42,122,252,122,49,233,51,54,8,235,245,53,230,225,234,251,211,97,183,237,27,129,233,163,49,244,62,198,182,57,160,62,159,71,247,175,108,187,192,20,15,167,186,235,97,77,69,253,53,60,253,253,225,84,250,185,215,151,200,153,235,219,183,245,43,20,250,252,142,77,113,218,29,170,65,63,184,199,213,250,225,225,206,47,67,115,141,33,196,187,195,161,233,138,186,186,191,63,30,86,235,119,218,214,107,135,104,167,113,3,150,230,173,114,47,199,238,178,81,187,149,186,19,162,62,21,117,93,158,186,222,222,109,47,231,115,31,161,254,20,167,114,247,176,41,135,45,52,219,47,141,203,202,251,237,238,112,251,48,186,238,252,109,64,12,239,10,23,188,56,78,102,158,156,185,227,42,170,244,239,63,89,18,210,177,68,207,29,50,141,197,168,101,147,215,211,204,135,5,14,201,140,234,173,171,182,97,214,109,217,210,12,170,204,26,176,189,40,211,76,186,77,192,92,21,228,115,26,182,226,151,143,155,38,68,237,42,240,225,220,248,215,76,85,213,26,183,190,104,184,113,210,56,14,168,89,38,235,83,139,244,116,108,122,16,93,55,199,156,76,119,111,52,220,140,186,206,131,217,108,120,184,107,83,183,225,1,48,119,143,115,176,93,174,99,53,216,28,150,102,156,195,157,105,230,56,35,152,187,199,57,216,18,212,177,26,108,128,73,51,206,225,238,27,115,156,17,204,207,217,169,138,41,167,139,199,190,171,237,96,136,237,239,86,30,237,111,182,1,245,100,251,174,75,214,4,182,25,75,32,151,243,255,38,155,186,219,247,182,92,7,163,152,141,53,244,123,92,251,135,59,199,22,230,246,132,133,102,247,130,126,81,49,116,55,179,185,191,122,240,218,155,83,166,105,235,140,85,149,72,56,67,178,250,181,143,16,61,233,247,124,242,232,169,121,37,134,165,167,68,194,117,187,99,9,60,153,93,41,76,147,77,183,195,78,69,9,220,25,107,238,213,13,199,211,160,239,196,8,79,64,225,12,201,188,120,50,245,100,154,44,173,158,2,240,52,214,83,34,225,186,157,150,4,158,204,236,208,52,217,116,107,229,84,148,192,93,150,230,190,207,112,60,13,154,54,140,240,4,20,206,144,204,139,39,83,79,166,201,210,234,41,0,79,99,61,37,18,206,220,181,231,6,212,56,91,49,141,54,221,168,55,21,38,112,207,158,185,139,48,28,81,131,158,7,35,68,1,133,51,36,243,34,202,212,147,105,180,180,122,10,64,212,88,79,137,132,51,99,113,85,134,173,12,116,151,172,60,43,131,182,245,24,103,101,144,72,184,78,178,243,67,155,71,71,207,54,221,5,195,194,120,192,142,253,206,226,128,169,82,200,243,86,25,207,29,214,209,66,216,21,48,150,35,194,70,134,80,103,67,248,140,130,84,12,33,134,77,67,62,177,146,168,202,192,114,211,223,44,96,102,233,102,91,121,102,86,219,193,140,51,179,18,9,103,49,100,189,186,154,40,134,0,80,125,83,196,204,106,140,228,155,89,103,33,252,112,57,203,129,155,89,218,86,62,163,32,21,67,136,17,58,179,146,170,202,192,114,243,60,61,96,102,233,158,93,121,102,86,219,8,141,51,179,18,9,103,49,164,93,49,4,128,234,155,34,102,86,99,36,223,204,58,11,225,135,203,89,14,220,204,170,79,51,242,24,5,169,24,66,140,208,153,149,84,85,102,135,128,230,113,131,167,73,194,160,249,87,158,185,213,118,84,227,204,173,68,194,89,76,217,156,236,58,86,12,1,161,250,166,136,185,213,88,201,55,183,206,66,248,1,115,150,3,55,183,234,243,40,60,70,65,42,134,16,35,116,110,37,85,149,89,165,242,101,90,102,205,204,76,102,210,214,204,2,50,173,113,205,44,145,112,157,100,227,76,107,172,152,26,64,83,198,227,101,59,175,51,4,149,105,217,132,176,43,192,149,62,8,108,228,201,180,108,70,65,42,134,16,195,53,179,92,98,37,81,149,129,101,111,166,53,238,37,157,103,102,5,100,90,99,109,37,18,206,98,200,38,211,26,43,134,0,208,121,217,46,157,89,246,76,203,38,132,31,46,227,244,33,126,102,153,153,150,205,40,72,197,16,98,132,206,172,164,170,50,176,236,205,180,76,219,153,201,76,218,153,21,144,105,141,181,149,72,56,139,33,237,138,33,0,116,94,
-182,75,103,150,61,211,178,9,225,135,203,56,125,136,159,89,102,166,101,51,10,82,49,132,24,161,51,43,169,170,204,62,76,254,76,203,180,158,153,204,164,157,91,1,153,214,88,95,137,132,179,152,178,201,180,198,138,33,32,116,94,182,75,231,150,61,211,178,9,225,7,204,56,125,136,159,91,102,166,101,51,10,82,49,132,24,161,115,43,169,170,204,231,183,190,76,203,124,154,108,38,51,105,159,38,7,100,90,227,167,201,137,132,235,36,27,103,90,99,197,212,0,154,50,30,47,219,121,253,183,168,76,203,38,132,93,1,174,244,65,96,35,79,166,101,51,10,82,49,132,24,174,153,229,18,43,137,170,12,44,123,51,45,211,118,102,50,147,118,102,5,100,90,99,109,37,18,206,98,200,38,211,26,43,134,0,208,121,217,46,157,89,246,76,203,38,132,31,46,227,244,33,126,102,153,153,150,205,40,72,197,16,98,132,206,172,164,170,50,176,236,205,180,198,135,255,228,153,89,1,153,214,88,91,137,132,179,24,210,174,24,2,64,231,101,187,116,102,217,51,45,155,16,126,184,140,211,135,248,153,101,102,90,54,163,32,21,67,136,17,58,179,146,170,202,236,118,233,207,180,76,235,153,201,76,218,185,21,144,105,141,245,149,72,56,139,41,155,76,107,172,24,2,66,231,101,187,116,110,217,51,45,155,16,126,192,140,211,135,248,185,101,102,90,54,163,32,21,67,136,17,58,183,146,170,106,208,69,210,153,106,217,78,217,204,179,207,50,32,215,26,239,179,76,36,92,39,217,56,215,178,29,63,106,97,60,94,184,243,250,156,82,185,150,77,8,187,2,92,9,132,192,70,158,92,203,102,20,164,98,8,49,92,115,203,37,86,18,85,25,88,246,230,90,227,195,58,243,204,172,128,92,107,172,173,68,194,89,12,217,228,90,182,83,76,61,102,58,47,220,165,51,203,158,107,217,132,240,195,101,156,64,196,207,44,51,215,178,25,5,169,24,66,140,208,153,149,84,85,6,150,189,185,214,248,204,207,60,51,43,32,215,26,107,43,145,112,22,67,218,21,67,0,232,188,112,151,206,44,123,174,101,19,194,15,151,113,2,17,63,179,204,92,203,102,20,164,98,8,49,66,103,86,82,85,153,235,65,127,174,53,62,60,52,207,220,10,200,181,198,250,74,36,156,197,148,77,174,101,59,85,213,99,168,243,194,93,58,183,236,185,150,77,8,63,96,198,9,68,252,220,50,115,45,155,81,144,138,33,196,8,157,91,73,85,85,11,120,179,35,159,106,153,103,150,154,201,140,254,158,2,175,186,134,99,181,86,154,192,76,107,112,228,235,40,211,2,10,215,73,54,206,180,198,138,169,1,52,101,60,94,182,235,67,126,195,102,214,132,169,5,55,54,33,236,10,112,165,15,2,27,121,50,45,155,81,144,138,33,196,112,205,44,151,88,73,84,101,96,217,155,105,153,182,51,147,153,180,51,43,32,211,26,107,43,145,112,22,67,54,153,214,88,49,4,128,206,203,118,233,204,178,103,90,54,33,252,112,25,167,15,241,51,203,204,180,108,70,65,42,134,16,35,116,102,37,85,149,129,101,111,166,101,218,206,76,102,210,206,172,128,76,107,172,173,68,194,89,12,105,87,12,1,160,243,178,93,58,179,236,153,150,77,8,63,92,198,233,67,252,204,50,51,45,155,81,144,138,33,196,8,157,89,73,85,213,9,72,102,90,166,245,204,100,38,237,220,10,200,180,198,250,74,36,156,197,148,77,166,53,86,12,1,161,243,178,93,58,183,236,153,150,77,8,63,96,198,233,67,252,220,50,51,45,155,81,144,138,33,196,8,157,91,73,85,213,52,57,188,222,81,153,150,121,230,188,153,204,232,239,41,240,214,71,191,51,206,177,104,164,9,204,180,6,199,183,143,50,45,160,112,157,100,227,76,107,172,152,26,64,83,198,147,101,251,245,46,244,168,145,49,83,11,110,108,66,216,21,224,74,31,4,54,242,100,90,54,163,32,21,67,136,225,154,89,46,177,146,168,202,192,178,55,211,50,109,103,38,51,105,103,86,64,166,53,214,86,34,225,44,134,108,50,173,177,98,8,0,117,203,118,225,204,178,103,90,54,33,252,112,25,167,15,241,51,203,204,180,108,70,65,42,134,16,35,116,102,37,85,149,129,101,111,166,101,218,206,76,102,210,206,172,128,76,107,172,173,68,194,89,12,105,87,12,1,160,110,217,46,156,89,246,76,203,38,132,31,46,227,244,33,126,102,153,
-153,150,205,40,72,197,16,98,132,206,172,164,170,234,4,36,51,45,211,122,102,50,147,118,110,5,100,90,99,125,37,18,206,98,202,38,211,26,43,134,128,80,183,108,23,206,45,123,166,101,19,194,15,152,113,250,16,63,183,204,76,203,102,20,164,98,8,49,66,231,86,18,85,157,255,119,119,216,60,236,74,125,218,131,121,142,195,111,187,167,155,237,205,205,197,117,115,98,132,150,108,91,13,78,20,80,191,78,15,134,56,62,148,197,246,70,31,127,86,124,246,66,159,24,240,168,207,136,24,157,200,100,16,55,14,90,234,26,130,108,141,52,51,130,81,199,229,94,147,188,44,146,142,228,190,151,93,115,74,48,172,193,184,212,119,87,141,139,56,27,232,178,104,135,121,176,182,73,255,207,215,253,45,214,227,60,218,159,203,227,231,229,166,184,61,30,30,238,79,150,177,14,248,14,14,201,186,175,255,122,174,249,235,63,254,195,222,52,61,90,142,90,136,213,254,215,240,97,175,204,163,70,76,70,234,7,239,80,27,46,194,65,178,185,214,72,42,247,167,242,138,53,188,254,22,43,187,250,231,221,71,114,176,3,206,178,33,75,37,57,187,202,213,237,237,241,105,249,97,123,170,76,17,158,43,17,222,181,19,87,171,160,103,249,205,235,239,235,171,3,72,60,25,207,120,207,141,205,9,57,207,237,183,92,61,174,118,134,231,188,121,216,175,235,179,98,234,251,215,135,199,213,241,162,124,102,166,251,229,115,163,6,161,255,251,213,167,159,148,95,26,199,67,252,241,69,23,35,254,160,238,189,44,159,63,81,151,156,190,172,79,173,80,63,214,148,79,15,119,23,229,151,245,15,207,166,63,60,171,127,120,62,253,161,38,245,216,253,208,50,57,61,187,60,213,191,172,187,171,235,243,224,90,66,251,193,229,186,151,211,186,38,243,31,131,239,191,184,120,124,126,185,175,127,120,54,248,225,243,139,211,151,151,143,255,81,255,50,190,227,89,115,71,11,138,199,175,62,45,207,170,175,85,247,213,84,161,199,16,125,174,31,7,67,63,155,225,172,202,205,179,94,43,213,166,124,60,43,108,243,124,252,125,123,189,169,171,141,82,214,166,254,254,104,140,100,253,168,190,109,134,114,26,168,234,104,140,79,253,54,24,225,113,58,192,211,195,53,5,154,203,226,214,60,191,185,28,206,140,155,218,43,244,87,135,163,203,188,228,44,75,3,179,203,219,203,242,242,230,82,71,162,51,226,156,23,63,27,95,252,220,115,241,243,209,197,143,207,93,146,90,32,90,171,170,65,105,67,166,197,170,141,192,0,180,182,11,134,232,181,93,49,132,177,131,134,27,207,103,195,218,45,126,12,55,56,109,239,245,163,93,229,198,52,232,21,54,152,12,250,168,71,133,251,123,139,25,205,185,209,95,246,124,114,217,200,108,253,108,57,109,246,230,111,47,94,168,31,47,107,167,214,252,122,50,127,221,222,168,0,177,47,119,250,228,174,205,254,242,89,221,44,188,157,96,67,149,215,19,239,100,204,60,211,228,238,201,215,106,253,171,32,199,221,84,147,206,38,169,75,92,250,191,198,212,170,207,187,113,78,45,221,193,193,234,184,39,63,156,29,247,228,135,179,227,110,127,8,117,220,230,229,186,53,196,121,14,152,223,15,160,111,254,48,64,252,232,142,40,199,237,214,231,250,113,48,244,185,28,183,86,85,172,227,158,14,50,220,113,235,171,131,209,53,184,36,200,113,91,47,118,57,110,235,197,46,199,61,149,148,233,184,199,4,76,208,90,47,152,58,238,241,21,83,199,109,161,1,112,220,148,193,105,123,175,31,237,42,95,164,227,214,5,241,36,142,219,63,249,88,142,187,41,86,158,77,82,87,80,245,127,141,169,85,231,44,206,169,165,83,43,171,227,158,252,112,118,220,147,31,206,142,187,253,33,212,113,155,151,235,55,77,207,115,192,252,126,0,125,243,135,1,226,71,119,68,57,110,183,62,215,143,131,161,207,229,184,181,170,98,29,247,116,144,225,142,91,95,29,140,174,193,37,65,142,219,122,177,203,113,91,47,118,57,238,169,164,76,199,61,38,96,130,214,122,193,212,113,143,175,152,58,110,11,13,128,227,166,12,78,219,123,253,104,87,249,34,29,183,46,42,39,113,220,254,201,199,114,220,77,37,252,108,146,186,60,175,255,107,76,45,253,157,123,106,233,183,75,172,142,123,242,195,217,113,79,126,56,59,238,246,135,80,199,109,94,174,95,91,57,207,1,243,251,
-1,244,205,31,6,136,31,221,17,229,184,221,250,92,63,14,134,62,151,227,214,170,138,117,220,211,65,134,59,110,125,117,48,186,6,151,4,57,110,235,197,46,199,109,189,216,229,184,167,146,50,29,247,152,128,9,90,235,5,83,199,61,190,98,234,184,45,52,0,142,155,50,56,109,239,245,163,93,229,139,116,220,250,97,94,18,199,237,159,124,44,199,221,156,52,119,54,137,254,244,68,255,215,152,90,250,59,247,212,210,155,85,173,142,123,242,195,217,113,79,126,56,59,238,246,135,80,199,109,94,174,119,193,158,231,128,249,253,0,250,230,15,3,196,143,238,136,114,220,110,125,174,31,7,67,159,203,113,107,85,197,58,238,233,32,195,29,183,190,58,24,93,131,75,130,28,183,245,98,151,227,182,94,236,114,220,83,73,153,142,123,76,192,4,173,245,130,169,227,30,95,49,117,220,22,26,0,199,77,25,156,182,247,250,209,174,242,69,58,110,189,191,61,137,227,246,79,62,150,227,110,142,190,60,155,68,127,122,162,255,107,76,45,253,157,123,106,233,189,47,86,199,61,249,225,236,184,39,63,156,29,119,251,67,168,227,54,47,215,155,106,206,115,192,252,126,0,125,243,135,1,226,71,119,68,57,110,183,62,215,143,131,161,207,229,184,181,170,98,29,247,116,144,225,142,91,95,29,140,174,193,37,65,142,219,122,177,203,113,91,47,118,57,238,169,164,76,199,61,38,96,130,214,122,193,212,113,143,175,152,58,110,11,13,128,227,166,12,78,219,123,253,104,87,249,34,29,183,222,46,151,196,113,251,39,223,196,113,119,187,82,78,191,237,174,202,253,227,246,120,216,235,237,52,23,79,138,139,253,234,174,213,250,169,58,254,227,242,113,181,123,48,62,63,233,54,172,252,240,227,207,127,125,245,221,47,183,101,245,170,39,208,239,203,249,238,176,219,149,235,170,222,152,99,112,40,148,85,182,171,235,93,121,122,90,239,56,211,59,131,238,143,229,238,97,83,94,60,177,238,24,92,175,170,213,238,112,107,108,40,90,31,203,85,85,94,157,202,223,46,138,83,45,174,146,236,178,80,159,7,31,254,120,175,255,88,213,232,171,139,84,230,94,155,158,70,97,200,220,176,42,14,247,229,113,85,131,182,191,204,220,209,180,218,169,127,2,249,43,253,53,187,99,77,238,29,1,47,243,238,42,147,247,230,120,184,159,176,222,159,255,48,70,59,220,57,213,222,229,229,119,190,232,119,22,93,175,223,149,119,171,11,131,229,234,161,122,231,231,57,184,53,72,203,245,149,211,193,54,188,7,170,30,115,190,44,182,55,245,246,169,147,107,236,180,20,198,117,34,25,160,92,91,149,84,122,170,152,106,175,140,63,175,119,13,196,170,242,238,222,169,254,154,66,136,246,235,11,45,34,60,110,203,247,166,4,143,92,9,52,129,16,1,244,117,19,197,55,10,24,96,125,53,5,123,49,178,255,196,16,180,22,250,203,164,50,128,185,214,122,167,152,146,184,39,149,223,93,37,19,0,203,114,125,216,43,250,171,186,139,51,159,113,127,55,205,190,191,118,234,216,167,246,182,205,58,151,40,6,141,0,239,238,154,117,213,199,251,210,238,226,183,119,247,59,253,151,125,182,171,219,130,38,187,186,110,138,115,39,79,175,218,73,158,221,85,38,199,219,227,106,95,93,29,15,106,37,48,224,217,199,149,250,138,195,177,129,249,106,115,183,181,8,96,80,241,138,96,92,103,10,113,44,31,15,191,150,209,82,152,100,188,98,152,23,78,148,49,68,220,245,206,224,95,182,223,222,31,183,143,237,203,63,235,254,218,219,86,58,67,84,139,150,104,253,76,53,83,72,101,170,175,32,164,106,89,208,250,154,194,230,156,84,12,196,187,89,239,183,27,131,167,69,192,16,177,134,28,2,80,117,190,212,2,172,148,114,142,88,132,224,206,38,105,235,16,30,78,229,113,32,229,253,234,116,122,127,220,52,31,202,253,250,252,202,153,94,168,180,227,120,216,237,206,215,91,157,145,166,25,226,140,244,117,19,103,84,11,116,10,244,252,36,167,238,42,154,15,185,174,21,112,28,5,24,129,178,15,187,141,113,145,45,226,144,18,245,151,13,145,170,197,152,138,180,47,223,147,238,223,184,151,128,95,119,157,5,122,218,27,26,22,208,31,207,62,196,10,124,227,182,16,116,233,235,38,86,175,121,26,182,238,152,250,173,78,242,236,174,82,28,45,12,83,176,25,242,217,238,55,229,135,129,33,
-183,129,115,168,190,147,230,90,95,54,97,107,119,116,198,159,103,143,167,151,1,109,44,245,9,19,228,213,6,87,90,128,69,10,181,222,235,165,156,21,93,65,2,140,174,181,45,227,142,219,219,219,209,204,50,23,147,205,207,198,23,219,187,86,61,135,227,86,113,93,245,11,253,242,177,60,199,4,229,12,186,73,218,252,161,150,179,237,87,191,29,63,186,87,135,13,187,160,5,98,115,233,116,141,216,14,168,31,79,235,37,10,219,202,48,128,159,121,225,116,41,174,40,90,150,227,119,85,231,154,238,79,253,159,21,233,176,70,68,3,220,101,119,237,84,182,77,185,195,203,214,17,13,144,173,187,214,86,155,170,172,105,76,47,196,90,177,117,9,209,221,29,84,158,170,122,33,188,239,251,170,116,107,127,106,70,127,117,44,119,229,234,84,94,172,223,173,154,5,245,101,183,146,248,227,227,97,187,49,101,178,220,215,139,245,141,73,182,56,169,9,83,214,63,92,212,89,201,122,181,47,174,213,63,234,234,109,117,217,222,172,35,204,238,122,181,254,85,205,49,125,199,177,122,242,59,135,152,205,141,108,41,155,219,114,9,121,190,146,175,204,246,198,92,130,94,151,183,219,61,91,202,250,174,20,34,62,40,42,55,101,97,145,244,226,137,67,152,231,189,28,63,107,58,133,98,167,22,17,135,134,159,73,162,155,13,255,63,220,43,188,44,
+216,63,203,227,225,234,112,188,58,236,203,81,69,237,217,63,38,39,121,25,23,247,44,183,55,250,190,122,143,235,74,37,243,106,6,171,57,166,51,254,253,121,63,81,183,189,100,123,122,90,252,176,95,235,42,134,154,8,119,7,21,104,143,171,237,105,180,207,170,62,42,171,189,103,191,173,15,61,220,238,119,219,189,225,2,245,70,156,211,195,245,64,248,107,83,244,203,226,246,222,44,19,221,158,23,53,205,199,230,40,178,115,211,173,254,54,133,180,139,219,203,242,242,157,250,250,69,113,123,60,60,220,63,173,255,123,113,123,255,68,253,120,167,191,214,91,177,159,234,211,213,222,233,175,214,95,234,239,84,40,95,63,221,158,244,137,104,119,205,183,207,186,175,247,135,234,98,253,101,253,109,255,229,203,139,187,203,103,181,75,169,191,239,127,80,70,81,87,63,187,92,63,211,191,232,129,182,219,216,212,69,151,197,239,158,63,251,242,203,47,63,51,6,254,71,117,219,113,179,221,171,60,186,250,168,156,240,161,217,103,216,44,47,84,138,175,124,208,177,221,202,165,254,172,61,207,239,52,229,86,193,6,37,45,194,245,87,159,234,138,206,84,191,6,100,86,187,29,13,21,189,177,110,183,203,139,18,43,76,106,105,255,7,27,161,216,40,76,112,40,221,141,64,161,190,49,144,160,164,191,122,216,111,127,123,232,167,223,185,16,187,53,86,221,253,101,69,15,8,21,147,215,191,22,219,155,182,156,178,221,21,39,229,185,244,194,65,57,227,235,98,115,40,79,251,223,87,197,187,213,99,89,180,55,215,87,181,231,1,22,134,24,231,218,226,241,116,113,246,157,117,238,98,253,243,137,185,19,242,175,219,251,242,187,102,147,190,121,88,229,153,94,91,244,59,13,55,159,247,236,154,242,159,89,111,61,222,190,41,215,135,227,230,226,201,224,100,74,61,27,206,63,25,187,46,53,236,171,131,146,227,221,121,91,188,210,175,222,10,105,108,184,155,146,94,157,51,81,20,139,62,214,253,182,187,58,239,247,84,131,238,149,214,111,89,53,175,176,110,32,108,2,79,29,227,199,91,72,79,195,179,112,175,30,78,181,201,10,11,159,243,175,163,240,118,230,83,243,80,206,161,190,166,101,166,119,142,174,85,170,117,220,30,6,47,56,169,41,242,94,171,77,95,219,174,108,77,189,41,78,231,75,70,204,218,114,223,249,87,5,197,211,187,51,211,193,72,30,238,238,175,214,43,5,104,5,191,122,1,103,0,175,94,86,24,111,174,247,124,187,187,140,204,71,125,215,150,143,247,149,254,166,173,38,215,68,139,250,226,9,99,133,198,43,189,99,86,99,255,88,190,63,110,171,50,152,125,119,175,69,132,14,229,69,75,181,222,151,187,61,85,219,245,105,34,68,189,81,87,9,240,233,39,165,90,208,25,12,47,149,3,219,253,106,8,244,233,39,247,235,193,199,234,157,90,22,110,6,119,40,22,191,158,140,55,92,149,63,58,157,254,242,237,224,155,199,187,209,23,154,202,240,166,90,234,225,87,119,219,253,205,174,26,126,181,250,239,241,87,251,199,245,233,253,224,155,122,251,191,197,133,244,131,183,104,176,254,222,161,181,149,126,65,227,159,229,133,18,72,69,139,182,30,176,186,83,235,224,218,239,15,115,30,61,233,218,27,190,10,164,80,111,25,176,236,119,143,33,213,84,142,18,209,108,30,144,122,137,91,31,187,116,143,197,122,61,159,139,21,230,43,104,135,227,234,182,1,104,187,149,98,0,193,122,71,133,249,77,187,177,98,112,209,199,251,225,53,119,135,205,240,11,149,75,213,225,117,68,169,155,128,45,150,84,122,115,247,126,187,169,222,13,103,73,205,241,84,191,250,98,92,252,174,92,221,15,191,80,78,104,4,234,123,253,93,219,231,110,91,19,83,9,194,81,209,29,94,214,132,215,193,117,199,242,209,242,237,175,229,199,193,231,250,233,193,118,243,193,120,131,127,96,158,86,187,19,47,189,26,196,130,230,162,66,77,192,186,2,172,227,130,205,68,93,126,244,63,182,90,148,173,154,71,204,245,30,44,253,70,234,177,45,170,248,109,104,62,37,252,31,115,46,218,156,78,159,73,60,59,255,31,187,46,219,174,141,18,6,11,54,189,209,230,20,21,11,167,22,104,55,243,13,190,107,147,167,225,106,171,60,222,142,116,211,238,103,57,217,86,169,90,23,141,188,126,85,232,149,128,46,242,233,196,166,21,165,174,39,182,34,168,223,108,154,
+208,197,207,171,247,171,109,197,208,198,117,185,59,188,215,185,201,122,184,214,212,84,92,214,236,249,208,163,208,70,45,107,201,138,250,14,157,2,52,47,75,55,163,152,204,211,166,44,223,0,74,239,166,191,56,175,172,206,11,171,243,186,106,32,210,248,46,243,197,120,181,146,218,87,219,243,2,171,217,59,80,95,164,223,228,93,217,16,117,60,220,115,5,24,222,99,121,32,227,225,123,206,251,155,194,74,253,188,166,250,120,209,22,104,139,63,78,222,90,110,175,24,103,118,10,34,231,202,130,222,78,209,94,166,183,159,12,182,161,41,163,14,25,93,155,53,96,115,211,89,97,238,58,243,50,214,3,180,179,62,61,29,189,115,232,225,173,86,209,245,96,159,232,23,137,79,215,102,171,137,250,135,94,227,127,141,21,232,211,193,131,136,99,169,55,198,233,212,253,66,93,125,222,29,88,79,133,226,102,183,217,154,233,92,161,95,188,53,158,39,111,247,247,182,76,74,63,228,109,201,126,101,101,214,236,101,186,176,222,209,252,102,78,10,173,52,237,195,47,138,71,221,252,185,104,246,70,21,231,123,255,242,191,95,253,31,253,243,87,197,196,204,205,93,70,223,232,193,123,156,3,10,234,219,154,136,157,237,233,93,37,101,171,91,102,74,217,182,79,94,37,108,181,189,164,108,235,247,59,101,108,107,78,66,182,13,252,69,108,7,123,148,255,53,70,123,179,19,219,86,55,27,146,178,221,92,239,164,108,117,19,28,41,91,229,228,164,108,155,138,61,151,241,241,160,223,60,191,250,112,56,94,213,212,222,53,165,138,253,117,183,101,227,177,161,108,145,106,116,239,87,19,249,166,196,13,167,105,176,184,30,61,86,233,103,230,96,0,15,187,95,175,38,60,251,173,221,191,237,158,110,74,189,57,237,97,191,105,125,96,189,87,186,113,133,250,159,206,143,170,15,87,221,181,227,122,171,254,78,63,48,54,186,3,60,234,29,188,123,229,111,203,147,90,147,212,253,110,238,155,106,172,174,138,26,195,158,10,209,181,226,55,68,233,220,236,64,32,253,6,33,78,168,129,94,134,58,105,159,125,183,202,175,197,26,157,195,163,197,161,197,80,194,110,117,199,142,199,139,205,229,233,73,189,201,185,221,236,83,92,151,239,206,47,205,108,14,85,113,177,85,66,21,95,23,95,234,39,238,55,122,181,215,254,242,100,170,62,155,234,28,18,159,47,152,168,49,155,236,195,117,153,90,33,31,244,219,160,123,53,191,116,255,155,226,116,110,78,209,40,190,252,181,29,199,175,70,200,26,131,242,249,136,138,241,248,72,239,223,215,24,58,11,175,164,214,77,43,6,151,255,206,55,37,84,144,213,234,107,195,180,254,167,95,160,190,171,114,78,137,186,67,118,47,74,191,4,24,8,148,99,74,212,58,177,3,204,60,63,65,139,179,140,41,209,168,206,51,37,244,5,19,53,46,111,74,212,138,247,79,137,22,148,196,148,208,24,18,79,137,86,125,45,243,193,206,73,245,33,231,148,104,82,135,78,148,62,8,14,4,202,49,37,106,157,216,1,102,110,5,211,226,44,99,74,52,170,243,76,9,125,193,68,141,203,155,18,205,203,5,222,41,209,130,146,152,18,219,125,196,148,168,87,128,71,115,193,223,113,87,31,114,78,137,102,165,216,137,210,47,108,7,2,229,152,18,181,78,236,0,51,173,163,197,89,198,148,104,84,231,153,18,131,22,77,103,53,46,111,74,212,138,247,79,137,22,148,196,148,208,24,18,79,9,149,74,106,245,181,201,168,254,167,227,174,62,164,64,159,115,78,212,45,116,123,89,250,76,119,32,81,142,57,209,42,165,193,148,217,148,89,11,64,51,190,217,29,86,85,221,237,244,160,141,250,24,143,37,235,68,56,235,203,128,190,254,106,162,173,57,4,214,210,222,157,174,170,227,195,126,109,104,180,217,201,63,214,104,125,213,72,192,250,187,110,183,124,18,249,6,8,220,92,239,180,128,109,117,68,255,99,108,42,218,101,157,7,117,175,225,94,150,190,244,50,144,40,199,60,104,149,210,0,204,108,111,172,5,88,204,60,56,235,203,152,7,250,171,137,182,150,48,15,90,141,54,243,96,172,209,153,230,193,106,119,255,110,117,161,176,212,72,167,46,171,86,250,207,145,132,186,9,240,169,186,170,175,190,82,127,13,246,169,239,234,30,143,205,99,75,253,90,196,169,58,30,246,135,187,143,69,125,121,183,137,247,143,122,107,170,226,219,60,163,
+56,174,54,219,135,83,195,176,125,161,85,15,174,109,49,171,95,23,218,238,87,231,230,196,35,8,244,66,27,24,48,69,159,226,64,13,64,195,192,50,0,221,232,100,27,60,8,175,52,134,10,205,54,236,86,105,122,117,14,218,150,200,165,169,151,28,106,26,104,164,233,141,87,230,43,106,147,82,161,238,96,254,124,255,112,119,165,235,99,195,21,133,130,213,117,213,188,196,209,236,236,173,223,59,126,44,143,10,128,239,141,245,153,143,159,241,74,156,157,181,118,94,86,214,234,135,139,122,46,147,252,207,229,216,86,4,99,223,247,104,220,150,186,228,170,2,40,32,68,128,177,34,220,178,68,104,196,106,146,209,75,138,19,51,168,223,145,8,112,191,19,105,231,156,8,0,205,147,201,16,0,0,198,31,34,64,16,0,98,53,50,74,59,222,85,46,31,48,168,141,118,83,64,23,4,39,92,245,165,97,8,112,240,27,141,124,202,90,15,216,202,90,15,88,253,192,128,64,43,130,223,7,12,11,177,166,15,144,43,32,68,0,27,4,236,178,68,104,196,106,18,139,15,24,86,199,207,115,0,131,0,191,15,152,114,78,4,0,167,15,152,40,29,48,254,16,1,130,0,16,171,145,209,94,154,189,211,7,12,138,193,221,20,216,238,45,92,245,165,97,8,112,240,27,141,124,202,90,15,216,202,90,15,184,94,40,7,91,160,21,193,239,3,134,149,103,211,7,200,21,16,34,128,13,2,118,89,34,52,98,53,137,197,7,12,204,208,205,1,12,2,252,62,96,202,57,17,0,156,62,96,162,116,192,248,67,4,8,2,64,172,70,134,22,217,237,111,93,62,96,80,253,238,166,192,206,60,57,225,204,181,222,30,17,132,0,7,191,209,200,167,172,245,128,173,172,245,128,235,87,245,131,45,208,138,224,247,1,195,82,187,233,3,228,10,8,17,192,6,1,187,44,17,26,177,154,196,226,3,6,102,232,230,0,6,1,126,31,48,229,156,8,0,78,31,48,81,58,96,252,33,2,4,1,32,86,35,67,139,84,219,59,125,6,195,221,253,121,102,106,198,221,151,163,137,120,213,253,96,158,91,214,48,238,126,26,219,124,194,97,172,114,23,55,253,189,141,227,122,204,49,96,172,103,237,15,132,153,238,13,236,126,182,204,57,238,224,253,44,173,184,243,177,71,106,99,42,87,219,63,200,98,138,26,110,241,134,183,120,24,23,51,192,72,131,229,184,212,175,250,94,85,255,228,201,84,253,19,44,85,247,33,64,71,221,87,148,166,186,91,97,115,69,251,43,10,172,34,188,248,89,114,230,10,26,65,225,146,141,161,196,148,50,18,83,110,57,123,17,56,122,76,142,178,90,218,205,234,163,190,199,140,61,237,87,227,200,211,126,61,133,83,251,195,120,122,141,40,143,135,110,231,82,143,116,194,105,61,228,196,152,65,134,16,211,88,211,254,104,139,52,140,193,250,88,89,237,237,102,139,26,253,88,158,54,182,76,84,222,120,138,8,195,90,98,138,157,73,228,200,2,249,143,29,0,45,139,109,206,139,165,105,255,36,53,210,126,225,213,202,249,38,8,234,7,81,195,10,63,54,18,124,172,194,81,143,196,70,168,68,214,40,17,38,93,20,90,92,242,157,89,135,107,13,142,159,238,197,140,166,49,94,29,106,46,122,228,14,158,137,182,151,76,184,158,79,53,108,58,209,158,186,38,123,61,116,172,108,154,72,105,174,179,108,220,44,177,207,197,207,92,220,140,103,106,53,138,115,149,37,200,89,31,239,168,111,173,150,172,156,145,165,114,132,21,15,121,187,180,157,239,174,44,142,91,42,236,200,33,84,14,111,16,64,190,169,172,87,199,198,255,53,175,153,104,145,77,43,214,189,220,159,95,233,70,64,99,144,86,53,66,213,47,211,231,35,191,237,174,119,135,107,67,5,237,55,99,45,180,95,91,30,14,52,63,216,158,4,244,180,167,234,104,127,180,105,132,193,202,212,203,89,112,139,106,218,159,172,218,57,223,214,43,104,240,2,85,77,220,236,7,190,121,214,86,48,158,141,221,92,247,46,213,228,81,211,88,28,53,76,205,219,50,194,234,184,245,21,89,38,111,209,50,197,27,180,140,179,61,24,210,38,26,109,21,137,144,118,104,166,135,235,230,134,139,166,143,103,219,179,179,62,56,98,208,245,235,151,55,221,165,191,172,182,187,175,66,201,180,157,161,188,4,199,66,221,29,246,213,59,99,99,106,187,216,153,110,72,29,244,72,29,220,100,
+195,148,50,120,189,7,117,120,101,176,166,198,219,101,157,82,13,94,166,24,222,229,19,107,116,105,72,204,178,43,203,241,218,147,91,89,150,183,157,120,138,26,78,206,169,162,2,94,196,162,95,192,194,42,201,241,34,76,176,146,244,227,87,172,146,66,94,205,33,95,201,193,42,201,241,106,68,176,146,244,245,88,37,5,188,172,65,191,164,129,85,146,99,179,124,176,146,116,1,31,171,164,128,237,251,244,182,253,24,37,213,205,26,46,186,192,107,61,85,174,105,160,49,232,213,81,223,230,62,166,186,254,121,208,58,232,157,138,30,191,94,76,218,198,13,194,122,125,141,145,214,29,246,167,195,110,219,247,117,211,39,157,232,125,140,109,175,71,125,220,146,110,71,218,54,245,41,30,78,117,19,203,154,138,250,203,100,127,44,31,78,165,159,123,125,137,156,185,190,125,91,191,66,161,143,99,217,20,167,221,161,26,180,247,123,92,173,31,30,238,252,50,52,215,24,66,188,59,28,154,38,183,171,251,251,227,97,181,126,167,109,189,118,136,118,26,55,96,105,222,42,247,114,236,46,27,181,91,169,27,91,234,67,110,215,229,169,107,213,222,182,230,62,183,155,233,15,229,42,119,15,155,114,216,17,181,253,210,184,172,188,223,238,14,183,15,163,235,206,223,6,196,240,174,112,193,139,227,100,230,201,153,59,174,162,74,255,254,147,37,33,29,75,244,220,33,211,88,140,90,54,121,61,205,124,88,224,144,204,168,222,186,106,27,102,221,150,45,205,160,202,172,1,219,139,50,205,164,219,4,204,85,65,62,167,97,43,126,249,184,105,66,212,174,2,31,206,125,156,205,84,85,173,113,235,139,134,27,39,141,211,157,154,101,178,62,132,74,79,199,166,7,209,117,115,106,205,116,247,70,195,205,168,235,60,152,189,163,135,187,54,117,27,30,0,115,247,56,7,219,229,58,86,131,205,97,105,198,57,220,153,102,142,51,130,185,123,156,131,45,65,29,171,193,6,152,52,227,28,238,190,49,199,25,193,252,156,157,170,152,114,186,120,236,155,20,15,134,216,254,110,229,209,254,102,27,80,79,182,239,186,100,77,96,155,177,4,114,57,255,111,178,169,187,125,111,203,117,206,141,217,88,67,191,199,181,127,184,115,108,97,110,15,204,104,118,47,232,23,21,67,119,51,155,251,171,7,175,189,57,101,154,182,206,88,85,137,132,51,36,171,95,251,8,209,147,126,207,39,143,158,154,87,98,88,122,74,36,92,183,59,150,192,147,217,149,194,52,217,116,59,236,84,148,192,157,177,230,94,221,112,60,13,250,78,140,240,4,20,206,144,204,139,39,83,79,166,201,210,234,41,0,79,99,61,37,18,174,219,105,73,224,201,204,14,77,147,77,183,86,78,69,9,220,101,105,238,251,12,199,211,160,105,195,8,79,64,225,12,201,188,120,50,245,100,154,44,173,158,2,240,52,214,83,34,225,204,93,123,110,64,141,179,21,211,104,211,141,122,83,97,2,247,236,153,187,8,195,17,53,232,121,48,66,20,80,56,67,50,47,162,76,61,153,70,75,171,167,0,68,141,245,148,72,56,51,22,87,101,216,202,64,119,201,202,179,50,104,91,143,113,86,6,137,132,235,36,59,63,180,121,116,244,108,211,93,48,44,140,7,236,216,239,44,14,152,42,133,60,111,149,241,220,97,29,45,132,93,1,99,57,34,108,100,8,117,54,132,207,40,72,197,16,98,216,52,228,19,43,137,170,12,44,55,253,205,2,102,150,110,182,149,103,102,181,29,204,56,51,43,145,112,22,67,214,171,171,137,98,8,0,213,55,69,204,172,198,72,190,153,117,22,194,15,151,179,28,184,153,165,109,229,51,10,82,49,132,24,161,51,43,169,170,12,44,55,207,211,3,102,150,238,217,149,103,102,181,141,208,56,51,43,145,112,22,67,218,21,67,0,168,190,41,98,102,53,70,242,205,172,179,16,126,184,156,229,192,205,172,186,237,191,199,40,72,197,16,98,132,206,172,164,170,50,59,4,52,143,27,60,77,18,6,205,191,242,204,173,182,163,26,103,110,37,18,206,98,202,230,160,222,177,98,8,8,213,55,69,204,173,198,74,190,185,117,22,194,15,152,179,28,184,185,85,31,72,225,49,10,82,49,132,24,161,115,43,169,170,204,42,149,47,211,50,107,102,102,50,147,182,102,22,144,105,141,107,102,137,132,235,36,27,103,90,99,197,212,0,154,50,30,47,219,121,157,33,168,76,203,38,132,93,1,174,
+244,65,96,35,79,166,101,51,10,82,49,132,24,174,153,229,18,43,137,170,12,44,123,51,173,113,47,233,60,51,43,32,211,26,107,43,145,112,22,67,54,153,214,88,49,4,128,206,203,118,233,204,178,103,90,54,33,252,112,25,167,15,241,51,203,204,180,108,70,65,42,134,16,35,116,102,37,85,149,129,101,111,166,101,218,206,76,102,210,206,172,128,76,107,172,173,68,194,89,12,105,87,12,1,160,243,178,93,58,179,236,153,150,77,8,63,92,198,233,67,252,204,50,51,45,155,81,144,138,33,196,8,157,89,73,85,101,246,97,242,103,90,166,245,204,100,38,237,220,10,200,180,198,250,74,36,156,197,148,77,166,53,86,12,1,161,243,178,93,58,183,236,153,150,77,8,63,96,198,233,67,252,220,50,51,45,155,81,144,138,33,196,8,157,91,73,85,101,62,191,245,101,90,230,211,100,51,153,73,251,52,57,32,211,26,63,77,78,36,92,39,217,56,211,26,43,166,6,208,148,241,120,217,206,235,191,69,101,90,54,33,236,10,112,165,15,2,27,121,50,45,155,81,144,138,33,196,112,205,44,151,88,73,84,101,96,217,155,105,153,182,51,147,153,180,51,43,32,211,26,107,43,145,112,22,67,54,153,214,88,49,4,128,206,203,118,233,204,178,103,90,54,33,252,112,25,167,15,241,51,203,204,180,108,70,65,42,134,16,35,116,102,37,85,149,129,101,111,166,53,62,252,39,207,204,10,200,180,198,218,74,36,156,197,144,118,197,16,0,58,47,219,165,51,203,158,105,217,132,240,195,101,156,62,196,207,44,51,211,178,25,5,169,24,66,140,208,153,149,84,85,102,183,75,127,166,101,90,207,76,102,210,206,173,128,76,107,172,175,68,194,89,76,217,100,90,99,197,16,16,58,47,219,165,115,203,158,105,217,132,240,3,102,156,62,196,207,45,51,211,178,25,5,169,24,66,140,208,185,149,84,85,131,46,146,206,84,203,118,202,102,158,125,150,1,185,214,120,159,101,34,225,58,201,198,185,150,237,248,81,11,227,241,194,157,215,231,148,202,181,108,66,216,21,224,74,32,4,54,242,228,90,54,163,32,21,67,136,225,154,91,46,177,146,168,202,192,178,55,215,26,31,214,153,103,102,5,228,90,99,109,37,18,206,98,200,38,215,178,157,98,234,49,211,121,225,46,157,89,246,92,203,38,132,31,46,227,4,34,126,102,153,185,150,205,40,72,197,16,98,132,206,172,164,170,50,176,236,205,181,198,103,126,230,153,89,1,185,214,88,91,137,132,179,24,210,174,24,2,64,231,133,187,116,102,217,115,45,155,16,126,184,140,19,136,248,153,101,230,90,54,163,32,21,67,136,17,58,179,146,170,202,92,15,250,115,173,241,225,161,121,230,86,64,174,53,214,87,34,225,44,166,108,114,45,219,169,170,30,67,157,23,238,210,185,101,207,181,108,66,248,1,51,78,32,226,231,150,153,107,217,140,130,84,12,33,70,232,220,74,170,170,90,192,155,29,249,84,203,60,179,212,76,102,244,247,20,120,213,53,28,171,181,210,4,102,90,131,35,95,71,153,22,80,184,78,178,113,166,53,86,76,13,160,41,227,241,178,93,31,242,27,54,179,38,76,45,184,177,9,97,87,128,43,125,16,216,200,147,105,217,140,130,84,12,33,134,107,102,185,196,74,162,42,3,203,222,76,203,180,157,153,204,164,157,89,1,153,214,88,91,137,132,179,24,178,201,180,198,138,33,0,116,94,182,75,103,150,61,211,178,9,225,135,203,56,125,136,159,89,102,166,101,51,10,82,49,132,24,161,51,43,169,170,12,44,123,51,45,211,118,102,50,147,118,102,5,100,90,99,109,37,18,206,98,72,187,98,8,0,157,151,237,210,153,101,207,180,108,66,248,225,50,78,31,226,103,150,153,105,217,140,130,84,12,33,70,232,204,74,170,170,78,64,50,211,50,173,103,38,51,105,231,86,64,166,53,214,87,34,225,44,166,108,50,173,177,98,8,8,157,151,237,210,185,101,207,180,108,66,248,1,51,78,31,226,231,150,153,105,217,140,130,84,12,33,70,232,220,74,170,170,166,201,225,245,142,202,180,204,51,231,205,100,70,127,79,129,183,62,250,157,113,142,69,35,77,96,166,53,56,190,125,148,105,1,133,235,36,27,103,90,99,197,212,0,154,50,158,44,219,175,119,161,71,141,140,153,90,112,99,19,194,174,0,87,250,32,176,145,39,211,178,25,5,169,24,66,12,215,204,114,137,149,
+68,85,6,150,189,153,150,105,59,51,153,73,59,179,2,50,173,177,182,18,9,103,49,100,147,105,141,21,67,0,168,91,182,11,103,150,61,211,178,9,225,135,203,56,125,136,159,89,102,166,101,51,10,82,49,132,24,161,51,43,169,170,12,44,123,51,45,211,118,102,50,147,118,102,5,100,90,99,109,37,18,206,98,72,187,98,8,0,117,203,118,225,204,178,103,90,54,33,252,112,25,167,15,241,51,203,204,180,108,70,65,42,134,16,35,116,102,37,85,85,39,32,153,105,153,214,51,147,153,180,115,43,32,211,26,235,43,145,112,22,83,54,153,214,88,49,4,132,186,101,187,112,110,217,51,45,155,16,126,192,140,211,135,248,185,101,102,90,54,163,32,21,67,136,17,58,183,146,168,234,252,191,187,195,230,97,87,234,211,30,204,115,28,126,219,61,221,108,111,110,46,174,155,19,35,180,100,219,106,112,162,128,250,117,122,48,196,241,161,44,182,55,250,248,179,226,179,23,250,196,128,71,125,70,196,232,68,38,131,184,113,208,82,215,16,100,107,164,153,17,140,58,46,247,154,228,101,145,116,36,247,189,236,154,83,130,97,13,198,165,190,187,106,92,196,217,64,151,69,59,204,131,181,77,250,127,190,238,111,177,30,231,209,254,92,30,63,47,55,197,237,241,240,112,127,178,140,117,192,119,112,72,214,125,253,215,115,205,95,255,241,31,246,166,233,209,114,212,66,172,246,191,134,15,123,101,30,53,98,50,82,63,120,135,218,112,17,14,146,205,181,70,82,185,63,149,87,172,225,245,183,88,217,213,63,239,62,146,131,29,112,150,13,89,42,201,217,85,174,110,111,143,79,203,15,219,83,101,138,240,92,137,240,174,157,184,90,5,61,203,111,94,127,95,95,29,64,226,201,120,198,123,110,108,78,200,121,110,191,229,234,113,181,51,60,231,205,195,126,93,159,21,83,223,191,62,60,174,142,23,229,51,51,221,47,159,27,53,8,253,223,175,62,253,164,252,210,56,30,226,143,47,186,24,241,7,117,239,101,249,252,137,186,228,244,101,125,106,133,250,177,166,124,122,184,187,40,191,172,127,120,54,253,225,89,253,195,243,233,15,53,169,199,238,135,150,201,233,217,229,169,254,101,221,93,93,159,7,215,18,218,15,46,215,189,156,214,53,153,255,24,124,255,197,197,227,243,203,125,253,195,179,193,15,159,95,156,190,188,124,252,143,250,151,241,29,207,154,59,90,80,60,126,245,105,121,86,125,173,186,175,166,10,61,134,232,115,253,56,24,250,217,12,103,85,110,158,245,90,169,54,229,227,89,97,155,231,227,239,219,235,77,93,109,148,178,54,245,247,71,99,36,235,71,245,109,51,148,211,64,85,71,99,124,234,183,193,8,143,211,1,158,30,174,41,208,92,22,183,230,249,205,229,112,102,220,212,94,161,191,58,28,93,230,37,103,89,26,152,93,222,94,150,151,55,151,58,18,157,17,231,188,248,217,248,226,231,158,139,159,143,46,126,124,238,146,212,2,209,90,85,13,74,27,50,45,86,109,4,6,160,181,93,48,68,175,237,138,33,140,29,52,220,120,62,27,214,110,241,99,184,193,105,123,175,31,237,42,55,166,65,175,176,193,100,208,71,61,42,220,223,91,204,104,206,141,254,178,231,147,203,70,102,235,103,203,105,179,55,127,123,241,66,253,120,89,59,181,230,215,147,249,235,246,70,5,136,125,185,211,39,119,109,246,151,207,234,102,225,237,4,27,170,188,158,120,39,99,230,153,38,119,79,190,86,235,95,5,57,238,166,154,116,54,73,93,226,210,255,53,166,86,125,222,141,115,106,233,14,14,86,199,61,249,225,236,184,39,63,156,29,119,251,67,168,227,54,47,215,173,33,206,115,192,252,126,0,125,243,135,1,226,71,119,68,57,110,183,62,215,143,131,161,207,229,184,181,170,98,29,247,116,144,225,142,91,95,29,140,174,193,37,65,142,219,122,177,203,113,91,47,118,57,238,169,164,76,199,61,38,96,130,214,122,193,212,113,143,175,152,58,110,11,13,128,227,166,12,78,219,123,253,104,87,249,34,29,183,46,136,39,113,220,254,201,199,114,220,77,177,242,108,146,186,130,170,255,107,76,173,58,103,113,78,45,157,90,89,29,247,228,135,179,227,158,252,112,118,220,237,15,161,142,219,188,92,191,105,122,158,3,230,247,3,232,155,63,12,16,63,186,35,202,113,187,245,185,126,28,12,125,46,199,173,85,21,235,184,167,131,12,119,220,250,
+234,96,116,13,46,9,114,220,214,139,93,142,219,122,177,203,113,79,37,101,58,238,49,1,19,180,214,11,166,142,123,124,197,212,113,91,104,0,28,55,101,112,218,222,235,71,187,202,23,233,184,117,81,57,137,227,246,79,62,150,227,110,42,225,103,147,212,229,121,253,95,99,106,233,239,220,83,75,191,93,98,117,220,147,31,206,142,123,242,195,217,113,183,63,132,58,110,243,114,253,218,202,121,14,152,223,15,160,111,254,48,64,252,232,142,40,199,237,214,231,250,113,48,244,185,28,183,86,85,172,227,158,14,50,220,113,235,171,131,209,53,184,36,200,113,91,47,118,57,110,235,197,46,199,61,149,148,233,184,199,4,76,208,90,47,152,58,238,241,21,83,199,109,161,1,112,220,148,193,105,123,175,31,237,42,95,164,227,214,15,243,146,56,110,255,228,99,57,238,230,164,185,179,73,244,167,39,250,191,198,212,210,223,185,167,150,222,172,106,117,220,147,31,206,142,123,242,195,217,113,183,63,132,58,110,243,114,189,11,246,60,7,204,239,7,208,55,127,24,32,126,116,71,148,227,118,235,115,253,56,24,250,92,142,91,171,42,214,113,79,7,25,238,184,245,213,193,232,26,92,18,228,184,173,23,187,28,183,245,98,151,227,158,74,202,116,220,99,2,38,104,173,23,76,29,247,248,138,169,227,182,208,0,56,110,202,224,180,189,215,143,118,149,47,210,113,235,253,237,73,28,183,127,242,177,28,119,115,244,229,217,36,250,211,19,253,95,99,106,233,239,220,83,75,239,125,177,58,238,201,15,103,199,61,249,225,236,184,219,31,66,29,183,121,185,222,84,115,158,3,230,247,3,232,155,63,12,16,63,186,35,202,113,187,245,185,126,28,12,125,46,199,173,85,21,235,184,167,131,12,119,220,250,234,96,116,13,46,9,114,220,214,139,93,142,219,122,177,203,113,79,37,101,58,238,49,1,19,180,214,11,166,142,123,124,197,212,113,91,104,0,28,55,101,112,218,222,235,71,187,202,23,233,184,245,118,185,36,142,219,63,249,38,142,187,219,149,114,250,109,119,85,238,31,183,199,195,94,111,167,185,120,82,92,236,87,119,173,214,79,213,241,31,151,143,171,221,131,241,249,73,183,97,229,135,31,127,254,235,171,239,126,185,45,171,87,61,129,126,95,206,119,135,221,174,92,87,245,198,28,131,67,161,172,178,93,93,239,202,211,211,122,199,153,222,25,116,127,44,119,15,155,242,226,137,117,199,224,122,85,173,118,135,91,99,67,209,250,88,174,170,242,234,84,254,118,81,156,106,113,149,100,151,133,250,60,248,240,199,123,253,199,170,70,95,93,164,50,247,218,244,52,10,67,230,134,85,113,184,47,143,171,26,180,253,101,230,142,166,213,78,253,19,200,95,233,175,217,29,107,114,239,8,120,153,119,87,153,188,55,199,195,253,132,245,254,252,135,49,218,225,206,169,246,46,47,191,243,69,191,179,232,122,253,174,188,91,93,24,44,87,15,213,59,63,207,193,173,65,90,174,175,156,14,182,225,61,80,245,152,243,101,177,189,169,183,79,157,92,99,167,165,48,174,19,201,0,229,218,170,164,210,83,197,84,123,101,252,121,189,107,32,86,149,119,247,78,245,215,20,66,180,95,95,104,17,225,113,91,190,55,37,120,228,74,160,9,132,8,160,175,155,40,190,81,192,0,235,171,41,216,139,145,253,39,134,160,181,208,95,38,149,1,204,181,214,59,197,148,196,61,169,252,238,42,153,0,88,150,235,195,94,209,95,213,93,156,249,140,251,187,105,246,253,181,83,199,62,181,183,109,214,185,68,49,104,4,120,119,215,172,171,62,222,151,118,23,191,189,187,223,233,191,236,179,93,221,22,52,217,213,117,83,156,59,121,122,213,78,242,236,174,50,57,222,30,87,251,234,234,120,80,43,129,1,207,62,174,212,87,28,142,13,204,87,155,187,173,69,0,131,138,87,4,227,58,83,136,99,249,120,248,181,140,150,194,36,227,21,195,188,112,162,140,33,226,174,119,6,255,178,253,246,254,184,125,108,95,254,89,247,215,222,182,210,25,162,90,180,68,235,103,170,153,66,42,83,125,5,33,85,203,130,214,215,20,54,231,164,98,32,222,205,122,191,221,24,60,45,2,134,136,53,228,16,128,170,243,165,22,96,165,148,115,196,34,4,119,54,73,91,135,240,112,42,143,3,41,239,87,167,211,251,227,166,249,80,238,215,231,87,206,244,66,165,29,199,195,110,119,190,222,234,140,
+52,205,16,103,164,175,155,56,163,90,160,83,160,231,39,57,117,87,209,124,200,117,173,128,227,40,192,8,148,125,216,109,140,139,108,17,135,148,168,191,108,136,84,45,198,84,164,125,249,158,116,255,198,189,4,252,186,235,44,208,211,222,208,176,128,254,120,246,33,86,224,27,183,133,160,75,95,55,177,122,205,211,176,117,199,212,111,117,146,103,119,149,226,104,97,152,130,205,144,207,118,191,41,63,12,12,185,13,156,67,245,157,52,215,250,178,9,91,187,163,51,254,60,123,60,189,12,104,99,169,79,152,32,175,54,184,210,2,44,82,168,245,94,47,229,172,232,10,18,96,116,173,109,25,119,220,222,222,142,102,150,185,152,108,126,54,190,216,222,181,234,57,28,183,138,235,170,95,232,151,143,229,57,38,40,103,208,77,210,230,15,181,156,109,191,250,237,248,209,189,58,108,216,5,45,16,155,75,167,107,196,118,64,253,120,90,47,81,216,86,134,1,252,204,11,167,75,113,69,209,178,28,191,171,58,215,116,127,234,255,172,72,135,53,34,26,224,46,187,107,167,178,109,202,29,94,182,142,104,128,108,221,181,182,218,84,101,77,99,122,33,214,138,173,75,136,238,238,160,242,84,213,11,225,125,223,87,165,91,251,83,51,250,171,99,185,43,87,167,242,98,253,110,213,44,168,47,187,149,196,31,31,15,219,141,41,147,229,190,94,172,111,76,178,197,73,77,152,178,254,225,162,206,74,214,171,125,113,173,254,81,87,111,171,203,246,102,29,97,118,215,171,245,175,106,142,233,59,142,213,147,223,57,196,108,110,100,75,217,220,150,75,200,243,149,124,101,182,55,230,18,244,186,188,221,238,217,82,214,119,165,16,241,65,81,185,41,11,139,164,23,79,28,194,60,239,229,248,89,211,41,20,59,181,136,56,52,252,76,18,221,108,248,255,1,66,204,94,88,
 0};
 unsigned char* mal_init_inline = 0;
 
 unsigned char createdb_inline_arr[] = 
-{120,218,237,125,91,115,219,184,178,238,179,244,43,80,58,15,145,231,40,138,237,204,61,43,187,74,150,233,68,43,186,120,36,57,137,247,169,83,42,138,132,108,142,37,82,225,69,142,215,175,63,221,141,11,65,138,146,72,143,157,179,31,60,85,19,3,32,208,248,208,104,116,55,32,92,94,191,102,211,91,47,98,147,32,9,29,206,186,129,203,217,69,16,174,24,164,69,201,252,111,238,196,44,14,88,124,203,89,204,195,85,196,130,5,69,6,193,127,188,229,210,102,151,201,124,233,57,245,215,175,89,223,115,184,31,241,22,219,180,217,105,251,184,205,88,111,193,108,230,4,235,7,93,232,178,207,238,237,136,249,65,204,92,47,138,67,111,158,196,220,101,247,94,124,11,25,188,8,233,44,188,37,16,185,14,18,230,216,62,11,230,177,237,193,31,159,51,59,102,183,113,188,254,243,205,155,149,168,188,29,132,55,111,128,230,27,168,238,77,27,202,98,241,46,212,23,122,55,183,49,59,249,227,143,223,216,107,246,239,100,249,192,78,143,143,127,103,221,47,189,22,235,36,55,73,20,139,132,215,240,231,228,55,104,139,207,227,243,51,118,214,254,220,174,215,157,144,219,49,71,24,208,96,182,72,124,39,246,2,159,53,150,222,29,111,52,55,246,146,33,112,255,166,197,214,128,72,133,121,228,200,240,17,227,223,161,164,15,25,125,123,5,176,151,55,124,30,218,109,65,224,221,78,250,222,63,174,192,59,80,195,190,10,158,5,245,65,164,245,155,208,246,99,200,197,29,16,4,232,229,29,160,89,83,17,207,254,61,66,217,92,147,8,190,43,65,203,123,74,98,133,180,158,4,80,134,8,202,244,203,8,205,140,208,238,216,234,76,45,118,113,53,236,78,123,163,33,115,249,77,200,121,212,12,153,27,64,99,249,81,125,108,77,175,198,195,137,140,215,107,34,206,194,159,78,126,63,126,179,246,154,71,239,182,169,132,182,235,217,126,212,116,15,81,113,127,66,10,111,128,84,161,0,171,206,149,168,246,11,132,202,44,43,127,233,248,189,29,15,52,46,195,96,227,1,35,108,22,121,171,245,146,51,254,45,241,64,251,112,96,236,34,8,169,45,87,195,222,87,22,123,43,96,190,19,172,86,182,239,98,73,145,112,204,128,81,73,4,163,144,66,209,67,20,243,149,8,31,51,208,113,46,254,189,15,189,152,71,218,20,172,195,192,225,110,18,114,65,163,121,84,207,170,181,232,219,178,77,95,138,228,33,87,248,165,135,75,25,95,53,46,0,230,44,14,102,46,36,54,35,173,175,161,163,87,134,145,9,121,156,132,48,120,48,87,189,150,237,155,21,114,189,221,48,232,160,217,201,87,131,233,248,29,178,225,248,135,216,206,74,68,124,71,53,6,157,162,106,36,10,204,123,184,53,152,107,127,107,48,82,84,13,166,167,173,193,216,227,90,99,208,57,208,154,40,182,87,235,114,77,162,172,135,219,69,217,118,53,142,62,102,91,72,73,143,111,166,73,177,177,87,173,27,146,84,78,181,27,50,81,174,128,193,133,114,5,140,126,170,92,3,53,188,124,53,38,159,94,84,217,33,99,245,215,149,53,190,102,31,123,147,233,104,124,45,88,196,217,183,132,135,15,12,64,198,1,252,93,113,231,214,246,189,104,133,109,147,4,222,76,254,234,131,232,46,61,48,23,192,119,155,45,248,61,187,13,130,187,168,173,136,172,2,168,27,12,96,16,198,216,93,216,44,96,180,205,110,150,193,28,93,113,97,214,54,118,232,217,224,186,176,251,91,207,185,5,22,250,113,24,44,137,59,64,193,247,0,1,12,11,172,217,94,66,33,30,69,208,207,81,145,26,126,136,218,132,123,25,220,204,28,59,182,225,47,152,65,61,174,177,146,102,189,230,185,44,240,220,86,189,22,220,251,96,97,165,54,168,215,92,190,240,124,110,14,212,122,77,176,65,103,89,123,107,158,198,26,235,165,237,55,84,188,86,3,192,67,28,177,200,163,78,159,225,215,122,109,5,13,245,252,88,124,142,188,255,228,62,7,107,168,14,83,231,222,13,100,171,73,23,0,138,160,253,119,234,69,86,60,223,70,33,216,150,13,204,19,120,29,100,20,138,52,176,14,26,4,180,72,162,137,201,248,141,120,219,137,161,247,110,146,165,29,34,62,30,130,123,18,81,190,108,215,139,82,209,109,144,44,93,54,135,242,75,110,3,151,218,122,44,161,220,66,186,139,189,11,94,76,2,244,31,80,32,
-144,20,138,8,244,103,20,160,144,131,223,51,231,84,23,140,94,24,8,72,65,66,187,227,124,253,23,85,11,110,16,197,186,216,132,100,13,116,124,174,107,3,39,199,14,129,11,128,22,196,8,156,149,27,110,99,3,97,172,36,190,11,137,32,102,46,202,10,210,12,121,36,70,185,179,180,189,85,36,41,60,64,250,98,73,227,28,242,240,197,2,131,114,192,198,1,176,147,221,7,225,221,50,176,93,182,242,190,51,112,137,144,158,80,52,32,99,26,200,43,103,157,188,98,55,222,134,11,166,217,27,30,218,55,80,217,58,97,84,122,205,161,110,63,198,180,0,190,145,236,58,208,29,145,228,13,18,2,7,15,63,229,43,97,235,91,59,226,109,193,31,20,242,8,63,107,202,30,180,17,122,30,40,205,121,140,51,53,16,20,108,194,42,89,198,222,107,170,35,133,233,5,175,116,1,214,27,69,170,50,112,57,193,47,141,85,111,135,137,209,180,104,109,59,252,21,10,80,202,21,123,21,36,62,113,138,132,101,197,97,38,128,16,196,24,36,25,27,156,17,137,49,248,145,142,234,4,34,69,149,129,120,248,164,12,192,53,134,114,192,30,178,130,190,195,223,144,52,2,123,112,36,64,57,41,250,36,10,52,226,65,14,145,141,144,62,127,136,121,137,145,15,18,190,123,220,215,106,12,234,3,41,224,33,135,218,35,201,1,49,28,193,184,219,97,220,48,116,128,30,145,212,156,24,170,93,97,67,80,177,83,94,144,99,44,21,172,75,22,82,140,135,65,2,234,198,139,110,145,128,29,222,36,152,67,251,38,72,192,118,98,24,76,98,48,67,114,2,209,16,124,173,56,129,242,145,212,23,66,173,248,201,106,14,114,128,98,44,62,202,97,5,146,0,50,1,98,22,215,107,208,195,153,50,4,47,90,35,172,166,228,248,17,131,97,20,123,75,179,44,255,142,218,187,94,139,110,189,117,137,242,96,60,41,103,190,118,20,94,93,116,223,88,201,143,5,232,182,0,75,214,168,164,145,145,234,191,183,189,24,179,227,156,170,55,194,218,5,79,15,169,77,16,16,161,52,165,32,9,37,183,241,248,125,68,180,64,103,109,184,239,161,124,40,89,195,143,133,22,134,161,36,112,82,41,63,177,69,24,172,118,216,161,119,251,40,1,160,131,116,72,170,247,80,81,26,219,142,234,146,206,55,183,253,83,139,65,211,165,88,183,68,16,100,149,82,181,212,81,76,136,14,5,65,86,232,47,118,37,5,160,167,232,175,23,212,247,180,16,234,107,21,130,134,162,245,251,91,24,111,136,8,134,225,123,162,229,210,8,135,20,97,135,223,211,132,87,116,11,136,14,143,181,9,194,30,177,81,245,199,158,67,246,10,51,110,79,123,51,53,243,213,58,126,104,238,21,3,202,34,234,3,61,228,173,129,116,204,13,11,8,121,110,14,215,227,147,118,217,95,17,229,121,87,142,82,124,11,141,191,13,192,216,70,224,58,44,65,244,75,208,158,233,82,135,106,1,71,244,48,96,153,233,197,97,46,118,152,87,246,157,144,147,96,177,128,14,130,112,104,11,139,71,106,196,222,216,222,146,66,40,184,158,15,74,146,172,84,161,213,194,162,92,248,169,181,140,193,98,96,177,106,124,67,70,19,93,38,30,10,229,41,146,28,180,198,32,156,181,154,179,188,67,15,26,252,243,176,121,122,124,68,150,227,30,4,199,89,6,206,93,11,120,41,38,144,104,18,238,160,191,249,18,202,172,29,93,228,23,89,100,21,184,201,146,183,21,182,255,227,135,255,23,50,162,88,145,199,161,148,190,140,187,128,193,91,120,4,0,6,229,93,180,109,26,160,190,149,231,132,1,216,133,192,119,35,200,24,134,209,224,44,147,17,100,150,72,193,252,98,133,3,157,156,8,200,185,89,229,50,110,188,144,108,33,249,207,42,151,88,7,43,182,131,115,108,125,68,75,101,144,83,172,148,237,207,138,121,98,14,246,166,6,78,200,2,236,150,153,27,146,160,43,215,104,119,22,54,24,53,108,206,202,254,123,43,155,253,247,86,54,127,227,68,247,217,170,3,255,245,38,0,119,3,116,242,3,154,26,24,137,44,2,33,119,110,33,127,20,175,212,202,64,205,240,2,82,39,66,78,122,161,93,71,249,165,2,28,196,110,130,83,95,148,170,116,89,66,219,10,37,109,197,182,38,149,197,151,145,95,60,242,237,40,74,112,73,6,42,241,164,96,195,172,149,251,194,97,64,103,16,121,50,237,
-13,172,201,180,51,184,44,28,241,13,190,14,156,219,70,19,93,220,179,222,135,222,112,154,174,0,165,37,115,61,171,93,75,85,252,93,253,32,241,231,161,28,27,180,82,242,80,215,83,18,102,95,122,211,143,20,101,255,61,26,90,149,235,217,179,168,148,214,200,154,138,253,229,150,163,204,146,143,44,102,112,238,31,20,222,226,206,203,18,215,129,113,107,125,135,153,131,135,234,19,164,6,38,129,56,37,230,223,235,197,190,146,72,12,66,23,138,96,182,38,36,234,53,99,176,205,58,236,4,234,231,228,66,77,156,167,243,110,71,125,110,24,172,255,121,109,89,42,80,215,139,40,20,138,194,103,219,73,146,21,128,15,57,248,251,48,200,128,137,249,53,46,90,203,34,224,142,29,138,133,24,224,91,75,248,124,158,251,74,44,62,193,44,132,214,61,254,14,60,255,53,173,177,208,218,68,90,7,114,6,41,71,224,24,60,168,165,15,156,167,26,139,31,52,7,2,126,221,129,179,24,196,107,232,189,88,47,196,64,30,238,221,160,223,70,110,2,240,20,216,133,107,4,41,80,232,244,53,199,32,230,37,11,5,228,66,254,26,53,34,116,30,174,46,48,123,129,139,68,136,221,89,2,123,208,235,1,0,182,88,206,42,16,201,91,0,113,183,67,12,11,69,79,148,40,18,239,144,3,147,170,144,162,2,69,148,54,196,210,42,164,68,137,119,47,227,160,112,28,76,156,91,190,178,89,196,110,109,92,145,119,249,154,131,222,240,29,90,186,165,95,158,147,130,29,12,50,147,199,163,89,68,4,162,89,224,207,48,59,46,184,169,157,8,211,206,89,223,98,77,200,161,167,25,39,199,48,207,0,186,97,46,5,72,206,226,135,53,215,201,111,79,143,20,33,69,103,98,245,173,238,148,69,109,236,90,32,34,255,190,58,183,46,103,87,19,107,252,74,122,176,2,16,185,182,45,106,66,196,18,38,150,29,146,182,203,201,35,151,176,217,123,32,231,185,194,207,189,194,214,54,105,17,226,104,155,29,208,49,178,76,180,159,33,68,128,248,33,145,60,59,71,108,201,137,200,228,200,164,251,209,26,116,10,121,98,39,241,45,182,78,240,36,210,235,46,182,100,5,240,98,74,154,48,46,148,10,154,69,108,246,51,65,232,59,100,2,45,166,61,59,11,98,217,244,141,201,130,207,61,235,139,100,128,212,191,208,154,184,101,68,54,173,12,108,76,130,184,100,76,44,150,168,32,1,3,157,225,57,80,215,41,162,216,76,126,48,82,8,240,123,246,139,44,32,163,39,66,196,246,177,149,236,53,99,94,89,198,82,126,254,227,88,235,153,172,237,13,207,173,175,69,188,245,220,239,20,244,36,19,189,54,125,158,17,227,98,181,216,39,104,145,110,132,113,213,148,83,80,74,35,146,96,233,162,35,202,25,43,14,30,31,230,32,232,88,92,169,195,191,245,178,92,148,101,158,145,141,121,62,66,141,38,39,167,227,222,135,15,90,121,101,229,84,98,163,104,168,56,138,229,115,60,61,194,77,68,208,198,106,85,41,234,16,208,99,34,206,13,136,116,52,200,97,32,59,49,39,244,248,1,43,219,57,28,126,63,58,220,125,166,155,115,87,182,255,100,161,79,32,48,63,108,36,44,238,76,174,94,124,178,174,139,122,15,101,24,131,119,105,112,113,39,153,9,20,66,108,230,123,118,167,134,196,221,86,167,30,102,152,154,30,46,74,115,75,150,248,129,188,202,176,10,224,73,86,105,36,196,151,86,150,117,85,116,242,162,188,78,254,141,210,179,26,5,88,220,13,150,201,202,103,206,163,141,157,67,4,126,160,181,115,14,88,59,9,8,89,231,148,54,119,206,211,155,187,189,156,45,49,204,13,198,222,253,136,1,174,248,154,25,223,233,240,206,178,53,160,9,131,24,226,142,49,220,37,59,239,156,118,3,169,52,128,29,130,46,177,232,78,178,249,78,49,57,51,238,157,52,34,190,73,45,241,186,12,67,133,3,225,149,102,233,143,114,32,156,67,14,196,94,190,230,29,138,3,124,213,54,200,49,249,234,101,249,90,202,253,40,193,241,178,10,216,96,250,143,211,192,78,69,13,156,237,133,42,122,162,138,10,46,193,85,211,141,43,203,214,231,119,227,114,92,221,235,90,229,244,111,214,141,219,199,91,237,100,57,143,115,178,132,65,251,76,54,235,31,73,44,217,177,31,43,175,155,71,123,12,123,205,218,230,159,123,12,121,179,182,135,191,165,101,87,51,
-248,135,73,238,166,218,252,99,243,56,193,221,60,74,112,11,216,12,124,190,208,194,122,114,64,152,79,247,51,91,139,206,143,149,232,197,137,18,233,211,82,50,125,210,202,37,156,238,99,57,80,223,146,236,211,202,154,248,16,143,75,11,180,193,227,232,199,9,245,162,140,80,111,105,142,71,200,245,226,159,40,228,79,232,234,30,156,243,46,14,120,195,232,149,252,232,41,239,221,161,41,111,249,89,46,241,226,101,17,190,196,41,162,135,168,189,182,163,232,62,8,221,25,8,205,45,107,226,42,182,248,65,67,253,206,177,255,172,8,254,238,161,72,236,248,185,93,237,159,223,218,32,219,192,202,244,110,118,214,88,6,55,158,111,110,106,101,13,89,22,147,130,36,110,168,93,45,144,215,142,98,121,136,45,91,130,182,148,109,231,183,1,207,6,92,249,121,16,44,139,118,162,41,144,219,187,29,213,151,226,29,44,105,227,118,253,216,26,221,38,177,27,220,251,77,151,47,237,7,192,234,63,236,216,98,167,114,86,163,68,135,123,64,190,119,182,44,165,138,219,79,197,89,7,99,211,33,46,9,201,86,136,125,84,192,184,29,245,243,88,50,182,41,216,172,248,187,245,107,152,179,244,112,151,167,81,226,93,69,146,105,223,63,73,37,146,86,179,145,147,140,125,68,101,153,151,29,14,197,63,107,71,183,193,189,248,125,90,30,40,9,105,203,24,32,246,28,252,253,25,184,107,211,233,150,249,131,62,153,1,195,198,143,193,206,20,234,9,77,103,134,116,162,130,253,137,144,195,208,77,45,177,39,145,246,10,170,157,252,59,122,85,110,137,204,87,33,127,170,69,100,226,72,82,183,211,253,104,169,31,195,49,89,157,110,113,104,119,185,0,99,75,56,178,67,184,177,157,31,172,19,95,199,123,78,11,116,145,82,65,203,50,167,126,210,118,237,222,111,71,144,164,104,226,38,58,205,98,207,95,239,26,191,106,183,109,19,165,39,171,228,183,107,129,124,152,77,84,49,24,13,173,41,116,254,39,107,60,180,250,108,98,145,211,128,95,210,206,167,147,74,114,103,246,254,254,141,88,1,7,50,29,235,242,133,113,9,129,29,39,209,62,168,41,225,109,237,109,84,90,168,191,211,239,233,30,68,206,184,191,241,64,84,105,247,35,225,43,108,144,145,171,160,65,114,237,72,53,99,99,47,147,189,12,135,255,103,6,197,237,166,152,160,10,219,146,193,147,54,230,172,51,101,243,100,177,192,62,2,27,65,135,131,144,104,97,155,230,243,117,81,239,120,98,75,46,203,244,18,110,197,37,239,46,43,183,98,143,91,11,15,188,56,106,120,46,141,8,20,91,6,142,173,78,92,82,201,91,64,34,114,186,94,24,27,231,223,106,153,238,7,215,207,67,115,85,204,69,192,222,190,225,241,14,55,100,101,47,205,9,89,45,231,139,136,237,200,134,55,162,50,27,73,17,56,195,54,158,137,49,210,108,215,13,193,80,24,41,232,150,64,23,52,118,193,108,136,51,107,141,182,174,34,106,236,50,249,28,196,166,35,110,7,105,178,208,158,25,123,117,91,56,246,164,213,47,16,167,134,81,180,33,132,129,251,160,1,18,188,35,96,177,76,192,217,131,129,218,98,30,39,97,10,240,64,37,26,29,220,90,238,71,182,154,198,0,14,225,58,49,50,59,84,14,85,13,109,233,133,174,160,195,121,137,56,126,67,219,147,228,217,169,226,230,80,249,25,150,109,22,131,214,25,118,237,221,116,249,60,185,105,210,191,164,32,181,86,150,91,214,183,206,50,187,243,54,120,18,241,57,150,104,188,216,242,98,91,62,17,231,98,211,179,175,169,133,151,227,79,158,133,149,178,160,76,163,135,251,207,118,24,187,132,23,156,136,251,22,219,202,72,227,113,214,204,4,160,94,147,199,219,50,231,97,33,224,173,232,152,140,145,8,82,117,131,163,78,234,147,172,142,168,215,176,18,113,224,214,180,171,133,71,180,0,44,180,122,70,120,11,182,175,203,1,179,227,156,20,54,81,136,148,222,223,70,23,89,228,14,247,208,78,122,228,224,173,189,9,28,197,184,226,17,178,182,113,255,26,54,96,215,36,65,0,166,124,59,252,93,60,6,183,42,67,68,100,220,229,53,199,193,186,4,13,204,182,75,123,165,141,81,126,217,63,109,207,65,58,229,154,116,144,140,108,213,139,178,40,80,22,221,209,229,53,10,69,0,186,151,56,0,226,14,26,31,109,94,177,206,22,217,138,14,200,
-134,193,61,120,22,90,31,44,150,174,116,52,64,55,192,104,143,128,172,161,30,26,228,219,54,246,13,103,228,231,76,214,183,119,87,190,204,147,217,200,158,31,252,42,79,225,240,215,141,218,33,107,104,24,195,180,229,251,161,206,40,247,139,192,237,94,179,178,111,64,225,223,96,40,138,93,151,111,102,17,222,172,130,215,171,77,123,195,235,204,193,147,243,209,213,89,223,218,242,186,144,66,3,15,163,66,105,112,4,62,140,59,195,41,179,190,90,221,171,169,197,70,67,214,249,240,97,108,125,192,69,81,179,6,77,125,58,98,151,64,183,215,125,119,24,210,100,208,233,247,159,15,83,74,190,10,40,40,96,125,176,198,207,132,73,83,175,2,41,127,24,233,73,17,41,226,85,0,141,173,78,255,153,224,8,210,85,192,136,234,159,9,142,34,110,0,42,129,8,168,60,23,30,34,93,133,61,120,26,233,217,6,253,224,17,96,114,7,212,158,28,145,164,95,166,199,214,193,227,117,227,186,20,42,172,161,138,110,84,136,30,165,26,203,67,170,164,26,21,166,199,104,198,242,144,170,104,70,133,232,17,138,177,60,160,10,138,81,225,169,172,23,203,163,41,173,23,21,150,71,168,197,242,104,170,168,69,13,168,170,86,172,0,167,172,86,76,7,252,192,122,182,209,62,168,142,165,186,78,172,6,168,140,78,220,216,225,163,189,69,186,41,204,119,248,126,80,186,134,82,26,49,131,167,170,62,172,8,168,156,62,204,32,170,168,13,43,2,42,165,13,51,120,170,233,194,138,112,202,232,194,12,154,42,154,176,34,150,195,154,48,131,164,154,30,172,136,165,148,30,204,194,169,160,5,171,130,57,168,5,115,67,124,96,61,219,248,30,84,69,82,73,3,62,2,78,89,13,248,72,151,80,33,90,31,134,84,218,37,52,225,60,86,255,149,196,83,94,255,61,210,25,172,136,167,180,250,123,156,39,88,17,77,89,237,247,24,55,176,34,148,114,202,239,113,62,96,69,40,165,117,223,99,28,192,170,88,74,169,190,199,120,127,149,7,246,160,34,144,71,41,190,10,104,202,40,62,186,52,210,47,214,123,50,97,23,34,81,116,63,28,73,190,148,210,51,160,108,235,60,149,242,4,96,202,105,60,3,205,150,194,147,9,79,128,165,148,182,51,160,228,149,157,136,63,1,144,50,138,206,192,113,110,117,123,131,140,170,19,9,79,128,68,147,46,9,37,171,114,49,246,4,32,14,43,91,147,25,149,116,109,21,86,148,209,179,38,144,172,154,133,216,83,128,56,168,96,51,58,196,212,175,24,123,18,237,49,168,134,32,167,88,119,222,179,245,72,44,101,244,234,183,196,198,107,91,185,169,89,91,236,219,150,172,28,208,177,138,204,126,108,186,50,93,81,129,228,236,135,168,148,98,17,198,67,186,183,34,200,180,170,202,40,165,186,44,2,121,64,39,87,196,168,43,170,12,81,237,237,218,70,184,95,87,87,4,168,170,169,140,79,170,215,34,128,7,116,120,69,132,186,162,202,16,81,249,22,225,219,167,219,43,130,19,85,84,103,30,21,40,228,221,94,157,95,149,117,178,154,34,253,127,8,33,16,42,196,183,199,24,84,69,71,85,84,230,29,106,206,98,13,56,176,158,76,253,13,30,139,140,116,250,46,120,123,141,199,35,48,202,202,74,153,119,39,8,195,38,63,73,109,8,63,173,236,169,35,141,253,240,168,22,93,69,41,119,93,1,75,213,57,32,171,238,184,151,196,150,214,82,206,125,87,232,180,34,7,112,85,253,248,146,208,116,21,165,156,121,5,76,41,112,192,85,205,169,47,137,74,209,47,227,216,43,76,66,43,2,162,242,62,117,73,52,130,242,97,175,90,33,81,26,16,176,84,211,180,37,241,236,211,176,47,59,140,10,182,180,53,157,224,136,117,194,191,57,62,79,199,198,222,223,119,124,199,38,114,247,151,230,70,111,236,206,30,141,99,197,39,137,160,72,68,183,2,238,222,140,6,89,94,110,84,61,120,222,8,55,7,191,193,141,153,120,235,1,110,199,67,158,15,206,207,38,184,243,14,1,134,116,45,186,120,140,194,214,137,184,155,60,18,39,31,168,73,54,190,33,225,120,11,207,193,83,7,97,60,135,94,86,125,45,239,221,83,69,139,246,181,170,111,109,194,211,204,63,229,169,63,203,7,16,222,237,165,16,172,119,19,216,181,177,54,205,192,99,221,128,230,92,30,160,216,77,206,200,253,110,75,182,117,182,27,30,
-47,189,149,135,13,203,237,172,223,69,88,149,40,104,105,166,118,65,22,254,85,4,247,65,149,20,95,70,66,209,72,80,118,197,117,61,243,58,89,146,251,6,104,169,134,146,99,60,160,1,120,233,180,231,74,52,131,142,232,57,116,12,148,246,235,202,115,224,226,44,54,106,184,59,254,128,103,121,35,214,172,51,248,79,70,217,231,206,184,251,177,51,110,254,124,124,196,134,163,41,27,94,245,251,236,114,12,115,160,241,53,251,100,93,227,62,248,222,112,98,141,167,232,40,140,114,164,100,232,8,200,244,175,172,73,189,249,170,115,126,254,234,168,197,48,48,232,13,101,240,98,106,141,101,80,25,52,25,237,247,85,32,205,210,255,210,185,158,200,240,80,81,27,94,203,192,164,171,2,215,131,129,53,29,247,84,124,58,26,232,240,213,116,52,235,13,129,7,3,107,56,133,52,0,118,102,93,140,198,178,218,51,235,131,194,118,6,110,173,10,77,191,88,150,74,38,255,67,135,161,253,189,78,95,69,135,192,27,25,238,143,206,100,232,90,84,211,213,77,234,2,212,206,185,165,35,105,72,210,5,190,43,20,216,5,105,168,211,213,204,232,126,180,186,159,100,80,215,213,29,117,250,214,164,171,8,142,6,131,222,212,12,79,173,115,21,29,78,166,227,142,110,9,196,63,67,79,170,200,229,181,10,141,199,214,228,114,52,60,239,13,63,200,36,18,31,21,30,77,100,127,116,175,32,167,166,38,34,179,243,52,167,76,25,143,250,185,20,156,63,108,167,208,140,34,155,76,215,176,18,39,207,59,18,30,76,201,117,0,231,230,58,210,239,168,14,61,183,46,58,87,253,169,138,244,173,169,254,208,239,1,71,172,241,68,197,149,252,156,143,212,95,244,165,100,120,60,186,20,149,91,157,238,71,145,102,93,128,220,72,202,86,95,245,34,134,122,23,50,12,130,118,125,169,153,110,41,153,133,170,58,151,42,63,240,93,54,199,250,218,181,46,167,58,220,191,82,50,98,125,237,77,166,19,21,6,204,67,213,86,136,161,80,8,104,23,29,141,226,162,63,234,72,74,23,163,126,127,244,69,247,31,96,214,1,171,247,65,138,217,197,120,52,144,161,43,37,166,234,166,8,65,252,131,53,180,198,29,221,150,15,32,115,10,4,57,167,42,56,186,146,140,250,216,249,172,43,253,56,186,146,181,126,188,250,96,245,212,200,235,157,67,199,246,166,178,249,138,107,189,126,239,147,108,134,26,5,226,70,47,25,28,170,33,32,180,143,10,167,1,156,180,164,145,49,158,93,213,81,217,183,189,137,250,59,234,119,210,70,254,123,212,147,161,190,117,33,11,165,104,72,96,100,112,212,85,173,167,96,42,197,58,106,136,48,164,125,34,198,1,225,129,117,222,187,26,104,184,3,107,252,65,150,132,196,43,37,157,131,209,112,250,81,20,24,118,166,87,99,85,217,208,250,162,2,95,37,133,225,168,123,221,85,114,58,28,13,58,95,73,229,234,120,111,152,137,235,82,138,144,238,111,12,169,62,24,94,1,48,82,154,128,96,36,19,71,23,23,19,75,150,31,245,165,32,140,134,234,111,95,246,227,232,82,50,20,195,99,245,247,92,245,201,104,250,81,15,186,209,149,214,103,163,207,106,120,95,118,198,83,173,83,41,146,210,187,28,77,204,216,216,234,90,169,106,130,40,8,196,103,75,197,200,84,233,200,231,94,31,4,99,162,226,35,40,121,165,180,132,152,43,137,234,65,152,85,143,128,170,59,215,161,190,10,129,82,60,159,168,200,133,5,202,169,107,229,226,26,18,216,153,209,84,83,27,118,6,58,124,9,106,180,163,245,11,196,1,64,71,69,64,118,148,96,99,4,122,66,199,240,34,21,51,172,107,254,60,82,114,58,238,125,248,168,242,195,224,63,235,40,67,49,30,125,153,136,70,78,64,54,85,221,147,206,103,235,114,164,37,18,134,203,72,41,42,113,83,139,10,255,117,133,77,85,177,212,238,137,112,239,191,211,230,76,172,201,4,122,73,233,108,74,81,100,122,70,205,114,233,67,198,70,138,59,19,96,198,116,118,169,121,48,153,158,43,77,0,65,16,26,21,30,141,59,170,175,128,75,86,103,160,195,186,7,38,87,103,153,168,225,27,0,31,64,22,37,225,105,79,117,162,92,45,146,17,169,48,64,205,14,39,157,110,42,123,234,26,32,25,161,1,6,4,175,134,103,163,43,208,86,146,129,160,66,179,134,247,106,152,51,10,116,187,174,
-14,254,165,6,234,213,101,106,60,83,46,94,77,68,67,160,34,225,87,137,100,233,170,233,200,181,110,46,93,220,73,249,191,232,150,66,72,201,253,151,143,61,213,23,248,222,135,12,141,198,82,94,190,140,123,83,217,174,175,131,62,120,104,34,25,195,83,104,255,25,140,222,137,78,194,134,106,15,128,226,195,110,39,141,158,143,186,87,153,239,32,90,153,56,218,163,73,26,197,177,50,185,236,116,141,26,64,32,148,125,195,88,79,7,233,42,7,29,147,183,147,171,232,84,107,74,136,0,215,122,130,177,224,189,146,107,89,228,8,131,176,226,218,206,57,67,165,134,107,212,91,62,179,184,242,17,143,194,43,183,57,77,193,187,155,152,94,214,43,244,157,91,249,34,52,29,82,30,247,233,47,134,199,45,132,66,30,58,253,140,87,10,224,97,186,59,238,203,131,105,223,150,111,60,223,89,38,46,127,131,247,9,200,235,24,218,183,140,69,28,175,53,72,86,70,61,209,159,242,120,255,123,118,220,18,199,222,222,179,147,22,91,241,240,134,207,212,167,183,120,5,3,204,56,86,16,254,25,79,245,175,130,152,46,98,197,240,26,102,87,182,206,250,43,61,36,49,132,239,127,138,251,14,34,118,2,148,79,128,230,233,49,205,70,222,30,211,145,242,232,193,135,41,9,76,68,232,233,86,241,210,68,226,192,92,171,69,56,211,215,163,104,94,211,102,231,1,77,202,240,73,224,27,46,102,51,54,189,21,250,144,190,139,49,127,96,163,243,179,46,158,77,166,171,140,163,38,132,102,192,246,25,117,212,108,122,125,105,77,196,85,223,255,198,124,43,152,16,7,208,189,48,127,165,252,83,228,72,83,100,80,105,120,114,47,63,171,201,116,118,166,159,91,249,62,212,243,29,198,154,192,135,87,169,138,7,142,168,209,200,154,192,97,97,249,89,154,1,56,45,149,152,145,8,44,151,54,196,72,252,149,18,201,96,232,84,90,47,217,197,99,245,10,114,48,255,91,188,132,140,47,124,52,97,54,9,159,78,142,233,65,77,104,166,188,203,185,45,175,239,194,203,43,232,221,41,243,155,36,132,207,182,134,9,63,106,99,59,177,195,65,175,78,166,150,137,28,69,64,165,42,45,180,23,35,208,93,7,33,62,87,150,135,8,146,20,132,40,72,187,129,138,203,204,232,9,103,95,9,34,206,241,53,77,186,185,32,88,173,188,120,38,110,58,16,216,79,17,187,240,101,25,32,189,4,131,2,35,84,51,21,114,188,197,28,228,212,109,103,40,208,33,166,172,28,86,35,233,133,109,25,93,146,75,46,173,80,242,229,50,90,229,228,201,180,202,159,236,127,137,119,172,153,80,181,179,115,240,102,192,230,13,187,215,168,76,196,224,51,210,78,91,172,221,110,195,7,24,143,153,188,191,180,183,198,218,54,71,182,153,209,42,108,168,57,244,72,246,82,51,112,154,25,137,56,248,186,163,254,213,96,168,199,29,222,57,167,134,155,30,164,56,204,180,233,253,13,34,198,132,136,53,127,71,154,218,7,192,74,255,128,148,209,23,53,59,161,81,145,206,91,104,56,92,168,122,78,16,81,198,161,58,65,84,89,175,244,4,145,157,1,199,96,238,121,41,221,133,19,68,136,124,44,20,190,45,230,29,150,64,181,30,152,145,191,76,98,105,233,203,150,202,200,222,219,227,167,151,189,11,186,236,18,5,238,98,134,140,67,49,187,152,225,50,18,26,48,248,218,235,79,209,124,93,204,196,3,6,191,208,103,152,57,95,79,123,93,246,43,198,96,146,12,211,18,246,219,182,24,230,217,146,231,72,171,160,181,91,2,8,58,206,14,117,70,45,137,151,106,181,84,75,99,71,255,94,148,201,140,253,127,225,45,241,53,165,76,58,202,192,69,122,172,29,215,108,81,243,201,91,170,164,52,162,244,118,124,123,249,128,139,127,153,226,40,202,253,192,118,51,100,11,164,41,199,131,10,178,180,4,163,157,216,55,90,158,84,188,180,40,233,2,89,191,232,57,164,8,100,104,214,135,41,223,12,17,193,152,77,19,0,38,73,151,78,192,59,80,78,205,4,33,105,58,122,121,77,98,101,16,184,196,180,223,178,121,78,217,239,219,153,78,217,31,217,92,111,201,143,202,103,131,212,147,61,194,106,240,221,96,121,43,203,206,188,139,210,243,229,146,124,87,251,41,106,41,141,180,212,95,125,45,167,99,173,23,47,31,192,149,74,197,73,68,217,192,198,151,194,180,122,20,169,167,
-20,255,35,141,155,217,72,75,138,244,183,169,158,148,9,58,227,62,225,76,219,124,88,64,193,193,207,232,57,21,47,45,151,186,192,51,89,86,134,196,241,42,52,242,219,85,109,127,178,53,4,91,44,161,127,23,240,111,187,104,229,93,53,205,104,85,43,139,56,223,245,151,161,183,66,231,232,19,127,208,125,127,229,123,223,192,161,82,73,40,2,23,242,34,89,74,43,158,55,149,214,17,244,48,64,166,19,210,148,210,221,96,20,121,174,137,83,166,35,60,247,187,236,8,188,50,21,96,126,111,209,139,124,34,20,172,101,146,31,136,191,248,10,31,62,162,39,63,227,131,137,28,111,244,253,190,221,109,25,118,100,56,209,202,183,50,223,121,31,1,138,238,181,127,3,26,221,95,35,172,145,173,241,129,243,112,131,150,225,86,101,197,65,60,12,94,19,101,109,98,122,2,174,54,45,35,1,184,176,171,77,188,135,59,27,232,110,188,37,7,197,227,4,174,238,240,108,170,232,244,253,253,157,43,241,236,174,5,174,22,206,228,45,197,192,93,138,138,5,25,212,255,20,149,29,249,179,140,138,95,22,80,179,83,84,109,212,56,249,85,38,136,253,27,111,79,183,4,96,139,69,91,220,105,21,53,127,203,215,72,23,234,80,2,140,213,35,234,225,116,161,252,119,186,102,89,255,12,130,0,95,73,180,66,66,176,184,90,208,7,234,248,150,52,190,29,141,147,110,152,63,205,233,126,79,13,40,98,160,161,113,65,0,87,3,2,31,102,116,248,211,172,188,231,157,102,92,244,88,1,205,163,52,202,150,129,238,151,52,213,0,249,171,198,108,230,253,45,159,55,253,168,220,111,249,217,108,224,177,102,71,38,249,36,15,39,243,245,52,5,160,147,137,213,111,183,48,152,197,126,206,227,206,124,253,101,7,126,157,169,96,188,229,197,99,107,204,189,252,92,94,240,115,121,39,1,255,33,100,131,246,39,30,70,248,224,186,226,82,228,132,222,58,102,55,222,134,211,98,18,115,65,3,204,237,8,127,90,95,121,62,54,201,142,161,164,231,71,4,1,144,99,46,241,62,58,53,78,61,160,170,88,178,134,26,60,172,35,54,229,30,191,172,236,239,222,10,140,199,122,105,63,220,132,65,2,201,184,106,133,84,104,89,69,190,230,74,35,203,195,43,154,221,4,166,5,44,89,7,84,233,138,86,214,206,30,196,18,24,106,113,113,177,28,221,181,184,130,110,94,210,221,88,114,61,207,245,66,232,233,229,131,120,63,54,69,185,8,66,36,243,192,73,10,230,120,139,163,141,75,42,170,221,17,117,210,28,47,188,195,203,143,185,219,214,151,136,234,71,225,169,198,108,203,161,12,255,142,247,254,2,44,205,66,65,137,238,198,155,103,47,2,22,24,215,212,68,44,146,110,176,18,196,155,71,88,170,23,227,242,34,90,45,92,251,137,77,8,242,54,61,123,177,176,189,48,194,231,126,120,91,35,3,58,248,184,45,85,188,72,223,71,193,157,16,198,13,248,146,221,45,250,176,14,162,200,163,199,207,244,2,17,93,134,174,95,216,21,175,241,202,109,94,17,187,231,100,70,112,39,145,189,90,99,185,128,185,28,7,20,154,11,128,234,133,204,222,112,130,179,228,254,77,124,187,227,238,245,134,4,221,200,95,141,6,182,177,214,16,155,56,204,251,207,232,155,153,32,154,151,201,2,198,216,140,163,108,24,241,252,197,171,68,35,241,211,155,210,235,53,164,112,239,185,241,173,188,136,77,178,208,251,15,79,243,220,114,123,157,75,1,134,129,252,232,248,154,56,136,183,147,114,219,167,187,219,164,27,100,212,20,5,116,219,99,154,41,228,155,173,180,70,66,46,104,195,72,18,143,78,187,223,37,165,194,139,224,52,107,11,238,117,211,223,138,111,118,51,122,69,184,14,33,249,1,43,18,196,5,202,129,120,227,84,61,12,35,132,8,133,101,227,185,40,161,202,206,237,239,114,22,101,174,96,126,233,255,231,238,255,50,253,0,125,250,210,43,255,195,123,165,197,156,151,62,250,49,125,132,198,63,103,219,182,76,191,29,206,189,152,140,166,178,253,45,180,144,11,48,205,248,152,232,134,124,0,178,144,52,155,242,240,57,121,234,31,124,184,98,185,12,238,133,103,96,75,31,72,48,89,249,83,33,94,172,27,123,226,247,27,110,59,183,82,185,146,77,238,104,163,79,30,16,51,93,32,212,211,228,34,33,175,193,141,0,202,68,216,163,199,236,239,209,55,
-129,170,255,84,82,40,10,201,59,98,179,62,213,147,9,148,22,143,134,186,226,52,43,64,181,26,222,209,45,175,59,118,153,159,172,230,48,113,71,78,36,224,100,68,144,223,37,39,203,49,138,64,137,44,215,84,22,163,184,116,91,160,60,120,179,43,3,1,150,86,126,138,144,219,52,55,254,198,230,44,131,57,148,2,243,199,67,142,183,146,104,73,194,146,244,163,171,29,101,220,42,157,21,121,70,242,152,45,227,1,125,116,62,197,131,205,116,221,184,207,57,185,102,82,0,248,247,210,194,220,80,210,172,216,65,237,241,213,18,11,222,0,45,41,130,29,71,25,68,159,95,116,180,114,115,221,191,97,246,128,191,54,226,93,182,11,114,4,200,211,244,99,207,241,214,212,13,32,180,48,58,180,91,139,242,164,157,98,83,236,36,73,68,180,193,98,244,198,25,228,113,146,48,196,249,128,166,144,68,120,121,237,174,251,137,13,217,195,77,216,245,57,135,150,213,107,144,192,99,110,60,59,147,151,82,24,172,53,152,167,192,96,17,87,243,22,102,2,197,33,188,157,175,109,37,210,45,12,11,97,166,160,20,99,145,140,2,140,33,45,185,24,33,161,109,225,226,120,230,195,194,94,226,200,255,218,22,93,135,33,221,143,68,77,118,32,134,181,26,42,242,185,216,87,108,75,178,118,105,67,254,174,102,196,169,172,225,43,198,97,2,34,39,95,141,12,124,24,14,77,249,71,183,83,54,242,136,46,232,167,54,30,209,147,156,245,90,77,61,184,40,74,168,191,141,197,157,44,43,159,1,197,55,1,238,4,21,153,114,68,73,32,248,64,81,165,177,35,160,136,27,40,107,180,21,187,221,192,199,170,26,172,51,193,165,43,145,187,129,239,26,212,212,119,249,10,41,101,73,169,101,178,8,63,83,16,209,24,50,57,164,75,170,136,72,224,144,131,182,247,48,102,66,247,92,124,209,84,66,145,196,103,144,136,244,240,117,49,253,197,204,40,90,152,205,165,217,163,51,170,42,196,151,66,162,248,78,87,131,253,151,124,104,182,68,63,27,90,239,61,83,42,19,71,122,132,55,125,211,173,244,42,135,18,1,169,122,223,179,87,242,221,177,87,168,206,68,234,251,87,168,214,94,189,171,115,223,77,223,200,144,22,34,125,191,96,123,110,239,4,56,215,139,211,85,2,44,171,77,163,156,162,174,232,5,12,161,135,239,162,53,62,204,130,10,78,170,56,99,121,64,61,147,64,42,75,44,17,36,107,248,62,167,165,1,90,18,192,150,233,169,169,120,114,87,108,143,0,117,33,22,10,132,18,113,219,170,21,10,123,200,191,37,94,72,51,22,170,215,84,209,184,82,29,145,25,92,47,189,24,17,131,182,23,106,111,109,135,66,239,225,177,165,98,7,45,117,105,154,190,225,144,121,250,213,38,87,223,173,174,220,50,233,106,72,69,230,32,227,106,212,62,36,0,93,36,21,250,43,132,160,126,192,100,222,187,108,38,209,137,102,142,211,159,242,121,162,21,112,12,151,174,179,249,96,106,151,207,185,149,233,231,130,76,2,119,54,223,239,5,249,110,147,27,190,149,241,228,215,130,156,250,5,131,61,68,85,94,45,184,152,19,6,145,224,155,200,3,225,184,73,182,87,242,154,253,235,95,64,37,207,191,61,153,1,94,17,143,246,148,120,123,90,200,176,26,7,173,159,111,72,141,227,98,175,141,247,249,23,126,79,63,139,49,88,36,104,202,79,110,198,235,34,49,187,103,123,100,12,188,12,134,197,254,245,95,6,31,105,148,201,68,210,0,224,175,11,214,74,116,199,18,153,183,120,167,30,135,97,39,199,167,63,31,179,255,13,21,255,196,238,247,194,5,159,157,224,206,181,131,162,209,238,130,153,234,48,63,240,95,163,122,161,177,143,246,66,180,97,174,45,91,22,169,201,71,19,237,241,62,132,106,22,129,32,83,62,250,5,243,168,45,102,230,6,42,0,1,157,162,101,154,30,161,203,38,234,145,152,73,221,74,144,35,44,147,166,70,83,38,209,229,14,56,197,203,92,34,52,49,143,69,141,175,76,50,48,35,95,52,72,112,107,68,158,175,36,248,212,215,199,237,147,83,99,0,104,94,179,146,204,54,77,217,243,173,237,229,231,159,143,155,111,62,227,252,82,187,175,146,103,210,251,236,25,222,103,47,245,62,123,134,247,217,211,222,39,165,98,59,51,13,108,154,25,164,71,10,73,218,85,56,50,154,158,201,155,102,161,88,58,35,58,146,
-172,81,37,210,89,143,129,1,51,153,3,41,5,167,234,192,28,61,237,3,247,76,31,184,103,248,192,61,237,3,215,107,187,157,122,214,203,9,89,250,40,165,145,117,199,195,148,25,17,124,39,231,203,201,138,126,226,151,46,141,156,245,22,120,13,30,185,8,246,198,246,150,148,199,78,159,189,67,12,218,227,176,147,239,222,210,67,146,162,111,192,33,242,131,88,122,67,234,55,15,225,7,121,226,5,33,212,117,82,148,212,58,41,254,6,18,36,75,151,166,100,201,13,2,80,63,35,217,98,37,190,25,210,174,97,47,78,104,162,123,180,197,15,225,33,27,77,174,167,76,201,79,1,90,128,171,73,221,118,132,237,74,197,11,184,211,76,69,140,62,166,81,249,93,9,21,125,85,17,245,141,70,150,248,66,65,153,158,142,48,81,161,142,170,58,113,90,40,54,215,10,198,188,23,179,41,97,113,81,219,139,135,213,200,150,30,51,144,8,162,163,121,95,223,209,233,12,127,104,90,227,226,74,158,5,47,39,107,127,244,79,133,114,99,178,106,59,173,214,108,120,72,67,34,61,189,107,82,110,23,237,161,72,95,216,108,106,19,129,211,44,117,166,186,192,76,232,21,73,249,157,44,100,230,53,173,134,248,25,203,208,255,91,166,37,213,245,58,197,247,150,166,201,0,46,108,232,215,57,89,45,12,178,76,252,176,73,217,249,130,174,141,27,23,65,219,66,21,64,149,201,215,97,51,152,139,22,50,101,177,127,64,181,133,43,149,218,63,122,238,26,90,44,158,47,255,191,212,134,47,55,150,171,249,69,107,20,104,13,218,234,34,207,66,164,47,192,39,120,35,18,96,191,223,90,99,134,124,105,182,116,51,177,231,30,213,107,208,220,166,180,91,158,155,123,84,254,72,180,28,21,196,59,121,155,136,204,42,220,206,12,221,220,125,34,38,70,169,111,82,128,114,17,70,158,164,160,37,90,153,85,76,64,182,73,200,245,166,109,26,234,195,14,26,120,61,13,181,13,149,5,52,240,226,147,186,171,192,115,163,150,90,28,94,209,217,14,149,142,204,63,102,77,148,8,243,118,131,163,186,220,132,69,246,159,246,160,225,127,184,39,70,47,63,65,221,234,125,121,172,108,60,26,8,45,42,65,138,197,49,18,115,156,181,60,68,175,142,100,154,73,225,152,225,2,86,154,130,251,203,122,67,147,112,106,127,5,97,208,100,6,182,180,79,254,135,96,195,142,88,225,6,134,8,117,7,90,160,27,30,71,242,64,12,119,235,226,144,34,228,251,127,233,193,227,187,
+{120,218,237,125,107,115,219,184,146,232,103,233,87,160,116,63,68,158,171,40,182,51,175,51,57,217,42,89,166,19,157,232,225,145,228,36,222,173,123,85,20,9,217,28,75,164,194,135,28,159,95,191,221,141,7,65,138,146,72,143,157,221,15,158,170,137,1,176,209,104,52,250,5,8,143,215,175,217,244,214,139,216,36,72,66,135,179,110,224,114,118,17,132,43,6,101,81,50,255,139,59,49,139,3,22,223,114,22,243,112,21,177,96,65,153,65,240,111,111,185,180,217,101,50,95,122,78,253,245,107,214,247,28,238,71,188,197,54,109,118,218,62,110,51,214,91,48,155,57,193,250,65,87,186,236,179,123,59,98,126,16,51,215,139,226,208,155,39,49,119,217,189,23,223,2,128,23,33,158,133,183,4,36,215,65,194,28,219,103,193,60,182,61,248,227,115,102,199,236,54,142,215,127,188,121,179,18,141,183,131,240,230,13,224,124,3,205,189,105,67,93,172,222,133,246,66,239,230,54,102,39,255,248,199,111,236,53,251,87,178,124,96,167,199,199,191,179,238,151,94,139,117,146,155,36,138,69,193,107,248,115,242,27,244,197,231,241,249,25,59,107,127,110,215,235,78,200,237,152,35,25,208,97,182,72,124,39,246,2,159,53,150,222,29,111,52,55,246,146,33,225,254,77,139,173,129,34,149,230,145,35,211,71,140,127,135,154,62,0,250,246,10,200,94,222,240,121,104,183,5,130,119,59,241,123,127,187,1,239,64,11,251,26,120,22,170,15,82,90,191,9,109,63,6,40,238,128,32,192,40,239,32,154,53,21,242,236,223,35,148,205,53,137,224,187,18,184,188,167,68,86,136,235,73,8,202,32,65,153,126,209,208,140,134,118,199,86,103,106,177,139,171,97,119,218,27,13,153,203,111,66,206,163,102,200,220,0,58,203,143,234,99,107,122,53,30,78,100,190,94,19,121,22,254,116,242,251,241,155,181,215,60,122,183,141,37,180,93,207,246,163,166,123,8,139,251,19,98,120,3,168,10,5,88,13,174,164,106,191,64,40,96,217,248,203,192,239,29,120,192,113,25,6,27,15,24,97,179,200,91,173,151,156,241,111,137,7,214,135,3,99,23,65,72,125,185,26,246,190,178,216,91,1,243,157,96,181,178,125,23,107,138,130,99,6,140,74,34,208,66,74,69,15,81,204,87,34,125,204,192,198,185,248,247,62,244,98,30,105,87,176,14,3,135,187,73,200,5,142,230,81,61,107,214,162,111,203,54,125,41,146,135,92,229,151,17,46,229,124,149,94,0,153,179,56,152,185,80,216,140,180,189,134,129,94,25,78,38,228,113,18,130,242,32,84,189,150,29,155,21,114,189,221,48,240,160,219,201,55,131,229,248,29,192,80,255,33,183,179,17,145,223,209,140,129,167,168,25,73,5,194,30,238,13,66,237,239,13,102,138,154,193,242,180,55,152,123,92,111,12,60,7,122,19,197,246,106,93,174,75,4,122,184,95,4,182,171,115,244,49,219,67,42,122,124,55,77,140,141,189,102,221,144,164,114,166,221,144,137,114,21,12,46,148,171,96,140,83,229,22,168,227,229,155,49,249,244,98,202,14,57,171,63,175,172,241,53,251,216,155,76,71,227,107,193,34,206,190,37,60,124,96,64,100,28,192,223,21,119,110,109,223,139,86,216,55,137,224,205,228,207,62,136,238,210,3,119,1,124,183,217,130,223,179,219,32,184,139,218,10,201,42,128,182,193,1,6,97,140,195,133,221,2,70,219,236,102,25,204,49,20,23,110,109,99,135,158,13,161,11,187,191,245,156,91,96,161,31,135,193,146,184,3,24,124,15,40,0,181,192,150,237,37,84,226,81,4,227,28,21,153,225,135,168,77,116,47,131,155,153,99,199,54,252,5,55,168,245,26,27,105,214,107,158,203,2,207,109,213,107,193,189,15,30,86,90,131,122,205,229,11,207,231,166,162,214,107,130,13,26,100,237,173,121,154,107,172,151,182,223,80,249,90,13,8,30,162,198,34,143,58,125,134,95,235,181,21,116,212,243,99,241,57,242,254,157,251,28,172,161,57,44,157,123,55,0,86,147,33,0,84,65,255,239,212,139,188,120,190,143,66,176,45,27,152,39,232,117,144,81,40,210,192,58,232,16,224,34,137,38,38,227,55,226,109,39,134,209,187,73,150,118,136,244,241,16,194,147,136,224,178,67,47,106,69,183,65,178,116,217,28,234,47,185,13,92,106,107,93,66,185,133,114,23,71,23,162,152,4,240,63,160,64,32,
+42,20,17,24,207,40,64,33,135,184,103,206,169,45,208,94,80,4,196,32,73,187,227,124,253,39,53,11,97,16,229,186,216,133,100,13,120,124,174,91,131,32,199,14,129,11,64,45,136,17,4,43,55,220,198,14,130,174,36,190,11,133,32,102,46,202,10,226,12,121,36,180,220,89,218,222,42,146,24,30,160,124,177,36,61,7,24,190,88,96,82,42,108,28,0,59,217,125,16,222,45,3,219,101,43,239,59,131,144,8,241,9,67,3,50,166,9,121,229,172,147,87,236,198,219,112,193,52,123,195,67,251,6,26,91,39,140,106,175,57,180,237,199,88,22,192,55,146,93,7,134,35,146,188,65,68,16,224,225,167,124,35,108,125,107,71,188,45,248,131,66,30,225,103,141,217,131,62,194,200,3,166,57,143,113,166,6,130,130,93,88,37,203,216,123,77,109,164,100,122,193,43,93,129,245,70,145,106,12,66,78,136,75,99,53,218,97,98,116,45,90,219,14,127,133,2,148,114,197,94,5,137,79,156,34,97,89,113,152,9,32,9,66,7,73,198,6,103,132,98,12,113,164,163,6,129,80,81,99,32,30,62,25,3,8,141,161,30,176,135,188,160,239,240,55,36,141,192,30,212,4,168,39,69,159,68,129,52,30,228,16,217,8,229,243,135,152,151,208,124,144,240,221,122,95,171,49,104,15,164,128,135,28,90,143,36,7,132,58,130,115,183,195,184,97,216,0,173,145,212,157,24,154,93,97,71,208,176,19,44,200,49,214,10,214,37,43,41,198,131,146,128,185,241,162,91,68,96,135,55,9,66,232,216,4,17,216,78,12,202,36,148,25,138,19,200,134,16,107,197,9,212,143,164,189,16,102,197,79,86,115,144,3,20,99,241,81,170,21,72,2,200,4,136,89,92,175,193,8,103,234,16,121,209,26,201,106,74,142,31,49,80,163,216,91,154,117,249,119,180,222,245,90,116,235,173,75,212,7,231,73,144,249,214,81,120,117,213,125,186,146,215,5,24,182,0,107,214,168,166,1,72,237,223,219,94,140,224,56,167,234,141,176,117,193,211,67,102,19,4,68,24,77,41,72,194,200,109,60,126,31,17,46,176,89,27,238,123,40,31,74,214,240,99,161,135,97,40,9,156,76,202,79,108,17,6,171,29,126,232,221,62,76,64,208,65,60,36,213,123,176,40,139,109,71,117,137,231,155,219,254,169,197,160,235,82,172,91,34,9,178,74,165,90,234,40,39,68,135,146,32,43,244,23,135,146,18,48,82,244,215,11,234,123,122,8,237,181,10,137,134,170,245,251,91,208,55,164,8,212,240,61,225,114,73,195,161,68,248,225,247,52,225,21,195,2,162,195,99,237,130,112,68,108,52,253,177,231,144,191,66,192,237,105,111,166,101,190,90,199,15,205,189,98,64,32,162,61,176,67,222,26,80,199,220,240,128,0,115,115,184,29,159,172,203,254,134,8,230,93,57,76,241,45,116,254,54,0,103,27,65,232,176,4,209,47,129,123,166,107,29,106,5,2,209,195,4,75,160,151,128,185,56,96,94,217,119,66,78,130,197,2,6,8,210,161,45,60,30,153,17,123,99,123,75,74,161,224,122,62,24,73,242,82,133,94,11,171,114,17,167,214,50,14,139,129,199,170,241,13,57,77,12,153,120,40,140,167,40,114,208,27,131,112,214,106,206,242,14,35,104,136,207,195,230,233,241,17,121,142,123,16,28,103,25,56,119,45,224,165,152,64,162,75,184,131,241,230,75,168,179,118,116,149,95,100,149,85,224,38,75,222,86,180,253,151,31,254,63,0,68,177,162,136,67,25,125,153,119,129,6,111,225,17,1,160,148,119,209,182,107,128,246,86,158,19,6,224,23,2,223,141,0,48,12,163,193,89,6,16,100,150,80,193,252,98,133,138,78,65,4,64,110,86,57,192,141,23,146,47,164,248,89,65,137,117,176,98,63,56,199,222,71,180,84,6,144,98,165,108,63,40,194,196,28,252,77,13,130,144,5,248,45,19,26,138,96,40,215,232,119,22,54,56,53,236,206,202,254,107,11,204,254,107,11,204,223,56,209,125,182,233,192,127,189,9,32,220,0,155,252,128,174,6,52,145,69,32,228,206,45,192,71,241,74,173,12,212,140,40,32,13,34,228,164,23,250,117,148,95,42,64,37,118,19,156,250,162,84,165,203,18,218,87,40,105,43,246,53,169,44,190,104,126,177,230,219,81,148,224,146,12,52,226,73,193,134,89,43,247,69,192,128,193,32,242,100,218,27,88,147,105,103,112,
+89,168,241,13,190,14,156,219,70,19,67,220,179,222,135,222,112,154,174,0,165,53,115,35,171,67,75,85,253,93,253,32,242,231,193,28,27,184,82,244,208,214,83,34,102,95,122,211,143,148,101,255,57,26,90,149,219,217,179,168,148,182,200,154,138,253,229,150,163,204,154,143,172,102,112,238,111,84,222,226,206,203,18,215,1,189,181,190,195,204,193,67,243,9,82,3,147,64,156,18,243,239,245,226,88,73,20,6,161,11,85,16,172,9,133,122,205,24,124,179,78,59,129,250,57,185,208,18,231,241,188,219,209,158,27,6,235,191,223,90,22,11,180,245,34,10,133,162,240,217,118,146,100,5,196,135,28,226,125,80,50,96,98,126,141,139,214,178,136,112,199,14,197,66,12,240,173,37,98,62,207,125,37,22,159,96,22,66,235,30,127,5,158,255,154,214,88,104,109,34,109,3,57,131,152,35,8,12,30,212,210,7,206,83,141,197,15,154,3,1,191,238,32,88,12,226,53,140,94,172,23,98,0,134,123,55,24,183,81,152,0,60,5,118,225,26,65,74,40,12,250,154,99,18,97,201,67,1,186,144,191,70,139,8,131,135,171,11,204,94,224,34,17,210,238,44,129,61,24,245,0,1,182,88,206,42,16,201,91,32,226,110,135,24,22,138,158,168,81,36,222,33,7,38,85,65,69,21,138,48,109,136,165,85,80,137,26,239,94,244,160,80,15,38,206,45,95,217,44,98,183,54,174,200,187,124,205,193,110,248,14,45,221,210,47,207,73,193,14,6,9,228,241,104,22,17,130,104,22,248,51,4,199,5,55,181,19,97,218,57,235,91,172,9,16,122,154,113,114,12,243,12,192,27,230,74,0,229,44,126,88,115,93,252,246,244,72,33,82,120,38,86,223,234,78,89,212,198,161,5,36,242,239,171,115,235,114,118,53,177,198,175,100,4,43,8,162,208,182,69,93,136,88,194,196,178,67,210,118,57,69,228,146,108,246,30,208,121,174,136,115,175,176,183,77,90,132,56,218,102,7,12,140,172,19,237,103,8,33,32,126,72,74,158,157,35,182,228,68,100,114,100,210,253,104,13,58,133,60,177,147,248,22,123,39,120,18,233,117,23,91,178,2,120,49,37,75,24,23,74,5,205,34,54,251,153,32,236,29,50,129,22,211,158,157,5,177,236,250,198,100,193,231,158,245,69,50,64,218,95,232,77,220,50,50,155,86,134,108,44,130,188,100,76,44,150,168,160,0,19,157,225,57,96,215,37,162,218,76,126,48,74,136,224,247,236,23,89,65,102,79,132,136,237,99,43,249,107,198,188,178,140,37,120,254,227,88,235,153,172,237,13,207,173,175,69,188,245,220,239,148,244,36,19,189,54,125,158,17,227,98,181,216,39,112,145,109,4,189,106,202,41,40,149,17,74,240,116,209,17,65,198,138,131,199,135,57,8,54,22,87,234,240,111,189,44,23,101,157,103,100,99,158,143,208,162,201,201,233,184,247,225,131,54,94,89,57,149,180,81,54,84,28,197,250,57,158,30,225,38,34,232,99,181,166,20,118,72,104,157,136,115,10,145,106,131,84,3,57,136,57,161,199,15,216,216,78,117,248,253,232,240,240,153,97,206,93,217,241,147,149,62,129,192,252,48,77,88,220,153,92,189,248,100,93,23,141,30,202,48,38,239,210,228,226,78,50,19,48,132,216,205,247,236,78,169,196,221,214,160,30,102,152,154,30,46,74,115,75,214,248,129,188,202,176,10,200,147,172,210,148,16,95,90,89,214,85,177,201,139,242,54,249,55,42,207,90,20,96,113,55,88,38,43,159,57,143,118,118,14,33,248,129,222,206,57,224,237,36,65,200,58,167,180,187,115,158,222,221,237,229,108,9,53,55,24,123,247,35,20,92,241,53,163,223,169,122,103,217,26,208,132,65,168,184,99,168,187,100,231,157,211,110,32,150,6,176,67,224,37,22,221,73,54,223,41,38,103,244,222,73,51,226,155,180,18,175,203,48,84,4,16,94,105,150,254,168,0,194,57,20,64,236,229,107,62,160,56,192,87,237,131,28,147,175,94,150,175,165,194,143,18,28,47,107,128,13,166,255,56,11,236,84,180,192,217,81,168,98,39,170,152,224,18,92,53,195,184,178,108,125,254,48,46,199,213,189,161,85,206,254,102,195,184,125,188,213,65,150,243,184,32,75,56,180,207,228,179,254,150,196,146,31,251,177,242,186,121,116,196,176,215,173,109,254,126,196,144,119,107,123,248,91,90,118,53,131,127,152,228,110,170,205,63,
+54,143,19,220,205,163,4,183,128,205,192,231,11,45,172,39,7,132,249,116,63,179,181,232,252,88,137,94,156,40,145,62,45,37,211,39,173,92,193,233,62,150,3,246,45,201,62,173,108,137,15,241,184,180,64,27,60,142,126,156,80,47,202,8,245,150,229,120,132,92,47,254,142,65,254,132,161,238,193,57,239,226,64,52,140,81,201,143,158,242,222,29,154,242,150,159,229,18,47,94,22,225,75,156,34,122,136,218,107,59,138,238,131,208,157,129,208,220,178,38,174,98,139,31,52,212,239,28,251,207,138,224,239,30,10,197,142,159,219,213,254,249,173,13,178,13,108,76,239,102,103,141,101,112,227,249,230,166,86,214,144,117,177,40,72,226,134,218,213,2,176,118,20,203,67,108,217,26,180,165,108,27,222,6,122,54,16,202,207,131,96,89,180,19,77,17,185,189,219,81,125,41,222,193,146,118,110,215,143,173,209,109,18,187,193,189,223,116,249,210,126,0,90,253,135,29,91,236,20,100,53,76,116,184,7,228,123,103,207,82,172,184,253,84,156,117,48,54,29,226,146,144,236,133,216,71,5,140,219,209,62,143,37,99,155,130,205,138,191,91,191,134,57,75,15,119,121,26,53,222,85,68,153,142,253,147,52,34,113,53,27,57,201,216,135,84,214,121,217,225,80,252,179,118,116,27,220,139,223,167,229,129,146,144,182,140,1,197,158,131,191,63,3,119,109,58,221,50,127,208,39,51,64,109,252,24,252,76,161,157,208,120,102,136,39,42,216,159,8,16,134,109,106,137,61,137,180,87,80,237,228,223,49,170,114,75,100,190,9,249,83,45,82,38,142,36,117,59,221,143,150,250,49,28,139,213,233,22,135,118,151,11,98,108,73,142,28,16,110,108,231,7,239,196,215,241,158,211,2,93,196,84,208,179,204,169,159,180,95,187,247,219,17,73,82,52,113,19,157,102,177,231,175,119,233,175,218,109,219,68,233,201,26,249,237,86,0,14,193,68,19,131,209,208,154,194,224,127,178,198,67,171,207,38,22,5,13,248,37,29,124,58,169,36,119,102,239,31,223,136,21,112,32,51,176,46,95,24,151,16,216,113,18,237,35,53,69,188,109,189,141,70,11,237,119,250,61,221,131,200,25,247,55,30,136,42,237,126,36,250,10,59,100,64,21,116,72,174,29,169,110,108,236,101,178,151,225,240,255,204,192,184,221,21,147,168,194,190,100,232,73,59,115,214,153,178,121,178,88,224,24,129,143,160,195,65,136,180,176,79,243,249,186,104,116,60,177,37,151,101,70,9,183,226,82,116,151,149,91,177,199,173,133,7,94,28,165,158,75,35,3,213,150,129,99,171,19,151,84,243,22,40,17,144,174,23,198,198,249,183,90,102,248,33,244,243,208,93,21,115,17,104,111,223,240,120,71,24,178,178,151,230,132,172,150,139,69,196,118,100,35,26,81,192,70,81,4,193,176,141,103,98,140,50,219,117,67,112,20,70,9,134,37,48,4,141,93,100,54,196,153,181,70,91,55,17,53,118,185,124,14,98,211,17,183,131,52,89,104,207,140,189,186,45,212,61,233,245,11,196,169,97,84,109,8,97,224,62,88,128,4,239,8,88,44,19,8,246,64,81,91,204,227,36,76,1,30,168,68,167,131,91,203,253,200,86,211,24,160,67,132,78,140,220,14,213,67,83,67,91,122,97,40,232,112,94,34,142,223,208,246,36,121,118,170,184,59,84,127,134,117,155,197,68,107,128,93,123,55,93,62,79,110,154,244,47,25,72,109,149,229,150,245,173,179,204,238,188,13,145,68,124,142,53,26,47,190,188,216,151,79,196,185,216,244,236,107,234,225,165,254,201,179,176,82,22,148,107,244,112,255,217,14,103,151,240,130,19,113,223,98,91,57,105,60,206,154,153,0,212,107,242,120,91,230,60,44,36,188,21,29,147,49,10,65,170,110,80,235,164,61,201,218,136,122,13,27,17,7,110,77,191,90,120,68,11,136,133,94,207,136,222,130,237,235,82,97,118,156,147,194,46,10,145,210,251,219,232,34,139,220,225,30,218,73,143,28,188,181,55,129,163,24,87,172,33,107,27,247,175,97,7,118,77,18,4,193,4,183,35,222,197,99,112,171,50,72,4,224,174,168,57,14,214,37,112,32,216,46,235,149,118,70,197,101,127,183,63,7,241,148,235,210,65,52,178,87,47,198,162,192,88,116,71,151,215,40,20,1,216,94,226,0,136,59,88,124,244,121,197,54,91,128,21,29,144,13,131,123,136,44,180,61,88,
+44,93,25,104,128,109,0,109,143,0,173,97,30,26,20,219,54,246,169,51,242,115,38,219,219,187,43,95,194,100,54,178,231,149,95,193,20,170,191,238,212,14,89,67,199,24,166,61,223,79,234,140,160,95,4,110,247,154,149,125,3,6,255,6,83,81,236,186,124,51,139,240,102,21,188,94,109,218,27,94,103,14,158,156,143,174,206,250,214,86,212,133,24,26,120,24,21,106,67,32,240,97,220,25,78,153,245,213,234,94,77,45,54,26,178,206,135,15,99,235,3,46,138,154,45,104,236,211,17,187,4,188,189,238,187,195,36,77,6,157,126,255,249,104,74,209,87,33,10,42,88,31,172,241,51,209,164,177,87,33,41,127,24,233,73,41,82,200,171,16,52,182,58,253,103,34,71,160,174,66,140,104,254,153,200,81,200,13,130,74,80,4,88,158,139,30,66,93,133,61,120,26,233,217,148,126,240,8,98,114,7,212,158,156,34,137,191,204,136,173,131,199,219,198,117,41,170,176,133,42,182,81,81,244,40,211,88,158,164,74,166,81,209,244,24,203,88,158,164,42,150,81,81,244,8,195,88,158,160,10,134,81,209,83,217,46,150,167,166,180,93,84,180,60,194,44,150,167,166,138,89,212,4,85,181,138,21,200,41,107,21,83,133,31,88,207,166,237,131,234,180,84,183,137,213,8,42,99,19,55,118,248,232,104,145,110,10,243,29,190,159,40,221,66,41,139,152,161,167,170,61,172,72,80,57,123,152,161,168,162,53,172,72,80,41,107,152,161,167,154,45,172,72,78,25,91,152,161,166,138,37,172,72,203,97,75,152,161,164,154,29,172,72,75,41,59,152,37,167,130,21,172,74,204,65,43,152,83,241,129,245,108,250,61,168,74,73,37,11,248,8,114,202,90,192,71,134,132,138,162,245,97,146,74,135,132,38,57,143,181,127,37,233,41,111,255,30,25,12,86,164,167,180,249,123,92,36,88,145,154,178,214,239,49,97,96,69,82,202,25,191,199,197,128,21,73,41,109,251,30,19,0,86,165,165,148,233,123,76,244,87,89,177,7,21,9,121,148,225,171,64,77,25,195,71,151,70,250,197,118,79,22,236,162,72,84,221,79,142,68,95,202,232,25,164,108,219,60,85,242,4,196,148,179,120,6,53,91,6,79,22,60,1,45,165,172,157,65,74,222,216,137,252,19,16,82,198,208,25,116,156,91,221,222,32,99,234,68,193,19,80,162,81,151,36,37,107,114,49,247,4,68,28,54,182,38,51,42,217,218,42,172,40,99,103,77,66,178,102,22,114,79,65,196,65,3,155,177,33,166,125,197,220,147,88,143,65,53,10,114,134,117,231,61,91,143,164,165,140,93,253,150,216,120,109,43,55,45,107,139,125,219,146,149,3,54,86,161,217,79,155,110,76,55,84,32,57,251,73,84,70,177,136,198,67,182,183,34,145,105,83,149,169,148,230,178,136,200,3,54,185,34,141,186,161,202,36,170,189,93,219,20,238,183,213,21,9,84,205,84,166,79,154,215,34,2,15,216,240,138,20,234,134,42,147,136,198,183,136,190,125,182,189,34,113,162,137,234,204,163,10,133,188,219,107,243,171,178,78,54,83,100,255,15,81,8,136,10,233,219,227,12,170,82,71,77,84,230,29,90,206,98,11,56,176,158,204,252,13,30,75,25,217,244,93,228,237,117,30,143,160,81,54,86,202,189,59,65,24,54,249,73,234,67,248,105,229,72,29,113,236,39,143,90,209,77,148,10,215,21,97,169,57,7,202,170,7,238,37,105,75,91,41,23,190,43,234,180,33,7,226,170,198,241,37,73,211,77,148,10,230,21,97,202,128,3,93,213,130,250,146,84,41,252,101,2,123,69,147,176,138,64,81,249,152,186,36,53,2,243,225,168,90,81,162,44,32,208,82,205,210,150,164,103,159,133,125,217,97,84,176,165,173,233,4,71,172,19,254,197,241,121,58,54,246,254,186,227,59,54,145,187,191,52,55,122,99,119,246,104,28,43,62,73,4,85,34,186,21,112,247,102,52,0,121,185,81,245,224,121,35,220,28,252,6,55,102,226,173,7,184,29,15,121,62,56,63,155,224,206,59,36,48,164,107,209,197,99,20,182,46,196,221,228,145,56,249,64,93,178,241,13,9,199,91,120,14,158,58,8,227,57,140,178,26,107,121,239,158,170,90,180,175,85,125,107,19,61,205,252,83,158,250,179,124,0,225,221,94,12,193,122,55,130,93,27,107,83,0,30,235,14,52,231,242,0,197,110,116,6,244,187,45,217,
+214,96,55,60,94,122,43,15,59,150,219,89,191,11,177,170,81,208,211,76,235,2,45,252,171,16,238,35,85,98,124,209,132,34,77,80,126,197,117,61,243,58,89,146,251,6,88,169,134,146,99,60,160,1,244,210,105,207,149,232,6,29,209,115,232,24,40,237,215,149,231,192,197,89,108,180,112,119,252,1,207,242,70,172,89,103,240,159,204,178,207,157,113,247,99,103,220,252,249,248,136,13,71,83,54,188,234,247,217,229,24,230,64,227,107,246,201,186,198,125,240,189,225,196,26,79,49,80,24,229,80,201,212,17,160,233,95,89,147,122,243,85,231,252,252,213,81,139,97,98,208,27,202,228,197,212,26,203,164,114,104,50,219,239,171,68,10,210,255,210,185,158,200,244,80,97,27,94,203,196,164,171,18,215,131,129,53,29,247,84,126,58,26,232,244,213,116,52,235,13,129,7,3,107,56,133,50,32,236,204,186,24,141,101,179,103,214,7,69,219,25,132,181,42,53,253,98,89,170,152,226,15,157,134,254,247,58,125,149,29,2,111,100,186,63,58,147,169,107,209,76,87,119,169,11,164,118,206,45,157,73,83,18,47,240,93,81,129,67,144,166,58,93,205,140,238,71,171,251,73,38,117,91,221,81,167,111,77,186,10,225,104,48,232,77,205,244,212,58,87,217,225,100,58,238,232,158,64,254,51,140,164,202,92,94,171,212,120,108,77,46,71,195,243,222,240,131,44,34,241,81,233,209,68,142,71,247,10,32,53,54,145,153,157,167,144,178,100,60,234,231,74,112,254,176,93,66,51,138,108,49,93,195,74,156,60,239,72,242,96,74,174,19,56,55,215,153,126,71,13,232,185,117,209,185,234,79,85,166,111,77,245,135,126,15,56,98,141,39,42,175,228,231,124,164,254,98,44,37,211,227,209,165,104,220,234,116,63,138,50,235,2,228,70,98,182,250,106,20,49,213,187,144,105,16,180,235,75,205,116,75,201,44,52,213,185,84,240,192,119,217,29,235,107,215,186,156,234,116,255,74,201,136,245,181,55,153,78,84,26,104,30,170,190,66,14,133,66,144,118,209,209,84,92,244,71,29,137,233,98,212,239,143,190,232,241,3,154,117,194,234,125,144,98,118,49,30,13,100,234,74,137,169,186,41,66,32,255,96,13,173,113,71,247,229,3,200,156,34,130,130,83,149,28,93,73,70,125,236,124,214,141,126,28,93,201,86,63,94,125,176,122,74,243,122,231,48,176,189,169,236,190,226,90,175,223,251,36,187,161,180,64,220,232,37,147,67,165,2,194,250,168,116,154,192,73,75,154,25,227,217,85,157,149,99,219,155,168,191,163,126,39,237,228,191,70,61,153,234,91,23,178,82,74,13,9,140,76,142,186,170,247,148,76,165,88,103,13,17,134,178,79,196,56,64,60,176,206,123,87,3,77,238,192,26,127,144,53,161,240,74,73,231,96,52,156,126,20,21,134,157,233,213,88,53,54,180,190,168,196,87,137,97,56,234,94,119,149,156,14,71,131,206,87,50,185,58,223,27,102,242,186,150,66,164,199,27,83,106,12,134,87,64,24,25,77,160,96,36,11,71,23,23,19,75,214,31,245,165,32,140,134,234,111,95,142,227,232,82,50,20,211,99,245,247,92,141,201,104,250,81,43,221,232,74,219,179,209,103,165,222,151,157,241,84,219,84,202,164,248,46,71,19,51,55,182,186,86,106,154,32,11,2,241,217,82,57,114,85,58,243,185,215,7,193,152,168,252,8,106,94,41,43,33,230,74,162,121,16,102,53,34,96,234,206,117,170,175,82,96,20,207,39,42,115,97,129,113,234,90,185,188,38,9,252,204,104,170,177,13,59,3,157,190,4,51,218,209,246,5,242,64,64,71,101,64,118,148,96,99,6,70,66,231,240,34,21,51,173,91,254,60,82,114,58,238,125,248,168,224,65,249,207,58,202,81,140,71,95,38,162,147,19,144,77,213,246,164,243,217,186,28,105,137,4,117,25,41,67,37,110,106,81,233,63,175,176,171,42,151,250,61,145,238,253,103,218,157,137,53,153,192,40,41,155,77,37,10,77,207,104,89,46,125,200,220,72,113,103,2,204,152,206,46,53,15,38,211,115,101,9,32,9,66,163,210,163,113,71,141,21,112,201,234,12,116,90,143,192,228,234,44,147,53,98,3,224,3,200,162,68,60,237,169,65,148,171,69,50,35,13,6,152,217,225,164,211,77,101,79,93,3,36,51,164,96,128,240,106,120,54,186,2,107,37,25,8,38,52,235,120,175,134,57,
+167,64,183,235,234,228,159,74,81,175,46,83,231,153,114,241,106,34,58,2,13,137,184,74,20,203,80,77,103,174,117,119,233,226,78,130,255,162,123,10,41,37,247,95,62,246,212,88,224,123,31,50,53,26,75,121,249,50,238,77,101,191,190,14,250,16,161,137,98,76,79,161,255,103,160,189,19,93,132,29,213,17,0,229,135,221,78,154,61,31,117,175,50,223,65,180,50,121,244,71,147,52,139,186,50,185,236,116,141,22,64,32,148,127,195,92,79,39,233,42,7,157,147,183,147,171,236,84,91,74,200,0,215,122,130,177,16,189,82,104,89,20,8,131,176,226,218,206,57,67,163,134,107,212,91,49,179,184,242,17,143,194,171,176,57,45,193,187,155,152,94,214,43,140,157,91,249,42,52,29,82,17,247,233,47,70,196,45,132,66,30,58,253,140,87,10,224,97,186,59,238,203,131,105,223,150,111,60,223,89,38,46,127,131,247,9,200,235,24,218,183,140,69,28,175,53,72,86,70,59,209,31,242,120,255,123,118,220,18,199,222,222,179,147,22,91,241,240,134,207,212,167,183,120,5,3,204,56,86,144,254,25,79,245,175,130,152,46,98,197,244,26,102,87,182,6,253,149,30,146,24,194,247,63,196,125,7,17,59,1,204,39,128,243,244,152,102,35,111,143,233,72,121,244,224,195,148,4,38,34,244,116,171,120,105,34,113,96,174,213,34,58,211,215,163,104,94,211,102,231,1,77,202,240,73,224,27,46,102,51,54,189,21,250,144,190,139,49,127,96,163,243,179,46,158,77,166,171,140,163,38,164,102,192,246,25,13,212,108,122,125,105,77,196,85,223,255,66,184,21,76,136,3,24,94,152,191,18,252,20,57,210,20,0,170,12,79,238,229,103,53,153,193,206,140,115,43,63,134,122,190,195,88,19,248,240,42,53,241,192,17,165,141,172,9,28,22,158,159,165,0,192,105,105,196,140,66,96,185,244,33,70,225,175,84,72,14,67,151,210,122,201,46,30,171,87,144,131,249,95,226,37,100,124,225,163,9,179,73,248,116,114,76,15,106,66,55,229,93,206,109,121,125,23,94,94,65,239,78,153,223,36,34,124,182,53,76,248,81,27,251,137,3,14,118,117,50,181,76,202,81,4,84,169,178,66,123,105,4,188,235,32,196,231,202,242,36,130,36,5,33,10,210,110,66,197,101,102,244,132,179,175,4,17,231,248,26,39,221,92,16,172,86,94,60,19,55,29,8,218,79,145,118,17,203,50,160,244,18,28,10,104,168,102,42,64,188,69,8,10,234,182,1,10,108,136,41,43,135,205,72,122,97,91,198,150,228,138,75,27,148,124,189,140,85,57,121,50,171,242,7,251,63,226,29,107,38,76,237,236,28,162,25,240,121,195,238,53,26,19,161,124,70,217,105,139,181,219,109,248,0,250,152,129,253,165,189,165,107,219,28,217,102,70,171,176,163,166,234,145,236,165,110,224,52,163,137,168,124,221,81,255,106,48,212,122,135,119,206,41,117,211,74,138,106,166,93,239,111,144,49,38,68,172,249,59,226,212,49,0,54,250,15,40,25,125,81,179,19,210,138,116,222,66,234,112,161,218,57,65,138,50,1,213,9,82,149,141,74,79,144,178,51,224,24,204,61,47,101,184,112,130,20,34,31,11,133,111,139,121,135,37,80,173,7,102,228,47,83,88,90,250,178,181,50,178,247,246,248,233,101,239,130,46,187,68,129,187,152,33,227,80,204,46,102,184,140,132,14,12,190,246,250,83,116,95,23,51,241,128,193,47,244,25,102,206,215,211,94,151,253,138,57,152,36,195,180,132,253,182,45,134,121,182,228,57,210,42,232,237,150,0,130,141,179,67,13,168,37,241,82,173,150,106,105,236,232,223,139,50,192,56,254,23,222,18,95,83,202,148,163,12,92,164,199,218,113,205,22,45,159,188,165,74,74,35,74,111,199,183,151,15,184,248,151,169,142,162,220,15,108,55,131,182,64,154,114,60,168,32,75,75,112,218,137,125,163,229,73,229,75,139,146,174,144,141,139,158,67,138,64,134,102,125,152,242,205,144,34,208,217,180,0,200,36,233,210,5,120,7,202,169,89,32,36,77,103,47,175,73,172,12,4,151,88,246,91,22,230,148,253,190,13,116,202,254,145,133,122,75,113,84,30,12,74,79,246,8,171,193,119,131,229,173,44,59,243,33,74,207,151,75,242,93,29,167,168,165,52,178,82,127,246,181,156,142,181,93,188,124,128,80,42,21,39,145,101,3,27,95,10,211,230,81,
+148,158,82,254,31,105,222,4,35,43,41,202,223,166,118,82,22,104,192,125,194,153,246,249,176,128,66,128,159,177,115,42,95,90,46,117,133,103,242,172,12,145,227,85,104,20,183,171,214,254,96,107,72,182,88,66,255,46,224,223,118,209,202,187,234,154,209,171,86,150,226,252,208,95,134,222,10,131,163,79,252,65,143,253,149,239,125,131,128,74,21,161,8,92,200,139,100,169,172,120,222,84,218,70,208,195,0,153,65,72,75,74,15,131,81,229,185,38,78,153,129,240,220,239,114,32,240,202,84,32,243,123,139,94,228,19,169,96,45,139,252,64,252,197,87,248,240,17,61,249,25,31,76,228,120,163,239,247,237,97,203,176,35,195,137,86,190,151,249,193,251,8,164,232,81,251,23,80,163,199,107,132,45,178,53,62,112,30,110,208,51,220,42,80,84,226,97,240,154,48,107,23,211,19,228,106,215,50,18,4,23,14,181,73,239,225,193,6,188,27,111,201,193,240,56,129,171,7,60,91,42,6,125,255,120,231,106,60,123,104,129,171,133,51,121,75,49,112,151,178,98,65,6,237,63,101,229,64,254,44,179,226,151,5,180,236,148,85,27,53,78,126,149,5,98,255,198,219,211,45,1,216,98,209,22,119,90,69,221,223,138,53,210,133,58,148,0,99,245,136,70,56,93,40,255,157,174,89,214,63,131,32,129,175,36,181,66,66,176,186,90,208,7,236,248,150,52,190,29,141,147,110,152,63,205,233,126,79,77,80,196,192,66,227,130,0,174,6,4,62,204,232,240,167,89,121,207,59,205,184,232,177,2,154,71,105,42,91,6,117,191,164,165,6,145,191,106,154,77,216,223,242,176,233,71,21,126,203,207,102,7,143,53,59,50,197,39,121,114,50,95,79,83,2,116,49,177,250,237,22,13,102,181,159,243,116,103,190,254,178,131,126,13,84,160,111,121,241,216,210,185,151,159,203,11,126,46,239,36,16,63,132,108,208,254,196,195,8,31,92,87,92,138,156,208,91,199,236,198,219,112,90,76,98,46,88,128,185,29,225,79,235,43,207,199,46,217,49,212,244,252,136,72,0,202,17,74,188,143,78,157,83,15,168,42,150,172,161,5,15,219,136,77,185,199,47,43,251,187,183,2,231,177,94,218,15,55,97,144,64,49,174,90,33,22,90,86,145,175,185,146,102,121,120,69,179,155,192,180,128,37,235,128,26,93,209,202,218,217,131,88,2,67,43,46,46,150,163,187,22,87,48,204,75,186,27,75,174,231,185,94,8,35,189,124,16,239,199,166,84,46,130,16,209,60,112,146,130,57,222,226,104,227,146,138,234,119,68,131,52,199,11,239,240,242,99,238,182,245,37,162,250,81,120,106,49,219,115,168,195,191,227,189,191,64,150,102,161,192,68,119,227,205,179,23,1,11,26,215,212,69,172,146,110,176,18,200,155,71,88,171,23,227,242,34,122,45,92,251,137,77,18,228,109,122,246,98,97,123,97,132,207,253,240,182,166,12,240,224,227,182,212,240,34,125,31,5,119,66,24,55,224,75,118,183,232,195,58,136,34,143,30,63,211,11,68,116,25,186,126,97,87,188,198,43,183,121,69,236,158,147,27,193,157,68,246,106,141,245,2,230,114,84,40,116,23,64,170,23,50,123,195,137,156,37,247,111,226,219,29,119,175,55,36,209,141,252,213,104,224,27,107,13,177,137,195,188,255,140,190,153,5,162,123,25,16,112,198,102,30,101,195,200,231,47,94,37,28,137,159,222,148,94,175,33,134,123,207,141,111,229,69,108,146,133,222,191,121,10,115,203,237,117,174,4,24,6,242,163,243,107,226,32,222,78,202,109,159,238,110,147,97,144,209,82,20,208,109,143,41,80,200,55,91,101,141,132,66,208,134,81,36,30,157,118,191,75,76,133,23,193,105,214,22,220,235,166,191,21,223,236,102,140,138,8,29,66,138,3,86,36,136,11,148,3,241,198,169,122,24,70,8,17,10,203,198,115,81,66,149,159,219,63,228,44,202,92,193,252,50,254,207,61,254,101,198,1,198,244,101,84,254,151,143,74,139,57,47,99,244,99,198,72,58,127,245,107,10,4,66,60,140,133,55,77,214,224,234,129,110,8,121,164,193,107,65,36,227,57,183,234,126,91,53,65,160,16,71,93,149,143,184,185,154,9,176,4,15,141,164,63,227,209,239,142,110,155,13,232,111,234,187,233,89,119,155,98,37,50,210,50,12,213,72,33,250,137,109,57,249,128,122,77,156,177,223,184,119,51,42,159,137,95,51,
+195,224,62,130,184,59,88,2,3,16,209,6,35,53,117,195,53,94,218,143,196,163,43,55,111,191,134,144,102,185,196,56,77,134,96,197,23,82,99,227,79,231,192,243,66,165,120,174,11,20,227,117,129,96,155,49,202,186,111,187,134,88,208,92,224,25,21,39,139,220,162,234,104,42,22,244,90,136,248,25,13,130,34,219,67,241,67,255,168,7,26,226,75,231,174,69,34,34,159,76,8,189,24,162,99,20,32,241,24,9,244,149,163,239,100,243,196,185,227,49,77,72,16,19,116,143,47,131,123,118,250,255,125,182,242,156,48,136,184,19,248,238,142,219,166,177,153,25,85,123,228,56,80,99,248,170,188,147,178,85,146,177,91,81,210,86,11,56,153,126,44,230,166,73,178,228,104,46,136,220,138,177,237,112,238,197,20,157,170,32,187,133,161,232,2,98,96,124,181,119,67,154,70,161,40,45,91,96,211,162,231,248,66,204,18,58,40,66,112,91,78,54,132,53,83,19,151,16,111,176,142,61,241,67,41,183,65,141,133,104,82,240,219,209,209,53,77,53,152,57,215,208,3,142,70,13,226,117,192,76,136,113,126,117,27,220,251,98,32,255,80,12,18,149,228,101,204,217,201,203,147,89,110,109,135,27,234,46,225,172,82,213,106,120,25,190,188,87,220,101,126,178,154,131,132,34,39,18,136,230,35,128,119,105,54,227,24,85,160,70,150,107,10,196,168,46,231,7,80,31,166,141,43,131,2,172,173,38,4,194,65,164,208,248,99,182,179,12,230,80,11,226,76,30,114,188,254,71,43,51,214,164,221,13,118,148,153,191,104,80,228,25,25,254,108,29,15,240,227,44,79,188,140,78,247,250,251,92,170,167,45,31,112,45,237,53,26,202,109,40,118,80,127,124,181,150,137,87,173,75,140,32,202,40,131,56,185,22,3,173,230,147,238,95,48,77,199,159,245,241,210,232,5,41,3,77,233,192,1,56,222,154,134,1,132,22,180,75,207,31,81,158,180,165,49,197,78,162,68,138,54,88,141,30,19,4,24,39,9,67,156,120,107,12,73,132,183,68,239,186,8,220,144,61,60,237,80,159,115,232,89,189,6,5,60,230,198,251,78,121,41,5,101,149,54,89,220,129,93,8,4,30,90,104,252,215,182,18,233,22,166,133,48,83,82,138,177,40,70,1,198,148,150,92,204,144,208,182,240,87,168,204,135,133,189,68,205,255,218,22,67,135,41,61,142,132,77,14,32,166,181,191,47,154,220,176,175,216,23,225,78,118,119,35,78,101,13,159,11,15,19,16,57,249,60,107,224,131,58,52,229,31,221,79,217,201,35,122,9,131,250,120,68,111,223,214,107,53,245,178,169,168,161,254,54,22,119,178,174,124,111,23,31,223,184,19,88,100,201,17,21,129,224,3,70,85,198,142,0,35,238,84,174,209,153,135,118,3,95,133,107,176,206,4,215,136,5,116,3,31,16,169,169,239,242,185,95,2,73,177,101,64,196,132,78,32,209,52,100,32,228,220,79,33,145,132,3,4,237,163,99,204,36,221,115,241,233,96,73,138,68,62,131,66,196,135,207,248,233,47,38,160,232,97,22,74,179,71,3,170,38,196,151,66,164,248,32,94,131,253,135,124,209,185,196,56,27,86,239,61,83,38,19,53,61,194,43,245,233,249,7,5,161,68,64,154,222,247,236,149,124,224,239,21,154,51,81,250,254,21,154,181,87,239,234,16,60,26,161,164,240,16,233,67,33,219,139,104,16,81,172,73,9,149,38,99,93,237,26,229,90,208,138,158,154,17,118,248,46,90,227,11,72,104,224,164,137,51,214,225,212,123,36,100,178,196,90,92,178,134,239,115,90,131,163,181,55,236,153,94,3,18,111,91,139,125,72,96,46,68,128,40,140,136,219,86,189,80,180,135,252,91,226,133,180,52,64,237,154,38,26,127,18,138,200,13,66,88,26,35,197,96,237,133,217,91,219,161,176,123,120,62,176,120,38,148,206,29,154,190,49,243,241,244,243,104,174,126,196,64,5,60,50,84,145,134,204,65,198,213,168,127,136,0,134,72,26,244,87,72,130,218,41,192,188,119,89,32,49,136,38,196,233,79,121,152,104,5,28,195,223,136,178,112,16,222,228,33,183,128,126,46,0,18,116,103,225,126,47,128,187,77,110,248,22,224,201,175,5,144,250,169,144,61,72,21,172,22,92,132,4,37,18,124,19,48,144,142,155,228,123,37,175,217,63,255,9,88,242,252,219,3,12,228,21,241,104,79,141,183,167,133,12,171,
+113,176,250,249,142,212,56,254,170,98,227,195,25,133,223,211,207,66,7,139,4,77,77,72,155,241,186,72,204,238,217,30,25,131,40,131,97,181,127,254,135,193,71,210,50,89,72,22,0,38,198,130,181,146,186,99,73,153,183,120,167,94,97,98,39,199,167,63,31,179,255,11,13,255,196,238,247,146,11,147,99,34,119,174,3,20,77,237,46,50,83,27,230,7,254,107,52,47,164,251,232,47,68,31,230,218,179,101,41,53,249,104,82,123,188,143,66,53,93,71,34,83,62,250,5,11,22,91,204,204,41,42,16,2,54,69,203,52,189,246,152,45,212,154,152,41,221,42,144,26,150,41,83,218,148,41,116,185,3,65,241,50,87,8,93,204,211,162,244,43,83,12,204,200,87,13,18,220,131,148,231,43,9,62,141,245,113,251,228,212,80,0,205,107,86,146,217,166,43,123,190,69,244,252,156,252,113,11,59,207,184,144,163,195,87,201,51,25,125,246,140,232,179,151,70,159,61,35,250,236,233,232,147,74,177,159,153,14,54,77,0,25,145,66,145,14,21,142,140,174,103,96,83,16,202,165,51,162,35,201,26,85,35,157,245,24,52,32,144,169,72,41,113,170,13,132,232,233,24,184,103,198,192,61,35,6,238,233,24,184,94,219,29,212,179,94,78,200,210,215,95,13,208,29,47,192,102,68,240,157,156,47,39,43,218,75,35,67,26,57,235,45,136,26,60,10,17,236,141,237,45,9,198,78,223,151,68,26,116,196,97,39,223,189,165,135,40,229,218,153,203,253,32,150,209,144,250,113,81,196,65,158,120,170,11,109,157,20,37,245,131,4,174,196,5,201,210,165,41,89,114,131,4,168,223,107,109,241,147,87,51,164,237,249,94,156,208,68,247,104,139,31,34,66,54,186,92,79,153,146,159,2,180,128,174,38,13,219,17,246,43,21,47,224,78,51,21,49,250,152,102,229,119,37,84,244,85,101,212,55,210,44,241,133,146,178,60,213,48,209,160,206,170,54,113,90,40,118,177,11,198,188,23,179,41,225,113,209,218,139,23,12,201,151,30,51,144,8,194,163,121,95,223,49,232,12,127,209,93,227,226,74,158,5,47,71,216,127,244,111,242,242,4,128,234,59,173,214,108,120,72,42,145,30,147,55,49,183,139,54,43,165,79,217,54,181,139,192,105,150,186,188,160,192,77,232,165,127,249,157,60,100,230,217,186,134,248,189,216,176,255,91,174,37,181,245,186,196,247,150,166,203,0,46,108,232,103,112,217,44,40,89,38,127,216,165,236,124,170,218,198,29,194,96,109,161,9,192,202,228,51,204,25,154,139,22,66,101,181,191,129,181,133,43,149,58,62,122,238,22,90,44,158,47,255,71,90,195,39,82,203,181,252,98,53,10,172,6,237,41,147,135,142,244,219,169,242,87,36,63,184,223,90,99,6,184,20,44,221,181,239,185,71,245,26,116,183,41,253,150,39,87,17,53,236,145,232,57,26,136,119,242,218,30,9,42,194,206,12,222,220,197,61,38,141,210,222,164,4,202,69,24,121,100,137,150,104,37,168,152,128,108,163,144,235,77,219,56,212,135,29,56,240,30,40,234,27,26,11,232,224,197,39,117,41,136,231,70,45,181,56,188,162,67,84,170,28,153,127,204,154,40,17,230,53,34,71,117,185,219,145,252,63,109,246,196,255,112,243,153,94,126,130,182,155,114,117,15,27,27,143,6,194,138,74,34,197,226,24,137,57,206,90,30,162,87,71,178,204,196,112,204,112,1,43,45,193,141,156,189,161,137,56,245,191,2,49,88,50,131,182,116,76,254,151,208,134,3,177,194,157,66,17,218,14,244,64,55,248,27,151,248,201,140,187,117,113,26,24,224,254,27,67,58,19,212,
 0};
 unsigned char* createdb_inline = 0;
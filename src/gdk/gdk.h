@@ -846,7 +846,7 @@ typedef struct {
 	PROPrec *props;		/* list of dynamic properties stored in the bat descriptor */
 } COLrec;
 
-#define ORDERIDXOFF		3
+#define ORDERIDXOFF		4
 
 /* assert that atom width is power of 2, i.e., width == 1<<shift */
 #define assert_shift_width(shift,width) assert(((shift) == 0 && (width) == 0) || ((unsigned)1<<(shift)) == (unsigned)(width))
@@ -1480,6 +1480,28 @@ gdk_export gdk_return GDKcreatedir(const char *nme);
 
 gdk_export void OIDXdestroy(BAT *b);
 
+/*
+ * @- Column files
+ * @multitable @columnfractions 0.08 0.7
+ * @item gdk_return
+ * @tab BATwritecolumn (BAT *b, str filename, int compression)
+ * @item BAT *
+ * @tab BATreadcolumn (int tt, str filename, int role)
+ * @item int
+ * @tab BATiscolumnfile (str filename)
+ * @end multitable
+ *
+ * A column file holds the heaps of a single BAT behind a header that
+ * describes its type, count and layout, so that it can be read back
+ * into a new BAT without any parsing.  The heaps are written as the
+ * blocks of a block_stream2, compressed with the given
+ * compression_method when that is available.  Column files are meant
+ * for exchanging data between databases on the same kind of machine.
+ */
+gdk_export gdk_return BATwritecolumn(BAT *b, const char *filename, int compression);
+gdk_export BAT *BATreadcolumn(int tt, const char *filename, int role);
+gdk_export int BATiscolumnfile(const char *filename);
+
 /*
  * @- Printing
  * @multitable @columnfractions 0.08 0.7
@@ -1930,6 +1952,7 @@ gdk_export lng IMPSimprintsize(BAT *b);
 
 gdk_export gdk_return BATorderidx(BAT *b, int stable);
 gdk_export gdk_return GDKmergeidx(BAT *b, BAT**a, int n_ar);
+gdk_export gdk_return OIDXcopy(BAT *b, oid *restrict mv);
 
 /*
  * @- Multilevel Storage Modes
@@ -2338,6 +2361,8 @@ gdk_export BUN void_replace_bat(BAT *b, BAT *p, BAT *u, bit force)
 gdk_export gdk_return void_inplace(BAT *b, oid id, const void *val, bit force)
 	__attribute__ ((__warn_unused_result__));
 gdk_export BAT *BATattach(int tt, const char *heapfile, int role);
+gdk_export BAT *BATwrap(oid hseq, int tt, void *base, BUN cnt)
+	__attribute__((warn_unused_result));
 
 #ifdef NATIVE_WIN32
 #ifdef _MSC_VER
@@ -2411,6 +2436,8 @@ gdk_export void *THRdata[THREADDATA];
 #define GDKin		((stream*)THRgetdata(1))
 #define GDKerrbuf	((char*)THRgetdata(2))
 #define GDKsetbuf(x)	THRsetdata(2,(ptr)(x))
+#define GDKprogressarg	THRgetdata(3)
+#define GDKsetprogressarg(x)	THRsetdata(3,(ptr)(x))
 #define GDKerr		GDKout
 
 #define THRget_errbuf(t)	((char*)t->data[2])
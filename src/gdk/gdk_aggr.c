@@ -2285,7 +2285,10 @@ BATminmax(BAT *b, void *aggr,
 	int needdecref = 0;
 	BATiter bi;
 
-	if ((VIEWtparent(b) == 0 ||
+	/* string imprints bin on a prefix of the value, so their
+	 * min/max statistics don't identify the extremes */
+	if (ATOMstorage(b->ttype) != TYPE_str &&
+	    (VIEWtparent(b) == 0 ||
 	     BATcount(b) == BATcount(BBPdescriptor(VIEWtparent(b)))) &&
 	    BATcheckimprints(b)) {
 		Imprints *imprints = VIEWtparent(b) ? BBPdescriptor(VIEWtparent(b))->timprints : b->timprints;
@@ -2522,13 +2525,16 @@ BATgroupquantile(BAT *b, BAT *g, BAT *e, BAT *s, int tp, double quantile,
 
 		t1 = NULL;
 
-		if (BATcheckorderidx(b) ||
+		/* an order index with a delta is merged by BATsort */
+		if ((BATcheckorderidx(b) &&
+		     ORDERIDXBASE(b) == BATcount(b)) ||
 		    (VIEWtparent(b) &&
 		     (pb = BBPdescriptor(VIEWtparent(b))) != NULL &&
 		     pb->theap.base == b->theap.base &&
 		     BATcount(pb) == BATcount(b) &&
 		     pb->hseqbase == b->hseqbase &&
-		     BATcheckorderidx(pb))) {
+		     BATcheckorderidx(pb) &&
+		     ORDERIDXBASE(pb) == BATcount(pb))) {
 			ords = (const oid *) (pb ? pb->torderidx->base : b->torderidx->base) + ORDERIDXOFF;
 		} else {
 			if (BATsort(NULL, &t1, NULL, b, NULL, g, 0, 0) != GDK_SUCCEED)
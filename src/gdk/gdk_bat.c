@@ -257,6 +257,42 @@ BATdense(oid hseq, oid tseq, BUN cnt)
 	return bn;
 }
 
+/*
+ * Wrap memory owned by someone else, e.g. a vector of the host
+ * language, in a read-only transient BAT without copying it.  The
+ * owner has to keep the memory alive as long as the BAT exists.
+ */
+BAT *
+BATwrap(oid hseq, int tt, void *base, BUN cnt)
+{
+	BAT *bn;
+
+	ERRORcheck(tt <= 0 || ATOMvarsized(tt), "BATwrap: bad tail type\n", NULL);
+	ERRORcheck(base == NULL, "BATwrap: no memory to wrap\n", NULL);
+
+	bn = BATcreatedesc(hseq, tt, TRUE, TRANSIENT);
+	if (bn == NULL)
+		return NULL;
+	BATsetdims(bn);
+	bn->batCapacity = cnt;
+	bn->theap.base = base;
+	bn->theap.size = (size_t) cnt << bn->tshift;
+	bn->theap.storage = bn->theap.newstorage = STORE_NOWN;
+	DELTAinit(bn);
+	if (BBPcacheit(bn, 1) != GDK_SUCCEED) {
+		BBPclear(bn->batCacheid);
+		GDKfree(bn);
+		return NULL;
+	}
+	BATsetcount(bn, cnt);
+	bn->tnonil = cnt == 0;
+	bn->tnil = 0;
+	bn->tdense = 0;
+	bn->tsorted = bn->trevsorted = bn->tkey = cnt <= 1;
+	bn->batRestricted = BAT_READ;
+	return bn;
+}
+
 BAT *
 BATattach(int tt, const char *heapfile, int role)
 {
@@ -476,8 +512,8 @@ BATextend(BAT *b, BUN newcap)
 	    HEAPextend(&b->theap, theap_size, b->batRestricted == BAT_READ) != GDK_SUCCEED)
 		return GDK_FAIL;
 	HASHdestroy(b);
-	IMPSdestroy(b);
-	OIDXdestroy(b);
+	/* the imprints and order index only depend on the values, so
+	 * they are kept */
 	return GDK_SUCCEED;
 }
 
@@ -1057,8 +1093,8 @@ BUNappend(BAT *b, const void *t, bit force)
 	}
 
 
-	IMPSdestroy(b); /* no support for inserts in imprints yet */
-	OIDXdestroy(b);
+	IMPSappend(b, p);
+	OIDXappend(b, p);
 	if (b->thash == (Hash *) 1) {
 		/* don't bother first loading the hash to then change it */
 		HASHdestroy(b);
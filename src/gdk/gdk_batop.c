@@ -410,7 +410,7 @@ gdk_return
 BATappend(BAT *b, BAT *n, BAT *s, bit force)
 {
 	BUN start, end, cnt;
-	BUN r;
+	BUN r, icnt;
 	const oid *restrict cand = NULL, *candend = NULL;
 
 	if (b == NULL || n == NULL || (cnt = BATcount(n)) == 0) {
@@ -488,8 +488,10 @@ BATappend(BAT *b, BAT *n, BAT *s, bit force)
 			goto bunins_failed;
 	}
 
-	IMPSdestroy(b);		/* imprints do not support updates yet */
-	OIDXdestroy(b);
+	if (b->ttype == TYPE_void) {
+		/* the tail may get materialized below */
+		OIDXdestroy(b);
+	}
 	if (b->thash == (Hash *) 1 || BATcount(b) == 0) {
 		/* don't bother first loading the hash to then change
 		 * it, or updating the hash if we replace the heap */
@@ -528,6 +530,7 @@ BATappend(BAT *b, BAT *n, BAT *s, bit force)
 	}
 
 	r = BUNlast(b);
+	icnt = BATcount(b);
 
 	if (BATcount(b) == 0 && cand == NULL) {
 		BATiter ni = bat_iterator(n);
@@ -632,10 +635,14 @@ BATappend(BAT *b, BAT *n, BAT *s, bit force)
 			}
 		}
 	}
+	IMPSappend(b, icnt);
+	OIDXappend(b, icnt);
 	if (b->tunique)
 		BBPunfix(s->batCacheid);
 	return GDK_SUCCEED;
       bunins_failed:
+	IMPSdestroy(b);
+	OIDXdestroy(b);
 	if (b->tunique)
 		BBPunfix(s->batCacheid);
 	return GDK_FAIL;
@@ -1349,7 +1356,8 @@ BATsort(BAT **sorted, BAT **order, BAT **groups,
 		on = COLnew(pb->hseqbase, TYPE_oid, BATcount(pb), TRANSIENT);
 		if (on == NULL)
 			goto error;
-		memcpy(Tloc(on, 0), (oid *) pb->torderidx->base + ORDERIDXOFF, BATcount(pb) * sizeof(oid));
+		if (OIDXcopy(pb, (oid *) Tloc(on, 0)) != GDK_SUCCEED)
+			goto error;
 		BATsetcount(on, BATcount(b));
 		on->tkey = 1;
 		on->tnil = 0;
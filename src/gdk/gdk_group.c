@@ -491,6 +491,281 @@
 	)
 
 
+/*
+ * Parallel grouping.
+ *
+ * Without an ordering or an existing hash table to go by, grouping
+ * builds one hash table over the whole input on a single core.  For
+ * large inputs of integral values, the rows are instead cut into a
+ * morsel per thread, and each thread groups its morsel using a hash
+ * table of its own.  The local groups are then merged into the
+ * global group id space in morsel order, so that group ids are
+ * handed out in order of first occurrence just like the sequential
+ * code does, after which each thread translates the group ids of its
+ * morsel.  The groups, extents and histo outputs are therefore the
+ * same as those of the sequential code.
+ *
+ * When mitosis has split the plan, its pieces are grouped by
+ * concurrent dataflow workers, and starting threads for each of them
+ * would only oversubscribe the cores.  We therefore only group in
+ * parallel if no other grouping is in progress, which is what
+ * happens when mitosis is disabled or did not split the plan, e.g.
+ * because it contains a groupby.
+ */
+
+#define GRPPARMINCNT	((BUN) 1 << 20)	/* smaller inputs are grouped sequentially */
+#define GRPPARMORSEL	((BUN) 1 << 17)	/* minimum number of rows per thread */
+
+#define GRPPARNIL	(~(BUN) 0)	/* end of a hash chain */
+#define GRPPARHASH(v, g, bits)						\
+	((BUN) ((((ulng) (v) + (ulng) (g) * LL_CONSTANT(0x9E3779B97F4A7C15)) * \
+		 LL_CONSTANT(0x9E3779B97F4A7C15)) >> (64 - (bits))))
+#define GRPPARPOS(gp, r)	((gp)->cand ? (gp)->cand[r] - (gp)->seq : (gp)->start + (r))
+
+#ifdef ATOMIC_LOCK
+static MT_Lock grpLock MT_LOCK_INITIALIZER("grpLock");
+#endif
+static volatile ATOMIC_TYPE grpactive = 0; /* number of BATgroup calls in progress */
+
+typedef struct {
+	const void *vals;	/* values of b */
+	int tpe;		/* type used for comparing values */
+	oid seq;		/* hseqbase of b */
+	BUN start;		/* first position, if no candidates */
+	const oid *cand;	/* candidate list, or NULL */
+	const oid *grps;	/* pre-existing groups, or NULL */
+	oid *ngrps;		/* the output group ids */
+} grppar;
+
+typedef struct {
+	const grppar *gp;
+	BUN lo, hi;		/* the rows of this morsel */
+	BUN nlocal;		/* number of local groups */
+	BUN *first;		/* row of the first member of each local group */
+	lng *cnts;		/* number of members of each local group */
+	oid *map;		/* global group id of each local group */
+	int sorted;		/* whether the global group ids are ascending */
+	int failed;
+} grpmorsel;
+
+/* number of bits for a hash table with at least n buckets */
+static int
+grpparbits(BUN n)
+{
+	int bits = 8;
+
+	while (bits < 62 && ((BUN) 1 << bits) < n)
+		bits++;
+	return bits;
+}
+
+/* look up row r in a hash table of groups whose first members are
+ * in first, adding a new group if it is not there yet */
+#define GRPPAR_lookup(TYPE, R, NEW)					\
+	do {								\
+		const TYPE *restrict w = (const TYPE *) gp->vals;	\
+		BUN _p = GRPPARPOS(gp, R);				\
+		oid _g = gp->grps ? gp->grps[R] : 0;			\
+									\
+		h = GRPPARHASH(w[_p], _g, bits);			\
+		for (i = buckets[h]; i != GRPPARNIL; i = link[i]) {	\
+			BUN _f = first[i];				\
+			if (w[GRPPARPOS(gp, _f)] == w[_p] &&		\
+			    (gp->grps == NULL || gp->grps[_f] == _g))	\
+				break;					\
+		}							\
+		if (i == GRPPARNIL) {					\
+			i = ngrp++;					\
+			first[i] = R;					\
+			link[i] = buckets[h];				\
+			buckets[h] = i;					\
+			NEW;						\
+		}							\
+	} while (0)
+
+#define GRPPAR_local(TYPE)						\
+	do {								\
+		for (r = m->lo; r < m->hi; r++) {			\
+			GRPPAR_lookup(TYPE, r, m->cnts[i] = 0);		\
+			m->cnts[i]++;					\
+			gp->ngrps[r] = (oid) i;				\
+		}							\
+	} while (0)
+
+/* group the rows of a morsel into local groups */
+static void
+grpparlocal(void *arg)
+{
+	grpmorsel *m = arg;
+	const grppar *gp = m->gp;
+	BUN n = m->hi - m->lo, ngrp = 0, r, h, i;
+	BUN *buckets, *link, *first;
+	int bits = grpparbits(n);
+
+	buckets = GDKmalloc(((size_t) 1 << bits) * sizeof(BUN));
+	link = GDKmalloc(n * sizeof(BUN));
+	first = m->first = GDKmalloc(n * sizeof(BUN));
+	m->cnts = GDKmalloc(n * sizeof(lng));
+	m->map = GDKmalloc(n * sizeof(oid));
+	if (buckets == NULL || link == NULL || first == NULL ||
+	    m->cnts == NULL || m->map == NULL) {
+		m->failed = 1;
+		GDKfree(buckets);
+		GDKfree(link);
+		return;
+	}
+	memset(buckets, 0xFF, ((size_t) 1 << bits) * sizeof(BUN));
+	switch (gp->tpe) {
+	case TYPE_bte:
+		GRPPAR_local(bte);
+		break;
+	case TYPE_sht:
+		GRPPAR_local(sht);
+		break;
+	case TYPE_int:
+		GRPPAR_local(int);
+		break;
+	default:
+		GRPPAR_local(lng);
+		break;
+	}
+	m->nlocal = ngrp;
+	GDKfree(buckets);
+	GDKfree(link);
+}
+
+/* translate the local group ids of a morsel to global ones */
+static void
+grpparmap(void *arg)
+{
+	grpmorsel *m = arg;
+	oid *restrict ngrps = m->gp->ngrps;
+	const oid *restrict map = m->map;
+	oid prev = 0;
+	BUN r;
+
+	m->sorted = 1;
+	for (r = m->lo; r < m->hi; r++) {
+		oid g = map[ngrps[r]];
+
+		if (g < prev)
+			m->sorted = 0;
+		ngrps[r] = prev = g;
+	}
+}
+
+#define GRPPAR_merge(TYPE)						\
+	do {								\
+		for (k = 0; k < nthreads; k++) {			\
+			grpmorsel *m = &ms[k];				\
+			BUN j;						\
+									\
+			for (j = 0; j < m->nlocal; j++) {		\
+				GRPPAR_lookup(TYPE, m->first[j],	\
+					      if (exts)			\
+						      exts[i] = hseqb + GRPPARPOS(gp, m->first[j]); \
+					      if (cnts)			\
+						      cnts[i] = 0);	\
+				if (cnts)				\
+					cnts[i] += m->cnts[j];		\
+				m->map[j] = (oid) i;			\
+			}						\
+		}							\
+	} while (0)
+
+/* group the cnt rows of b (see CANDINIT for start and cand) using
+ * nthreads threads; return the number of groups in *ngrpp */
+static gdk_return
+grpparallel(BAT *b, int t, BUN start, const oid *cand, BUN cnt,
+	    const oid *grps, oid hseqb, BAT *gn, BAT *en, BAT *hn,
+	    int nthreads, oid *ngrpp)
+{
+	grppar par, *gp = &par;
+	grpmorsel *ms;
+	BUN *buckets = NULL, *link = NULL, *first = NULL;
+	BUN total = 0, ngrp = 0, h, i;
+	oid *exts = NULL;
+	lng *cnts = NULL;
+	int k, bits;
+	gdk_return rc = GDK_FAIL;
+
+	par.vals = Tloc(b, 0);
+	par.tpe = t;
+	par.seq = b->hseqbase;
+	par.start = start;
+	par.cand = cand;
+	par.grps = grps;
+	par.ngrps = (oid *) Tloc(gn, 0);
+	if ((ms = GDKzalloc(nthreads * sizeof(grpmorsel))) == NULL)
+		return GDK_FAIL;
+	for (k = 0; k < nthreads; k++) {
+		ms[k].gp = gp;
+		ms[k].lo = k * (cnt / nthreads);
+		ms[k].hi = k == nthreads - 1 ? cnt : (k + 1) * (cnt / nthreads);
+	}
+	GDKparallel(nthreads, grpparlocal, ms, sizeof(grpmorsel));
+	for (k = 0; k < nthreads; k++) {
+		if (ms[k].failed) {
+			GDKerror("BATgroup: cannot allocate hash table\n");
+			goto bailout;
+		}
+		total += ms[k].nlocal;
+	}
+
+	/* merge the local groups; since there are at most total
+	 * groups, make sure extents and histo can hold that many */
+	if ((en && BATcapacity(en) < total && BATextend(en, total) != GDK_SUCCEED) ||
+	    (hn && BATcapacity(hn) < total && BATextend(hn, total) != GDK_SUCCEED))
+		goto bailout;
+	if (en)
+		exts = (oid *) Tloc(en, 0);
+	if (hn)
+		cnts = (lng *) Tloc(hn, 0);
+	bits = grpparbits(total);
+	if ((buckets = GDKmalloc(((size_t) 1 << bits) * sizeof(BUN))) == NULL ||
+	    (link = GDKmalloc(total * sizeof(BUN))) == NULL ||
+	    (first = GDKmalloc(total * sizeof(BUN))) == NULL) {
+		GDKerror("BATgroup: cannot allocate hash table\n");
+		goto bailout;
+	}
+	memset(buckets, 0xFF, ((size_t) 1 << bits) * sizeof(BUN));
+	switch (t) {
+	case TYPE_bte:
+		GRPPAR_merge(bte);
+		break;
+	case TYPE_sht:
+		GRPPAR_merge(sht);
+		break;
+	case TYPE_int:
+		GRPPAR_merge(int);
+		break;
+	default:
+		GRPPAR_merge(lng);
+		break;
+	}
+
+	GDKparallel(nthreads, grpparmap, ms, sizeof(grpmorsel));
+	gn->tsorted = 1;
+	for (k = 0; k < nthreads; k++)
+		if (!ms[k].sorted ||
+		    (k > 0 && par.ngrps[ms[k].lo] < par.ngrps[ms[k].lo - 1]))
+			gn->tsorted = 0;
+	*ngrpp = (oid) ngrp;
+	rc = GDK_SUCCEED;
+
+  bailout:
+	for (k = 0; k < nthreads; k++) {
+		GDKfree(ms[k].first);
+		GDKfree(ms[k].cnts);
+		GDKfree(ms[k].map);
+	}
+	GDKfree(ms);
+	GDKfree(buckets);
+	GDKfree(link);
+	GDKfree(first);
+	return rc;
+}
+
 gdk_return
 BATgroup_internal(BAT **groups, BAT **extents, BAT **histo,
 		  BAT *b, BAT *s, BAT *g, BAT *e, BAT *h, int subsorted)
@@ -1003,6 +1278,31 @@ BATgroup_internal(BAT **groups, BAT **extents, BAT **histo,
 			GRP_use_existing_hash_table_any();
 			break;
 		}
+	} else if (GDKnr_threads > 1 && cnt >= GRPPARMINCNT &&
+		   (t == TYPE_bte || t == TYPE_sht ||
+		    t == TYPE_int || t == TYPE_lng) &&
+		   ATOMIC_GET(grpactive, grpLock) <= 1) {
+		int nthreads = (int) MIN((BUN) GDKnr_threads, cnt / GRPPARMORSEL);
+
+		/* not sorted, no pre-existing hash table, and
+		 * nothing else being grouped: group morsels of b in
+		 * parallel and merge the results */
+		ALGODEBUG fprintf(stderr, "#BATgroup(b=%s#" BUNFMT ","
+				  "s=%s#" BUNFMT ","
+				  "g=%s#" BUNFMT ","
+				  "e=%s#" BUNFMT ","
+				  "h=%s#" BUNFMT ",subsorted=%d): "
+				  "create parallel hash tables (%d threads)\n",
+				  BATgetId(b), BATcount(b),
+				  s ? BATgetId(s) : "NULL", s ? BATcount(s) : 0,
+				  g ? BATgetId(g) : "NULL", g ? BATcount(g) : 0,
+				  e ? BATgetId(e) : "NULL", e ? BATcount(e) : 0,
+				  h ? BATgetId(h) : "NULL", h ? BATcount(h) : 0,
+				  subsorted, nthreads);
+		if (grpparallel(b, t, start, cand, cnt, grps, hseqb,
+				gn, extents ? en : NULL, histo ? hn : NULL,
+				nthreads, &ngrp) != GDK_SUCCEED)
+			goto error;
 	} else {
 		bit gc = g && (BATordered(g) || BATordered_rev(g));
 		const char *nme;
@@ -1150,5 +1450,10 @@ gdk_return
 BATgroup(BAT **groups, BAT **extents, BAT **histo,
 	 BAT *b, BAT *s, BAT *g, BAT *e, BAT *h)
 {
-	return BATgroup_internal(groups, extents, histo, b, s, g, e, h, 0);
+	gdk_return rc;
+
+	(void) ATOMIC_INC(grpactive, grpLock);
+	rc = BATgroup_internal(groups, extents, histo, b, s, g, e, h, 0);
+	(void) ATOMIC_DEC(grpactive, grpLock);
+	return rc;
 }
@@ -157,6 +157,135 @@ HASHnew(Heap *hp, int tpe, BUN size, BUN mask, BUN count)
 		}						\
 	} while (0)
 
+/* Parallel hash construction
+ *
+ * The values of large columns of fixed-size types are inserted by
+ * several threads.  First, each thread hashes a part of the values,
+ * storing the bucket of each value in its Link entry and, in own,
+ * which thread owns that bucket (the buckets are divided into as many
+ * ranges as there are threads).  Then, each thread goes over all
+ * values and links the ones whose bucket it owns into the chains.
+ * Since every thread inserts in order of position, the result is the
+ * same as when the values are inserted sequentially. */
+#define HASHPARMINCNT	((BUN) 1 << 20)	/* smaller columns are hashed by one thread */
+
+typedef struct {
+	BAT *b;
+	Hash *h;
+	unsigned char *own;	/* per value: thread that owns its bucket */
+	BUN start, end;		/* values to be inserted */
+	BUN span;		/* number of buckets per thread */
+	BUN lo, hi;		/* values hashed by this thread */
+	int thr;		/* number of this thread */
+} hashpart;
+
+#define HASHPAR_bucket(TYPE)						\
+	do {								\
+		const TYPE *restrict v = (const TYPE *) Tloc(hp->b, 0);	\
+		for (r = hp->lo; r < hp->hi; r++) {			\
+			BUN c = (BUN) hash_##TYPE(h, v + r);		\
+									\
+			HASHputlink(h, r, c);				\
+			own[r - hp->start] = (unsigned char) (c / hp->span); \
+		}							\
+	} while (0)
+
+static void
+HASHparbucket(void *arg)
+{
+	hashpart *hp = arg;
+	Hash *h = hp->h;
+	unsigned char *restrict own = hp->own;
+	BUN r;
+
+	switch (ATOMbasetype(hp->b->ttype)) {
+	case TYPE_bte:
+		HASHPAR_bucket(bte);
+		break;
+	case TYPE_sht:
+		HASHPAR_bucket(sht);
+		break;
+	case TYPE_int:
+		HASHPAR_bucket(int);
+		break;
+	case TYPE_flt:
+		HASHPAR_bucket(flt);
+		break;
+	case TYPE_dbl:
+		HASHPAR_bucket(dbl);
+		break;
+	case TYPE_lng:
+		HASHPAR_bucket(lng);
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		HASHPAR_bucket(hge);
+		break;
+#endif
+	default:
+		assert(0);
+	}
+}
+
+static void
+HASHparlink(void *arg)
+{
+	hashpart *hp = arg;
+	Hash *h = hp->h;
+	const unsigned char *restrict own = hp->own;
+	const unsigned char thr = (unsigned char) hp->thr;
+	BUN r, c;
+
+	for (r = hp->start; r < hp->end; r++) {
+		if (own[r - hp->start] == thr) {
+			c = HASHgetlink(h, r);
+			HASHputlink(h, r, HASHget(h, c));
+			HASHput(h, c, r);
+		}
+	}
+}
+
+/* insert the values of b in positions start up to end into h using
+ * nthreads threads; if memory is short, nothing is inserted and
+ * GDK_FAIL is returned */
+static gdk_return
+HASHparallel(BAT *b, Hash *h, BUN start, BUN end, int nthreads)
+{
+	BUN cnt = end - start;
+	hashpart *hps;
+	unsigned char *own;
+	int i;
+
+	assert(nthreads > 1 && nthreads <= 256);
+	assert(h->mask <= HASHnil(h)); /* a bucket fits in a Link entry */
+	own = GDKmalloc(cnt);
+	hps = GDKmalloc(nthreads * sizeof(hashpart));
+	if (own == NULL || hps == NULL) {
+		GDKfree(own);
+		GDKfree(hps);
+		GDKclrerr();
+		return GDK_FAIL;
+	}
+	for (i = 0; i < nthreads; i++) {
+		hps[i].b = b;
+		hps[i].h = h;
+		hps[i].own = own;
+		hps[i].start = start;
+		hps[i].end = end;
+		hps[i].span = (h->mask + nthreads) / nthreads;
+		hps[i].lo = start + i * (cnt / nthreads);
+		hps[i].hi = i == nthreads - 1 ? end : start + (i + 1) * (cnt / nthreads);
+		hps[i].thr = i;
+	}
+	GDKparallel(nthreads, HASHparbucket, hps, sizeof(hashpart));
+	GDKprogress(cnt, 2 * cnt);
+	GDKparallel(nthreads, HASHparlink, hps, sizeof(hashpart));
+	GDKprogress(2 * cnt, 2 * cnt);
+	GDKfree(own);
+	GDKfree(hps);
+	return GDK_SUCCEED;
+}
+
 /* collect HASH statistics for analysis */
 static void
 HASHcollisions(BAT *b, Hash *h)
@@ -335,6 +464,7 @@ BAThash(BAT *b, BUN masksize)
 		BUN cnt = BATcount(b);
 		BUN mask, maxmask = 0;
 		BUN p = 0, q = BUNlast(b), r;
+		int nthreads = 1;
 		Hash *h = NULL;
 		Heap *hp;
 		const char *nme = BBP_physical(b->batCacheid);
@@ -464,6 +594,26 @@ BAThash(BAT *b, BUN masksize)
 		/* finish the hashtable with the current mask */
 		p = r;
 		switch (tpe) {
+		case TYPE_bte:
+		case TYPE_sht:
+		case TYPE_int:
+		case TYPE_flt:
+		case TYPE_dbl:
+		case TYPE_lng:
+#ifdef HAVE_HGE
+		case TYPE_hge:
+#endif
+			if (GDKnr_threads > 1 && q - p >= HASHPARMINCNT &&
+			    h->mask <= HASHnil(h))
+				nthreads = MIN(GDKnr_threads, 256);
+			break;
+		default:
+			break;
+		}
+		if (nthreads > 1 &&
+		    HASHparallel(b, h, p, q, nthreads) == GDK_SUCCEED) {
+			ALGODEBUG fprintf(stderr, "#BAThash: inserted " BUNFMT " values using %d threads\n", q - p, nthreads);
+		} else switch (tpe) {
 		case TYPE_bte:
 			finishhash(bte);
 			break;
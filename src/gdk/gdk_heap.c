@@ -542,6 +542,9 @@ GDKupgradevarheap(BAT *b, var_t v, int copyall, int mayshare)
 	b->theap.free <<= shift - b->tshift;
 	b->tshift = shift;
 	b->twidth = width;
+	/* string imprints are made per page of offsets, so they do
+	 * not fit the wider offsets */
+	IMPSdestroy(b);
 	return GDK_SUCCEED;
 }
 
@@ -577,6 +580,8 @@ HEAPfree(Heap *h, int remove)
 		} else if (h->storage == STORE_CMEM) {
 			//heap is stored in regular C memory rather than GDK memory,so we call free()
 			free(h->base);
+		} else if (h->storage == STORE_NOWN) {
+			/* memory is owned by whoever wrapped it */
 		} else {	/* mapped file, or STORE_PRIV */
 			gdk_return ret = GDKmunmap(h->base, h->size);
 
@@ -18,8 +18,25 @@
 #include "gdk_private.h"
 #include "gdk_imprints.h"
 
-#define IMPRINTS_VERSION	2
-#define IMPRINTS_HEADER_SIZE	4 /* nr of size_t fields in header */
+#define IMPRINTS_VERSION	3
+#define IMPRINTS_HEADER_SIZE	6 /* nr of size_t fields in header */
+
+/* size of the imprints heap with room for the imprints of pages
+ * pages */
+#define IMPS_HEAPSIZE(width, bits, pages)				\
+	(IMPRINTS_HEADER_SIZE * SIZEOF_SIZE_T + /* extra info */	\
+	 64 * (width) +		/* bins */				\
+	 64 * 2 * SIZEOF_OID +	/* {min,max}_bins */			\
+	 64 * SIZEOF_BUN +	/* cnt_bins */				\
+	 (pages) * ((bits) / 8) + /* imps */				\
+	 sizeof(uint64_t) +	/* padding for alignment */		\
+	 (pages) * sizeof(cchdc_t)) /* dict */
+
+/* offset of the dictionary in such a heap, i.e. the number of bytes
+ * that are written for a heap with an empty dictionary */
+#define IMPS_DICTOFF(width, bits, pages)				\
+	((IMPS_HEAPSIZE(width, bits, pages) - (pages) * sizeof(cchdc_t)) & \
+	 ~(sizeof(uint64_t) - 1))
 
 #define BINSIZE(B, FUNC, T) do {		\
 	switch (B) {				\
@@ -41,33 +58,53 @@ do {					\
 } while (0)
 
 
-#define IMPS_CREATE(TYPE,B)						\
+/* width of the bin boundaries: strings are binned on their IMPSstrkey */
+#define IMPS_BINWIDTH(b)						\
+	(ATOMbasetype((b)->ttype) == TYPE_str ? (int) sizeof(lng) : (b)->twidth)
+
+/* VAL(p) gives the value (or key) at position p that is binned */
+#define IMPS_CREATE_LOOP(TYPE,B,VAL)					\
 do {									\
 	uint##B##_t mask, prvmask;					\
 	uint##B##_t *restrict im = (uint##B##_t *) imps;		\
-	const TYPE *restrict col = (TYPE *) Tloc(b, 0);			\
 	const TYPE *restrict bins = (TYPE *) inbins;			\
 	const TYPE nil = TYPE##_nil;					\
-	const BUN page = IMPS_PAGE / sizeof(TYPE);			\
-	prvmask = 0;							\
-	for (i = 0; i < b->batCount; ) {				\
+	const BUN page = IMPS_PAGE >> b->tshift;			\
+	if (from % page != 0) {						\
+		/* the last page was incomplete: remove its imprint, */ \
+		/* it is recreated including the new values */		\
+		assert(dcnt > 0 && icnt > 0);				\
+		if (dict[dcnt-1].repeat && dict[dcnt-1].cnt > 1) {	\
+			dict[dcnt-1].cnt--;				\
+		} else {						\
+			icnt--;						\
+			if (--dict[dcnt-1].cnt == 0)			\
+				dcnt--;					\
+		}							\
+	}								\
+	prvmask = icnt > 0 ? im[icnt-1] : 0;				\
+	for (i = from - from % page; i < b->batCount; ) {		\
 		const BUN lim = MIN(i + page, b->batCount);		\
 		/* new mask */						\
 		mask = 0;						\
 		/* build mask for all BUNs in one PAGE */		\
 		for ( ; i < lim; i++) {					\
-			register const TYPE val = col[i];		\
+			register const TYPE val = VAL(i);		\
 			GETBIN(bin,val,B);				\
 			mask = IMPSsetBit(B,mask,bin);			\
-			if (val != nil) { /* do not count nils */	\
+			/* do not count nils, nor values counted before */ \
+			if (val != nil && i >= from) {			\
 				if (!cnt_bins[bin]++) {			\
 					min_bins[bin] = max_bins[bin] = i;\
 				} else {				\
-					if (val < col[min_bins[bin]])	\
+					if (val < VAL(min_bins[bin]))	\
 						min_bins[bin] = i;	\
-					if (val > col[max_bins[bin]])	\
+					if (val > VAL(max_bins[bin]))	\
 						max_bins[bin] = i;	\
 				}					\
+				if (drift &&				\
+				    (val < bins[0] || val > bins[B-1]))	\
+					(*drift)++;			\
 			}						\
 		}							\
 		/* same mask as previous and enough count to add */	\
@@ -106,9 +143,29 @@ do {									\
 	}								\
 } while (0)
 
+#define IMPS_COLVAL(p)	col[p]
+#define IMPS_CREATE(TYPE,B)						\
+do {									\
+	const TYPE *restrict col = (TYPE *) Tloc(b, 0);			\
+	IMPS_CREATE_LOOP(TYPE, B, IMPS_COLVAL);				\
+} while (0)
+
+#define IMPS_STRVAL(p)	IMPSstrkey(vars + VarHeapVal(offs, p, b->twidth))
+#define IMPS_CREATE_STR(TYPE,B)						\
+do {									\
+	const char *restrict vars = b->tvheap->base;			\
+	const void *restrict offs = Tloc(b, 0);				\
+	IMPS_CREATE_LOOP(TYPE, B, IMPS_STRVAL);				\
+} while (0)
+
+/* create the imprints of the values of b from position from onward;
+ * if from is not 0, the imprints of the values before it exist
+ * already and are extended, and the number of new values that fall
+ * outside the range of the bins is added to *drift */
 static void
 imprints_create(BAT *b, void *inbins, BUN *stats, bte bits,
-		void *imps, BUN *impcnt, cchdc_t *dict, BUN *dictcnt)
+		void *imps, BUN *impcnt, cchdc_t *dict, BUN *dictcnt,
+		BUN from, BUN *drift)
 {
 	BUN i;
 	BUN dcnt, icnt;
@@ -116,12 +173,15 @@ imprints_create(BAT *b, void *inbins, BUN *stats, bte bits,
 	BUN *restrict max_bins = min_bins + 64;
 	BUN *restrict cnt_bins = max_bins + 64;
 	int bin = 0;
-	dcnt = icnt = 0;
+	dcnt = *dictcnt;
+	icnt = *impcnt;
+	if (from == 0) {
 #ifndef NDEBUG
-	memset(min_bins, 0, 64 * SIZEOF_BUN);
-	memset(max_bins, 0, 64 * SIZEOF_BUN);
+		memset(min_bins, 0, 64 * SIZEOF_BUN);
+		memset(max_bins, 0, 64 * SIZEOF_BUN);
 #endif
-	memset(cnt_bins, 0, 64 * SIZEOF_BUN);
+		memset(cnt_bins, 0, 64 * SIZEOF_BUN);
+	}
 
 	switch (ATOMbasetype(b->ttype)) {
 	case TYPE_bte:
@@ -147,6 +207,9 @@ imprints_create(BAT *b, void *inbins, BUN *stats, bte bits,
 	case TYPE_dbl:
 		BINSIZE(bits, IMPS_CREATE, dbl);
 		break;
+	case TYPE_str:
+		BINSIZE(bits, IMPS_CREATE_STR, lng);
+		break;
 	default:
 		/* should never reach here */
 		assert(0);
@@ -165,7 +228,7 @@ imprints_create(BAT *b, void *inbins, BUN *stats, bte bits,
 #define FILL_HISTOGRAM(TYPE)						\
 do {									\
 	BUN k;								\
-	TYPE *restrict s = (TYPE *) Tloc(s4, 0);			\
+	TYPE *restrict s = (TYPE *) smp;				\
 	TYPE *restrict h = imprints->bins;				\
 	if (cnt < 64-1) {						\
 		TYPE max = GDK_##TYPE##_max;				\
@@ -183,27 +246,39 @@ do {									\
 	}								\
 } while (0)
 
-/* Check whether we have imprints on b (and return true if we do).  It
- * may be that the imprints were made persistent, but we hadn't seen
- * that yet, so check the file system.  This also returns true if b is
- * a view and there are imprints on b's parent.
- *
- * Note that the b->timprints pointer can be NULL, meaning there are
- * no imprints; (Imprints *) 1, meaning there are no imprints loaded,
- * but they may exist on disk; or a valid pointer to loaded imprints.
- * These values are maintained here, in the IMPSdestroy and IMPSfree
- * functions, and in BBPdiskscan during initialization. */
-int
-BATcheckimprints(BAT *b)
+/* set the pointers into the imprints heap; the imps and dict parts
+ * have room for imprints->pages pages */
+static void
+imprints_layout(Imprints *imprints, int width)
 {
-	int ret;
+	imprints->bins = imprints->imprints->base + IMPRINTS_HEADER_SIZE * SIZEOF_SIZE_T;
+	imprints->stats = (BUN *) ((char *) imprints->bins + 64 * width);
+	imprints->imps = (void *) (imprints->stats + 64 * 3);
+	imprints->dict = (void *) ((uintptr_t) ((char *) imprints->imps + imprints->pages * (imprints->bits / 8) + sizeof(uint64_t)) & ~(sizeof(uint64_t) - 1));
+}
 
-	if (VIEWtparent(b)) {
-		assert(b->timprints == NULL);
-		b = BBPdescriptor(VIEWtparent(b));
-	}
+/* record the current state in the header of the imprints heap; the
+ * flag bits in the first entry are kept */
+static void
+imprints_header(Imprints *imprints, BUN cnt)
+{
+	size_t *hdata = (size_t *) imprints->imprints->base;
+
+	hdata[0] = (hdata[0] & ~(size_t) 0xFF) | (size_t) imprints->bits;
+	hdata[1] = (size_t) imprints->impcnt;
+	hdata[2] = (size_t) imprints->dictcnt;
+	hdata[3] = (size_t) cnt;
+	hdata[4] = (size_t) imprints->pages;
+	hdata[5] = (size_t) imprints->drift;
+	imprints->imprints->free = (size_t) ((char *) ((cchdc_t *) imprints->dict + imprints->dictcnt) - imprints->imprints->base);
+}
 
-	MT_lock_set(&GDKimprintsLock(b->batCacheid));
+/* Load persisted imprints of b, which has cnt values, if b->timprints
+ * indicates they may exist on disk; return whether b has imprints.
+ * Must be called with the imprints lock of b held. */
+static int
+imprints_load(BAT *b, BUN cnt)
+{
 	if (b->timprints == (Imprints *) 1) {
 		Imprints *imprints;
 		Heap *hp;
@@ -220,46 +295,48 @@ BATcheckimprints(BAT *b)
 			/* check whether a persisted imprints index
 			 * can be found */
 			if ((fd = GDKfdlocate(hp->farmid, nme, "rb", ext)) >= 0) {
-				size_t hdata[4];
+				size_t hdata[IMPRINTS_HEADER_SIZE];
 				struct stat st;
 				size_t pages;
 
-				pages = (((size_t) BATcount(b) * b->twidth) + IMPS_PAGE - 1) / IMPS_PAGE;
+				pages = (((size_t) cnt * b->twidth) + IMPS_PAGE - 1) / IMPS_PAGE;
 				if ((imprints = GDKzalloc(sizeof(Imprints))) != NULL &&
 				    read(fd, hdata, sizeof(hdata)) == sizeof(hdata) &&
 				    hdata[0] & ((size_t) 1 << 16) &&
 				    ((hdata[0] & 0xFF00) >> 8) == IMPRINTS_VERSION &&
-				    hdata[3] == (size_t) BATcount(b) &&
+				    hdata[3] == (size_t) cnt &&
+				    hdata[4] >= pages &&
+				    hdata[2] <= hdata[4] &&
 				    fstat(fd, &st) == 0 &&
+				    /* only the used part of the heap,
+				     * up to the end of the dictionary,
+				     * is written */
 				    st.st_size >= (off_t) (hp->size =
 							   hp->free =
-							   64 * b->twidth +
-							   64 * 2 * SIZEOF_OID +
-							   64 * SIZEOF_BUN +
-							   pages * ((bte) hdata[0] / 8) +
-							   hdata[2] * sizeof(cchdc_t) +
-							   sizeof(uint64_t) /* padding for alignment */
-							   + 4 * SIZEOF_SIZE_T) &&
-				    HEAPload(hp, nme, b->batCacheid > 0 ? "timprints" : "himprints", 0) == GDK_SUCCEED) {
+							   IMPS_DICTOFF(IMPS_BINWIDTH(b), (bte) hdata[0], hdata[4]) +
+							   hdata[2] * sizeof(cchdc_t)) &&
+				    HEAPload(hp, nme, ext, 0) == GDK_SUCCEED &&
+				    HEAPextend(hp, IMPS_HEAPSIZE(IMPS_BINWIDTH(b), (bte) hdata[0], hdata[4]), 1) == GDK_SUCCEED) {
 					/* usable */
 					imprints->imprints = hp;
 					imprints->bits = (bte) (hdata[0] & 0xFF);
 					imprints->impcnt = (BUN) hdata[1];
 					imprints->dictcnt = (BUN) hdata[2];
-					imprints->bins = hp->base + 4 * SIZEOF_SIZE_T;
-					imprints->stats = (BUN *) ((char *) imprints->bins + 64 * b->twidth);
-					imprints->imps = (void *) (imprints->stats + 64 * 3);
-					imprints->dict = (void *) ((uintptr_t) ((char *) imprints->imps + pages * (imprints->bits / 8) + sizeof(uint64_t)) & ~(sizeof(uint64_t) - 1));
+					imprints->pages = (BUN) hdata[4];
+					imprints->drift = (BUN) hdata[5];
+					imprints_layout(imprints, IMPS_BINWIDTH(b));
 					close(fd);
 					imprints->imprints->parentid = b->batCacheid;
+					imprints->imprints->dirty = FALSE;
 					b->timprints = imprints;
 					ALGODEBUG fprintf(stderr, "#BATcheckimprints: reusing persisted imprints %d\n", b->batCacheid);
-					MT_lock_unset(&GDKimprintsLock(b->batCacheid));
 
 					return 1;
 				}
 				GDKfree(imprints);
 				close(fd);
+				if (hp->base)
+					HEAPfree(hp, 0);
 				/* unlink unusable file */
 				GDKunlink(hp->farmid, BATDIR, nme, ext);
 			}
@@ -268,7 +345,31 @@ BATcheckimprints(BAT *b)
 		GDKfree(hp);
 		GDKclrerr();	/* we're not currently interested in errors */
 	}
-	ret = b->timprints != NULL;
+	return b->timprints != NULL;
+}
+
+/* Check whether we have imprints on b (and return true if we do).  It
+ * may be that the imprints were made persistent, but we hadn't seen
+ * that yet, so check the file system.  This also returns true if b is
+ * a view and there are imprints on b's parent.
+ *
+ * Note that the b->timprints pointer can be NULL, meaning there are
+ * no imprints; (Imprints *) 1, meaning there are no imprints loaded,
+ * but they may exist on disk; or a valid pointer to loaded imprints.
+ * These values are maintained here, in the IMPSdestroy and IMPSfree
+ * functions, and in BBPdiskscan during initialization. */
+int
+BATcheckimprints(BAT *b)
+{
+	int ret;
+
+	if (VIEWtparent(b)) {
+		assert(b->timprints == NULL);
+		b = BBPdescriptor(VIEWtparent(b));
+	}
+
+	MT_lock_set(&GDKimprintsLock(b->batCacheid));
+	ret = imprints_load(b, BATcount(b));
 	MT_lock_unset(&GDKimprintsLock(b->batCacheid));
 	ALGODEBUG if (ret) fprintf(stderr, "#BATcheckimprints: already has imprints %d\n", b->batCacheid);
 	return ret;
@@ -279,6 +380,8 @@ BATimprints(BAT *b)
 {
 	BAT *o = NULL, *s1 = NULL, *s2 = NULL, *s3 = NULL, *s4 = NULL;
 	Imprints *imprints;
+	lng *keys = NULL;
+	void *smp;
 	lng t0 = 0;
 
 	/* we only create imprints for types that look like types we know */
@@ -292,6 +395,7 @@ BATimprints(BAT *b)
 #endif
 	case TYPE_flt:
 	case TYPE_dbl:
+	case TYPE_str:
 		break;
 	default:		/* type not supported */
 		/* doesn't look enough like base type: do nothing */
@@ -382,6 +486,32 @@ BATimprints(BAT *b)
 		/* s4 now is ordered and unique on tail */
 		assert(s4->tkey && s4->tsorted);
 		cnt = BATcount(s4);
+		smp = Tloc(s4, 0);
+		if (ATOMbasetype(b->ttype) == TYPE_str) {
+			/* the bins are filled with the keys of the
+			 * sample, which are ordered but not
+			 * necessarily unique */
+			BATiter si = bat_iterator(s4);
+			BUN j, k;
+
+			if ((keys = GDKmalloc(cnt * sizeof(lng) + 1)) == NULL) {
+				GDKfree(imprints->imprints);
+				GDKfree(imprints);
+				MT_lock_unset(&GDKimprintsLock(b->batCacheid));
+				BBPunfix(s1->batCacheid);
+				BBPunfix(s2->batCacheid);
+				BBPunfix(s3->batCacheid);
+				BBPunfix(s4->batCacheid);
+				return GDK_FAIL;
+			}
+			for (j = k = 0; j < cnt; j++) {
+				lng key = IMPSstrkey(BUNtvar(si, j));
+				if (k == 0 || keys[k - 1] != key)
+					keys[k++] = key;
+			}
+			cnt = k;
+			smp = keys;
+		}
 		imprints->bits = 64;
 		if (cnt <= 32)
 			imprints->bits = 32;
@@ -398,15 +528,13 @@ BATimprints(BAT *b)
 		 * In addition, we add some housekeeping entries at
 		 * the start so that we can determine whether we can
 		 * trust the imprints when encountered on startup (including
-		 * a version number -- CURRENT VERSION is 2). */
+		 * a version number -- CURRENT VERSION is 3).
+		 * When values are appended, the imps and dict parts
+		 * are grown, so they may have room for more pages
+		 * than there are. */
+		imprints->pages = pages;
 		if (HEAPalloc(imprints->imprints,
-			      IMPRINTS_HEADER_SIZE * SIZEOF_SIZE_T + /* extra info */
-			      64 * b->twidth + /* bins */
-			      64 * 2 * SIZEOF_OID + /* {min,max}_bins */
-			      64 * SIZEOF_BUN +	    /* cnt_bins */
-			      pages * (imprints->bits / 8) + /* imps */
-			      sizeof(uint64_t) + /* padding for alignment */
-			      pages * sizeof(cchdc_t), /* dict */
+			      IMPS_HEAPSIZE(IMPS_BINWIDTH(b), imprints->bits, pages),
 			      1) != GDK_SUCCEED) {
 			GDKfree(imprints->imprints);
 			GDKfree(imprints);
@@ -416,12 +544,10 @@ BATimprints(BAT *b)
 			BBPunfix(s2->batCacheid);
 			BBPunfix(s3->batCacheid);
 			BBPunfix(s4->batCacheid);
+			GDKfree(keys);
 			return GDK_FAIL;
 		}
-		imprints->bins = imprints->imprints->base + IMPRINTS_HEADER_SIZE * SIZEOF_SIZE_T;
-		imprints->stats = (BUN *) ((char *) imprints->bins + 64 * b->twidth);
-		imprints->imps = (void *) (imprints->stats + 64 * 3);
-		imprints->dict = (void *) ((uintptr_t) ((char *) imprints->imps + pages * (imprints->bits / 8) + sizeof(uint64_t)) & ~(sizeof(uint64_t) - 1));
+		imprints_layout(imprints, IMPS_BINWIDTH(b));
 
 		switch (ATOMbasetype(b->ttype)) {
 		case TYPE_bte:
@@ -447,10 +573,14 @@ BATimprints(BAT *b)
 		case TYPE_dbl:
 			FILL_HISTOGRAM(dbl);
 			break;
+		case TYPE_str:
+			FILL_HISTOGRAM(lng);
+			break;
 		default:
 			/* should never reach here */
 			assert(0);
 		}
+		GDKfree(keys);
 
 		imprints_create(b,
 				imprints->bins,
@@ -459,18 +589,16 @@ BATimprints(BAT *b)
 				imprints->imps,
 				&imprints->impcnt,
 				imprints->dict,
-				&imprints->dictcnt);
+				&imprints->dictcnt,
+				0, NULL);
 		assert(imprints->impcnt <= pages);
 		assert(imprints->dictcnt <= pages);
 #ifndef NDEBUG
 		memset((char *) imprints->imps + imprints->impcnt * (imprints->bits / 8), 0, (char *) imprints->dict - ((char *) imprints->imps + imprints->impcnt * (imprints->bits / 8)));
 #endif
-		imprints->imprints->free = (size_t) ((char *) ((cchdc_t *) imprints->dict + imprints->dictcnt) - imprints->imprints->base);
 		/* add info to heap for when they become persistent */
-		((size_t *) imprints->imprints->base)[0] = (size_t) (imprints->bits);
-		((size_t *) imprints->imprints->base)[1] = (size_t) imprints->impcnt;
-		((size_t *) imprints->imprints->base)[2] = (size_t) imprints->dictcnt;
-		((size_t *) imprints->imprints->base)[3] = (size_t) BATcount(b);
+		((size_t *) imprints->imprints->base)[0] = 0;
+		imprints_header(imprints, BATcount(b));
 		if ((BBP_status(b->batCacheid) & BBPEXISTING) &&
 		    HEAPsave(imprints->imprints, nme, b->batCacheid > 0 ? "timprints" : "himprints") == GDK_SUCCEED &&
 		    (fd = GDKfdlocate(imprints->imprints->farmid, nme, "rb+",
@@ -594,6 +722,72 @@ IMPSimprintsize(BAT *b)
 	return sz;
 }
 
+/* Extend the imprints of b to cover the values appended to it, cnt
+ * being the number of values b had before the append.  The existing
+ * bins are reused.  If too many of the values appended since the bins
+ * were chosen fall outside their range, the value distribution has
+ * drifted and the imprints are destroyed instead, so that they get
+ * recreated with new bins when next needed. */
+void
+IMPSappend(BAT *b, BUN cnt)
+{
+	Imprints *imprints;
+	size_t pages;
+	int fail = 0;
+
+	if (b->timprints == NULL)
+		return;
+	assert(!VIEWtparent(b));
+	MT_lock_set(&GDKimprintsLock(b->batCacheid));
+	if (!imprints_load(b, cnt)) {
+		MT_lock_unset(&GDKimprintsLock(b->batCacheid));
+		return;
+	}
+	imprints = b->timprints;
+	pages = (((size_t) BATcount(b) * b->twidth) + IMPS_PAGE - 1) / IMPS_PAGE;
+	if (pages > imprints->pages) {
+		/* make room for more imprints and move the
+		 * dictionary out of the way */
+		size_t dictoff = (char *) imprints->dict - imprints->imprints->base;
+		BUN npages = MAX(pages, imprints->pages + imprints->pages / 2);
+
+		if (HEAPextend(imprints->imprints,
+			       IMPS_HEAPSIZE(IMPS_BINWIDTH(b), imprints->bits, npages),
+			       1) != GDK_SUCCEED) {
+			fail = 1;
+		} else {
+			imprints->pages = npages;
+			imprints_layout(imprints, IMPS_BINWIDTH(b));
+			memmove(imprints->dict,
+				imprints->imprints->base + dictoff,
+				imprints->dictcnt * sizeof(cchdc_t));
+		}
+	}
+	if (!fail) {
+		imprints_create(b,
+				imprints->bins,
+				imprints->stats,
+				imprints->bits,
+				imprints->imps,
+				&imprints->impcnt,
+				imprints->dict,
+				&imprints->dictcnt,
+				cnt, &imprints->drift);
+		assert(imprints->impcnt <= pages);
+		assert(imprints->dictcnt <= pages);
+		fail = imprints->drift > BATcount(b) / 8;
+		imprints_header(imprints, BATcount(b));
+		imprints->imprints->dirty = TRUE;
+		ALGODEBUG fprintf(stderr, "#IMPSappend(b=%s#" BUNFMT "): "
+				  "extended imprints, drift " BUNFMT "%s\n",
+				  BATgetId(b), BATcount(b), imprints->drift,
+				  fail ? ", rebin" : "");
+	}
+	MT_lock_unset(&GDKimprintsLock(b->batCacheid));
+	if (fail)
+		IMPSdestroy(b);
+}
+
 static void
 IMPSremove(BAT *b)
 {
@@ -650,6 +844,25 @@ IMPSfree(BAT *b)
 		if (imprints != NULL && imprints != (Imprints *) 1) {
 			b->timprints = (Imprints *) 1;
 			if (!VIEWtparent(b)) {
+				/* imprints that were persisted and
+				 * extended since are saved again */
+				if (imprints->imprints->storage == STORE_MEM &&
+				    imprints->imprints->dirty &&
+				    * (size_t *) imprints->imprints->base & ((size_t) 1 << 16) &&
+				    GDKsave(imprints->imprints->farmid,
+					    imprints->imprints->filename,
+					    NULL,
+					    imprints->imprints->base,
+					    imprints->imprints->free,
+					    STORE_MEM,
+					    FALSE) != GDK_SUCCEED) {
+					/* if saving failed, remove */
+					GDKunlink(BBPselectfarm(b->batRole, b->ttype, imprintsheap),
+						  BATDIR,
+						  BBP_physical(b->batCacheid),
+						  "timprints");
+					b->timprints = NULL;
+				}
 				HEAPfree(imprints->imprints, 0);
 				GDKfree(imprints->imprints);
 				GDKfree(imprints);
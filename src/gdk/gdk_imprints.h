@@ -27,4 +27,25 @@ typedef struct {
 #define IMPSunsetBit(B, X, Y)	((X) & ~((uint##B##_t) 1 << (Y)))
 #define IMPSisSet(B, X, Y)	(((X) & ((uint##B##_t) 1 << (Y))) != 0)
 
+/* Imprints on strings are built on a key derived from the first eight
+ * bytes of each string.  The key orders like the strings do (if
+ * strCmp(a, b) <= 0 then IMPSstrkey(a) <= IMPSstrkey(b)), so the
+ * bins and masks work as they do for lng.  nil becomes lng_nil, the
+ * empty string the smallest value after it. */
+static inline lng
+IMPSstrkey(const char *s)
+{
+	uint64_t k = 0;
+	int i;
+
+	if (GDK_STRNIL(s))
+		return lng_nil;
+	for (i = 0; i < 8 && s[i]; i++)
+		k |= (uint64_t) (unsigned char) s[i] << (56 - 8 * i);
+	if (k == 0)
+		k = 1;		/* the empty string */
+	/* flip the sign bit so that signed order is unsigned order */
+	return (lng) (k ^ ((uint64_t) 1 << 63));
+}
+
 #endif /* GDK_IMPS_H */
@@ -2868,6 +2868,367 @@ hashjoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 	return GDK_FAIL;
 }
 
+/*
+ * Partitioned (radix) hash join.
+ *
+ * Building one hash table on a large right input and probing it with
+ * a large left input misses the cache on nearly every access, and
+ * runs on a single core.  Instead, both inputs are scattered on the
+ * high bits of a multiplicative hash of their values into partitions
+ * whose right part fits in the cache of a core.  Each thread then
+ * takes partitions one at a time, builds a chained hash table on the
+ * right part and probes it with the left part, collecting the matches
+ * in buffers of its own.  The buffers are concatenated into the
+ * results at the end, so neither output is ordered.
+ *
+ * Only inputs with 4 or 8 byte values are handled, the values are
+ * processed as lng.
+ */
+
+#define RADIXMINCNT	((BUN) 1 << 20)	/* smaller inputs use hashjoin */
+#define RADIXMAXBITS	14		/* at most 16384 partitions */
+
+#define RADIXHASH(v)	((ulng) (v) * (ulng) LL_CONSTANT(0x9E3779B97F4A7C15))
+
+#ifdef ATOMIC_LOCK
+static MT_Lock radixLock MT_LOCK_INITIALIZER("radixLock");
+#endif
+
+typedef struct {
+	lng v;
+	oid o;
+} radixpair;
+
+typedef struct {
+	const char *vals;	/* values of the input */
+	int width;		/* 4 or 8 */
+	oid seq;		/* hseqbase of the input */
+	BUN start;		/* first position, if no candidates */
+	const oid *cand;	/* candidate list, or NULL */
+	BUN cnt;		/* number of positions or candidates */
+	radixpair *parts;	/* the input scattered over the partitions */
+	BUN *bounds;		/* partition p is parts[bounds[p]..bounds[p+1]) */
+} radixside;
+
+typedef struct {
+	radixside side[2];	/* left and right input */
+	int bits;		/* log2 of the number of partitions */
+	int nparts;
+	int nthreads;
+	int nil_matches;
+	volatile ATOMIC_TYPE next;	/* next partition to be joined */
+} radixstate;
+
+typedef struct {
+	radixstate *rj;
+	int id;
+	BUN *hist[2];		/* per partition counts, then write offsets */
+	oid *r1, *r2;		/* this thread's matches */
+	BUN cnt, cap;
+	int failed;
+} radixwork;
+
+static inline void
+radixchunk(const radixside *s, const radixwork *w, BUN *lo, BUN *hi)
+{
+	BUN n = s->cnt / w->rj->nthreads;
+
+	*lo = w->id * n;
+	*hi = w->id == w->rj->nthreads - 1 ? s->cnt : *lo + n;
+}
+
+/* fetch the i-th value of an input, return whether it is not nil */
+static inline int
+radixvalue(const radixside *s, BUN i, lng *v, oid *o)
+{
+	BUN p = s->cand ? s->cand[i] - s->seq : s->start + i;
+
+	*o = p + s->seq;
+	if (s->width == 4) {
+		int x = ((const int *) s->vals)[p];
+
+		*v = x;
+		return x != int_nil;
+	}
+	*v = ((const lng *) s->vals)[p];
+	return *v != lng_nil;
+}
+
+static void
+radixhistogram(void *arg)
+{
+	radixwork *w = arg;
+	const radixstate *rj = w->rj;
+	int k, shift = 64 - rj->bits;
+	BUN i, lo, hi;
+	lng v;
+	oid o;
+
+	for (k = 0; k < 2; k++) {
+		const radixside *s = &rj->side[k];
+		BUN *h = w->hist[k];
+
+		radixchunk(s, w, &lo, &hi);
+		for (i = lo; i < hi; i++)
+			if (radixvalue(s, i, &v, &o) || rj->nil_matches)
+				h[RADIXHASH(v) >> shift]++;
+	}
+}
+
+static void
+radixscatter(void *arg)
+{
+	radixwork *w = arg;
+	const radixstate *rj = w->rj;
+	int k, shift = 64 - rj->bits;
+	BUN i, lo, hi;
+	lng v;
+	oid o;
+
+	for (k = 0; k < 2; k++) {
+		const radixside *s = &rj->side[k];
+		BUN *h = w->hist[k];
+		radixpair *parts = s->parts, *pp;
+
+		radixchunk(s, w, &lo, &hi);
+		for (i = lo; i < hi; i++)
+			if (radixvalue(s, i, &v, &o) || rj->nil_matches) {
+				pp = &parts[h[RADIXHASH(v) >> shift]++];
+				pp->v = v;
+				pp->o = o;
+			}
+	}
+}
+
+static void
+radixprobe(void *arg)
+{
+	radixwork *w = arg;
+	radixstate *rj = w->rj;
+	const radixside *ls = &rj->side[0], *rs = &rj->side[1];
+	BUN *bucket = NULL, *link = NULL, nbucket = 0, nlink = 0;
+	BUN nb, rn, i, x;
+	int p, bbits;
+
+	while ((p = (int) ATOMIC_INC(rj->next, radixLock) - 1) < rj->nparts) {
+		const radixpair *lp = ls->parts + ls->bounds[p];
+		const radixpair *le = ls->parts + ls->bounds[p + 1];
+		const radixpair *rp = rs->parts + rs->bounds[p];
+
+		rn = rs->bounds[p + 1] - rs->bounds[p];
+		if (rn == 0 || lp == le)
+			continue;
+		for (nb = 1, bbits = 0; nb < rn; nb <<= 1, bbits++)
+			;
+		if (nb > nbucket) {
+			GDKfree(bucket);
+			if ((bucket = GDKmalloc(nb * sizeof(BUN))) == NULL)
+				goto bailout;
+			nbucket = nb;
+		}
+		if (rn > nlink) {
+			GDKfree(link);
+			if ((link = GDKmalloc(rn * sizeof(BUN))) == NULL)
+				goto bailout;
+			nlink = rn;
+		}
+		/* the partition used the high bits of the hash, the
+		 * buckets use the ones below those */
+		for (i = 0; i < nb; i++)
+			bucket[i] = BUN_NONE;
+		for (i = 0; i < rn; i++) {
+			x = bbits ? (BUN) ((RADIXHASH(rp[i].v) << rj->bits) >> (64 - bbits)) : 0;
+			link[i] = bucket[x];
+			bucket[x] = i;
+		}
+		for (; lp < le; lp++) {
+			x = bbits ? (BUN) ((RADIXHASH(lp->v) << rj->bits) >> (64 - bbits)) : 0;
+			for (i = bucket[x]; i != BUN_NONE; i = link[i]) {
+				if (rp[i].v != lp->v)
+					continue;
+				if (w->cnt == w->cap) {
+					BUN cap = w->cap ? 2 * w->cap : 1024;
+					oid *r1 = GDKrealloc(w->r1, cap * sizeof(oid));
+
+					if (r1 == NULL)
+						goto bailout;
+					w->r1 = r1;
+					if ((r1 = GDKrealloc(w->r2, cap * sizeof(oid))) == NULL)
+						goto bailout;
+					w->r2 = r1;
+					w->cap = cap;
+				}
+				w->r1[w->cnt] = lp->o;
+				w->r2[w->cnt] = rp[i].o;
+				w->cnt++;
+			}
+		}
+	}
+	GDKfree(bucket);
+	GDKfree(link);
+	return;
+
+  bailout:
+	w->failed = 1;
+	/* make the other threads stop as well */
+	(void) ATOMIC_SET(rj->next, rj->nparts, radixLock);
+	GDKfree(bucket);
+	GDKfree(link);
+}
+
+static void
+radixinit(radixside *s, BAT *b, BUN start, BUN end, const oid *cand, const oid *candend)
+{
+	s->vals = (const char *) Tloc(b, 0);
+	s->width = b->twidth;
+	s->seq = b->hseqbase;
+	s->start = start;
+	s->cand = cand;
+	s->cnt = cand ? (BUN) (candend - cand) : end - start;
+	s->parts = NULL;
+	s->bounds = NULL;
+}
+
+/* whether radixjoin can and should be used for joining l and r */
+static int
+radixjoinable(BAT *l, BAT *r, BUN lcount, BUN rcount)
+{
+	int t = ATOMbasetype(l->ttype);
+
+	return GDKnr_threads > 1 &&
+		(t == TYPE_int || t == TYPE_lng) &&
+		!BATtvoid(l) && !BATtvoid(r) &&
+		MIN(lcount, rcount) >= RADIXMINCNT &&
+		/* scattering a large input for a small one does not
+		 * pay off, e.g. for the pieces of mitosis */
+		MIN(lcount, rcount) >= MAX(lcount, rcount) / 4 &&
+		(lcount + rcount) * (sizeof(radixpair) + sizeof(oid)) < GDK_mem_maxsize / 2;
+}
+
+static gdk_return
+radixjoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches, lng t0)
+{
+	radixstate rj;
+	radixwork *works;
+	BUN lstart, lend, lcnt, rstart, rend, rcnt;
+	const oid *lcand, *lcandend, *rcand, *rcandend;
+	BUN off, c, total;
+	int i, k, p;
+	gdk_return rc = GDK_FAIL;
+
+	CANDINIT(l, sl, lstart, lend, lcnt, lcand, lcandend);
+	CANDINIT(r, sr, rstart, rend, rcnt, rcand, rcandend);
+	radixinit(&rj.side[0], l, lstart, lend, lcand, lcandend);
+	radixinit(&rj.side[1], r, rstart, rend, rcand, rcandend);
+	rj.nil_matches = nil_matches;
+	rj.nthreads = GDKnr_threads;
+	/* enough partitions for the right part of each to fit in the
+	 * cache of a core, and a few for each thread to balance */
+	for (rj.bits = 1;
+	     rj.bits < RADIXMAXBITS &&
+	     ((rj.side[1].cnt >> rj.bits) * (sizeof(radixpair) + 2 * sizeof(BUN)) > MT_cachesize() ||
+	      (1 << rj.bits) < 4 * rj.nthreads);
+	     rj.bits++)
+		;
+	rj.nparts = 1 << rj.bits;
+	ATOMIC_SET(rj.next, 0, radixLock);
+
+	ALGODEBUG fprintf(stderr, "#radixjoin(l=%s#" BUNFMT ",r=%s#" BUNFMT
+			  ",sl=%s,sr=%s,nil_matches=%d): %d partitions, "
+			  "%d threads\n",
+			  BATgetId(l), BATcount(l), BATgetId(r), BATcount(r),
+			  sl ? BATgetId(sl) : "NULL",
+			  sr ? BATgetId(sr) : "NULL",
+			  nil_matches, rj.nparts, rj.nthreads);
+
+	if ((works = GDKzalloc(rj.nthreads * sizeof(radixwork))) == NULL)
+		goto bailout;
+	for (i = 0; i < rj.nthreads; i++) {
+		works[i].rj = &rj;
+		works[i].id = i;
+		for (k = 0; k < 2; k++)
+			if ((works[i].hist[k] = GDKzalloc(rj.nparts * sizeof(BUN))) == NULL)
+				goto cleanup;
+	}
+	GDKparallel(rj.nthreads, radixhistogram, works, sizeof(radixwork));
+
+	/* turn the counts into the positions where each thread
+	 * writes its values of each partition */
+	for (k = 0; k < 2; k++) {
+		radixside *s = &rj.side[k];
+
+		if ((s->bounds = GDKmalloc((rj.nparts + 1) * sizeof(BUN))) == NULL)
+			goto cleanup;
+		for (off = 0, p = 0; p < rj.nparts; p++) {
+			s->bounds[p] = off;
+			for (i = 0; i < rj.nthreads; i++) {
+				c = works[i].hist[k][p];
+				works[i].hist[k][p] = off;
+				off += c;
+			}
+		}
+		s->bounds[rj.nparts] = off;
+		if ((s->parts = GDKmalloc(MAX(off, 1) * sizeof(radixpair))) == NULL)
+			goto cleanup;
+	}
+	GDKparallel(rj.nthreads, radixscatter, works, sizeof(radixwork));
+	GDKparallel(rj.nthreads, radixprobe, works, sizeof(radixwork));
+
+	for (total = 0, i = 0; i < rj.nthreads; i++) {
+		if (works[i].failed) {
+			GDKerror("radixjoin: cannot allocate result buffers\n");
+			goto cleanup;
+		}
+		total += works[i].cnt;
+	}
+	if (BATcapacity(r1) < total &&
+	    (BATextend(r1, total) != GDK_SUCCEED ||
+	     BATextend(r2, total) != GDK_SUCCEED))
+		goto cleanup;
+	for (off = 0, i = 0; i < rj.nthreads; i++) {
+		memcpy((oid *) Tloc(r1, 0) + off, works[i].r1, works[i].cnt * sizeof(oid));
+		memcpy((oid *) Tloc(r2, 0) + off, works[i].r2, works[i].cnt * sizeof(oid));
+		off += works[i].cnt;
+	}
+	BATsetcount(r1, total);
+	BATsetcount(r2, total);
+	/* an input that is key makes the opposite output key */
+	r1->tkey = r->tkey != 0 || total <= 1;
+	r2->tkey = l->tkey != 0 || total <= 1;
+	r1->tsorted = r1->trevsorted = r1->tdense = total <= 1;
+	r2->tsorted = r2->trevsorted = r2->tdense = total <= 1;
+	if (total == 1) {
+		r1->tseqbase = *(oid *) Tloc(r1, 0);
+		r2->tseqbase = *(oid *) Tloc(r2, 0);
+	}
+	rc = GDK_SUCCEED;
+
+	ALGODEBUG fprintf(stderr, "#radixjoin(l=%s,r=%s)=(%s#"BUNFMT",%s#"BUNFMT") " LLFMT "us\n",
+			  BATgetId(l), BATgetId(r),
+			  BATgetId(r1), BATcount(r1),
+			  BATgetId(r2), BATcount(r2),
+			  GDKusec() - t0);
+
+  cleanup:
+	for (i = 0; i < rj.nthreads; i++) {
+		GDKfree(works[i].hist[0]);
+		GDKfree(works[i].hist[1]);
+		GDKfree(works[i].r1);
+		GDKfree(works[i].r2);
+	}
+	GDKfree(works);
+	for (k = 0; k < 2; k++) {
+		GDKfree(rj.side[k].parts);
+		GDKfree(rj.side[k].bounds);
+	}
+	if (rc == GDK_SUCCEED)
+		return rc;
+  bailout:
+	BBPreclaim(r1);
+	BBPreclaim(r2);
+	return GDK_FAIL;
+}
+
 #define MASK_EQ		1
 #define MASK_LT		2
 #define MASK_GT		4
@@ -3813,6 +4174,12 @@ BATjoin(BAT **r1p, BAT **r2p, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 		   (BATordered(r) || BATordered_rev(r))) {
 		/* both sorted */
 		return mergejoin(r1, r2, l, r, sl, sr, nil_matches, 0, 0, 0, maxsize, t0, 0);
+	} else if (!lhash && !rhash && radixjoinable(l, r, lcount, rcount)) {
+		/* no hash to reuse and both large: partition both,
+		 * smallest on right */
+		if (lcount < rcount)
+			return radixjoin(r2, r1, r, l, sr, sl, nil_matches, t0);
+		return radixjoin(r1, r2, l, r, sl, sr, nil_matches, t0);
 	} else if (lhash && rhash) {
 		/* both have hash, smallest on right */
 		swap = lcount < rcount;
@@ -239,7 +239,7 @@ log_read_clear(logger *lg, trans *tr, char *name)
 }
 
 static int
-avoid_snapshot(logger *lg, log_bid bid)
+avoid_snapshot(logger *lg, log_bid bid, int ltid)
 {
 	if (BATcount(lg->snapshots_bid)-BATcount(lg->dsnapshots)) {
 		BUN p = log_find(lg->snapshots_bid, lg->dsnapshots, bid);
@@ -247,7 +247,7 @@ avoid_snapshot(logger *lg, log_bid bid)
 		if (p != BUN_NONE) {
 			int tid = *(int *) Tloc(lg->snapshots_tid, p);
 
-			if (lg->tid <= tid)
+			if (ltid <= tid)
 				return 1;
 		}
 	}
@@ -264,7 +264,7 @@ la_bat_clear(logger *lg, logaction *la)
 		fprintf(stderr, "#la_bat_clear %s\n", la->name);
 
 	/* do we need to skip these old updates */
-	if (avoid_snapshot(lg, bid))
+	if (avoid_snapshot(lg, bid, lg->tid))
 		return GDK_SUCCEED;
 
 	b = BATdescriptor(bid);
@@ -443,20 +443,13 @@ log_read_updates(logger *lg, trans *tr, logformat *l, char *name)
 	return res;
 }
 
+/* apply the changes of la to bat bid; this only touches that bat, so
+ * changes to different bats can be applied concurrently */
 static gdk_return
-la_bat_updates(logger *lg, logaction *la)
+la_bat_apply_updates(logaction *la, log_bid bid)
 {
-	log_bid bid = logger_find_bat(lg, la->name);
-	BAT *b;
-
-	if (bid == 0)
-		return GDK_SUCCEED; /* ignore bats no longer in the catalog */
-
-	/* do we need to skip these old updates */
-	if (avoid_snapshot(lg, bid))
-		return GDK_SUCCEED;
+	BAT *b = BATdescriptor(bid);
 
-	b = BATdescriptor(bid);
 	if (b == NULL)
 		return GDK_FAIL;
 	if (la->type == LOG_INSERT) {
@@ -505,6 +498,21 @@ la_bat_updates(logger *lg, logaction *la)
 	return GDK_SUCCEED;
 }
 
+static gdk_return
+la_bat_updates(logger *lg, logaction *la)
+{
+	log_bid bid = logger_find_bat(lg, la->name);
+
+	if (bid == 0)
+		return GDK_SUCCEED; /* ignore bats no longer in the catalog */
+
+	/* do we need to skip these old updates */
+	if (avoid_snapshot(lg, bid, lg->tid))
+		return GDK_SUCCEED;
+
+	return la_bat_apply_updates(la, bid);
+}
+
 static log_return
 log_read_destroy(logger *lg, trans *tr, char *name)
 {
@@ -765,6 +773,11 @@ la_destroy(logaction *c)
 		GDKfree(c->name);
 	if (c->b)
 		logbat_destroy(c->b);
+	if (c->uid)
+		logbat_destroy(c->uid);
+	c->name = NULL;
+	c->b = NULL;
+	c->uid = NULL;
 }
 
 static gdk_return
@@ -781,6 +794,8 @@ tr_grow(trans *tr)
 	/* cleanup the next */
 	tr->changes[tr->nr].name = NULL;
 	tr->changes[tr->nr].b = NULL;
+	tr->changes[tr->nr].uid = NULL;
+	tr->changes[tr->nr].tid = 0;
 	return GDK_SUCCEED;
 }
 
@@ -807,24 +822,163 @@ tr_abort(logger *lg, trans *tr)
 	return tr_destroy(tr);
 }
 
+/*
+ * Replaying a large log is dominated by applying the inserts and
+ * updates of the committed transactions.  Instead of applying them
+ * one at a time, tr_commit moves them to a pending list that collects
+ * the changes of consecutive transactions; tr_flush applies that list
+ * with one thread per bat at a time, keeping the order of the changes
+ * to each bat.  All other actions change the catalog of the logger,
+ * so the pending changes are flushed before they are applied.
+ */
+#define REPLAYFLUSHCNT	((BUN) 1 << 22)	/* max nr of pending tuples */
+
+typedef struct {
+	trans *pending;
+	lng *items;		/* bid << 32 | position in pending, sorted */
+	int *grps;		/* start of each group of items on one bat */
+	int ngrps;
+	int next;		/* next group to apply */
+	MT_Lock lock;
+} replay;
+
+typedef struct {
+	replay *rp;
+	gdk_return res;
+} replaywork;
+
+static void
+tr_applygroups(void *arg)
+{
+	replaywork *w = arg;
+	replay *rp = w->rp;
+	int g, i;
+
+	for (;;) {
+		MT_lock_set(&rp->lock);
+		g = rp->next++;
+		MT_lock_unset(&rp->lock);
+		if (g >= rp->ngrps)
+			break;
+		for (i = rp->grps[g]; i < rp->grps[g + 1] && w->res == GDK_SUCCEED; i++) {
+			lng it = rp->items[i];
+
+			w->res = la_bat_apply_updates(&rp->pending->changes[(int) (it & 0xFFFFFFFF)], (log_bid) (it >> 32));
+		}
+	}
+}
+
+static gdk_return
+tr_flush(logger *lg, trans *pending)
+{
+	replay rp;
+	replaywork *ws = NULL;
+	int i, n = 0, nthreads;
+	gdk_return res = GDK_SUCCEED;
+
+	if (pending->nr == 0)
+		return GDK_SUCCEED;
+	if (lg->debug & 1)
+		fprintf(stderr, "#tr_flush %d\n", pending->nr);
+
+	rp.pending = pending;
+	rp.items = GDKmalloc(pending->nr * sizeof(lng));
+	rp.grps = GDKmalloc((pending->nr + 1) * sizeof(int));
+	if (rp.items == NULL || rp.grps == NULL) {
+		res = GDK_FAIL;
+		goto bailout;
+	}
+	/* the catalog lookups (which may build a hash) are done here,
+	 * the threads only touch the bats they update */
+	for (i = 0; i < pending->nr; i++) {
+		logaction *la = &pending->changes[i];
+		log_bid bid = logger_find_bat(lg, la->name);
+
+		/* ignore bats no longer in the catalog and old
+		 * updates of snapshots */
+		if (bid == 0 || avoid_snapshot(lg, bid, la->tid))
+			continue;
+		rp.items[n++] = (lng) bid << 32 | i;
+	}
+	if (n > 1)
+		GDKqsort(rp.items, NULL, NULL, (size_t) n, sizeof(lng), 0, TYPE_lng);
+	rp.ngrps = 0;
+	for (i = 0; i < n; i++)
+		if (i == 0 || rp.items[i] >> 32 != rp.items[i - 1] >> 32)
+			rp.grps[rp.ngrps++] = i;
+	rp.grps[rp.ngrps] = n;
+	rp.next = 0;
+
+	nthreads = MIN(GDKnr_threads, rp.ngrps);
+	if (nthreads < 1)
+		nthreads = 1;
+	if ((ws = GDKmalloc(nthreads * sizeof(replaywork))) == NULL) {
+		res = GDK_FAIL;
+		goto bailout;
+	}
+	MT_lock_init(&rp.lock, "tr_flush");
+	for (i = 0; i < nthreads; i++) {
+		ws[i].rp = &rp;
+		ws[i].res = GDK_SUCCEED;
+	}
+	GDKparallel(nthreads, tr_applygroups, ws, sizeof(replaywork));
+	MT_lock_destroy(&rp.lock);
+	for (i = 0; i < nthreads; i++)
+		if (ws[i].res != GDK_SUCCEED)
+			res = GDK_FAIL;
+	/* only count the changes that were applied, not the skipped ones */
+	if (res == GDK_SUCCEED)
+		lg->changes += n;
+
+  bailout:
+	for (i = 0; i < pending->nr; i++)
+		la_destroy(&pending->changes[i]);
+	pending->nr = 0;
+	GDKfree(rp.items);
+	GDKfree(rp.grps);
+	GDKfree(ws);
+	return res;
+}
+
 static trans *
-tr_commit(logger *lg, trans *tr)
+tr_commit(logger *lg, trans *tr, trans *pending)
 {
+	BUN cnt = 0;
 	int i;
 
 	if (lg->debug & 1)
 		fprintf(stderr, "#tr_commit\n");
 
 	for (i = 0; i < tr->nr; i++) {
-		if (la_apply(lg, &tr->changes[i]) != GDK_SUCCEED) {
-			do {
-				tr = tr_abort(lg, tr);
-			} while (tr != NULL);
-			return (trans *) -1;
+		logaction *la = &tr->changes[i];
+
+		if (la->type == LOG_INSERT || la->type == LOG_UPDATE) {
+			if (tr_grow(pending) != GDK_SUCCEED)
+				goto bailout;
+			la->tid = lg->tid;
+			pending->changes[pending->nr++] = *la;
+			la->name = NULL;
+			la->b = NULL;
+			la->uid = NULL;
+			continue;
 		}
-		la_destroy(&tr->changes[i]);
+		if (tr_flush(lg, pending) != GDK_SUCCEED ||
+		    la_apply(lg, la) != GDK_SUCCEED)
+			goto bailout;
+		la_destroy(la);
 	}
+	for (i = 0; i < pending->nr; i++)
+		cnt += BATcount(pending->changes[i].b);
+	if ((pending->nr >= TR_SIZE || cnt >= REPLAYFLUSHCNT) &&
+	    tr_flush(lg, pending) != GDK_SUCCEED)
+		goto bailout;
 	return tr_destroy(tr);
+
+  bailout:
+	do {
+		tr = tr_abort(lg, tr);
+	} while (tr != NULL);
+	return (trans *) -1;
 }
 
 static gdk_return log_sequence_nrs(logger *lg);
@@ -918,17 +1072,25 @@ logger_open(logger *lg)
 	return GDK_SUCCEED;
 }
 
+static gdk_return log_sync(logger *lg);
+
 static void
 logger_close(logger *lg)
 {
+	/* the transactions not yet synced must not be lost with the
+	 * file, and a syncing committer must not see it go */
+	MT_lock_set(&lg->synclock);
+	if (log_sync(lg) != GDK_SUCCEED)
+		fprintf(stderr, "!ERROR: logger_close: sync failed\n");
 	close_stream(lg->log);
 	lg->log = NULL;
+	MT_lock_unset(&lg->synclock);
 }
 
 static gdk_return
 logger_readlog(logger *lg, char *filename)
 {
-	trans *tr = NULL;
+	trans *tr = NULL, *pending;
 	logformat l;
 	log_return err = LOG_OK;
 	time_t t0, t1;
@@ -959,6 +1121,11 @@ logger_readlog(logger *lg, char *filename)
 		 * something weird is going on */
 		return GDK_FAIL;
 	}
+	if ((pending = tr_create(NULL, 0)) == NULL) {
+		logger_close(lg);
+		GDKdebug = dbg;
+		return GDK_FAIL;
+	}
 	t0 = time(NULL);
 	if (lg->debug & 1) {
 		printf("# Start reading the write-ahead log '%s'\n", filename);
@@ -1030,7 +1197,7 @@ logger_readlog(logger *lg, char *filename)
 			else if (l.tid != l.nr)	/* abort record */
 				tr = tr_abort(lg, tr);
 			else
-				tr = tr_commit(lg, tr);
+				tr = tr_commit(lg, tr, pending);
 			break;
 		case LOG_SEQ:
 			err = log_read_seq(lg, &l);
@@ -1077,6 +1244,9 @@ logger_readlog(logger *lg, char *filename)
 			break;
 		}
 	}
+	if (err != LOG_ERR && tr_flush(lg, pending) != GDK_SUCCEED)
+		err = LOG_ERR;
+	tr_abort(lg, pending);
 	logger_close(lg);
 
 	/* remaining transactions are not committed, ie abort */
@@ -1851,6 +2021,15 @@ logger_new(int debug, const char *fn, const char *logdir, int version, preversio
 
 	lg->tid = 0;
 
+	MT_lock_init(&lg->synclock, "logger_sync");
+	MT_lock_init(&lg->statelock, "logger_state");
+	lg->written = lg->synced = 0;
+	lg->lastsync = GDKusec();
+	lg->commit_delay = GDKgetenv_int("gdk_commit_delay", 0);
+	lg->sync_interval = GDKgetenv_int("gdk_sync_interval", 0);
+	memset(&lg->stats, 0, sizeof(lg->stats));
+	lg->flushpos = 0;
+
 	lg->dbfarm_role = logger_set_logdir_path(filename, fn, logdir, shared);;
 	lg->fn = GDKstrdup(fn);
 	lg->dir = GDKstrdup(filename);
@@ -2024,6 +2203,8 @@ logger_destroy(logger *lg)
 	GDKfree(lg->fn);
 	GDKfree(lg->dir);
 	logger_close(lg);
+	MT_lock_destroy(&lg->synclock);
+	MT_lock_destroy(&lg->statelock);
 	GDKfree(lg);
 }
 
@@ -2109,12 +2290,83 @@ logger_exit(logger *lg)
 gdk_return
 logger_restart(logger *lg)
 {
+	lng t0 = GDKusec(), t;
+
 	if (logger_exit(lg) == GDK_SUCCEED &&
-	    logger_open(lg) == GDK_SUCCEED)
+	    logger_open(lg) == GDK_SUCCEED) {
+		t = GDKusec() - t0;
+		MT_lock_set(&lg->statelock);
+		lg->stats.checkpoints++;
+		lg->stats.ckptime = t;
+		if (t > lg->stats.maxckptime)
+			lg->stats.maxckptime = t;
+		lg->stats.flushprogress = 0;
+		MT_lock_unset(&lg->statelock);
+		lg->flushpos = 0;
 		return GDK_SUCCEED;
+	}
 	return GDK_FAIL;
 }
 
+/* Write out dirty bats of the catalog ahead of the next checkpoint,
+ * continuing where the previous call stopped, until about budget
+ * bytes are written; *done is set when the pass over the catalog is
+ * complete.  Only bats that were persistent at the last checkpoint
+ * are written: BBPsave first moves their committed images to the
+ * backup directory, from where a restart recovers them before the
+ * log is replayed.  The caller must keep the bats and the catalog
+ * from changing, i.e. keep the committers out; readers may carry on.
+ * The checkpoint then finds these bats clean. */
+gdk_return
+logger_flush_dirty(logger *lg, lng budget, lng *written, int *done)
+{
+	BAT *c = lg->catalog_bid;
+	BUN cnt = BATcount(c);
+	lng w = 0, nbats = 0;
+
+	*done = 0;
+	while (lg->flushpos < cnt && w < budget) {
+		oid pos = lg->flushpos++;
+		log_bid bid = *(log_bid *) Tloc(c, pos);
+		BAT *b;
+		lng sz = 0;
+
+		if (BUNfnd(lg->dcatalog, &pos) != BUN_NONE ||
+		    !BBPvalid(bid) ||
+		    !(BBP_status(bid) & BBPEXISTING) ||
+		    BBP_cache(bid) == NULL ||
+		    (b = BATdescriptor(bid)) == NULL)
+			continue;
+		if (!isVIEW(b) && BATdirty(b)) {
+			if (b->ttype && (b->batDirty || b->theap.dirty))
+				sz += (lng) b->theap.free;
+			if (b->tvheap && (b->batDirty || b->tvheap->dirty))
+				sz += (lng) b->tvheap->free;
+			if (BBPsave(b) != GDK_SUCCEED) {
+				BBPunfix(bid);
+				*written = w;
+				return GDK_FAIL;
+			}
+			w += sz;
+			nbats++;
+		}
+		BBPunfix(bid);
+	}
+	if (lg->flushpos >= cnt) {
+		lg->flushpos = 0;
+		*done = 1;
+	}
+	MT_lock_set(&lg->statelock);
+	lg->stats.flushbats += nbats;
+	lg->stats.flushbytes += w;
+	lg->stats.flushprogress = *done ? 100 : cnt ? (int) (lg->flushpos * 100 / cnt) : 0;
+	MT_lock_unset(&lg->statelock);
+	if (lg->debug & 1)
+		fprintf(stderr, "#logger_flush_dirty " LLFMT " bats " LLFMT " bytes\n", nbats, w);
+	*written = w;
+	return GDK_SUCCEED;
+}
+
 /* Clean-up write-ahead log files already persisted in the BATs.
  * Update the LOGFILE and delete all bak- files as well.
  */
@@ -2567,8 +2819,33 @@ pre_allocate(logger *lg)
 	return GDK_SUCCEED;
 }
 
+/*
+ * Ending a transaction is split in two: log_tend_delayed writes the
+ * end record while the caller still holds the store lock, and returns
+ * the sequence number of the transaction in the log. Once it has
+ * released the lock, the caller waits in log_tsync for that
+ * transaction to be on disk. Committers arriving while another one
+ * syncs queue up on the synclock; the first to get it syncs all
+ * transactions ended by then, the others find their work done. This
+ * way many small concurrent commits share one fsync.
+ *
+ * With gdk_commit_delay the syncing committer first waits that many
+ * msec for others to join. With gdk_sync_interval the log is synced at
+ * most once per that many msec, trading the durability of the last
+ * commits for throughput; the store manager syncs whatever is left.
+ */
 gdk_return
 log_tend(logger *lg)
+{
+	lng lsn;
+
+	if (log_tend_delayed(lg, &lsn) != GDK_SUCCEED)
+		return GDK_FAIL;
+	return log_tsync(lg, lsn);
+}
+
+gdk_return
+log_tend_delayed(logger *lg, lng *lsn)
 {
 	logformat l;
 	gdk_return res = GDK_SUCCEED;
@@ -2609,14 +2886,88 @@ log_tend(logger *lg)
 	if (res != GDK_SUCCEED ||
 	    log_write_format(lg, &l) != GDK_SUCCEED ||
 	    mnstr_flush(lg->log) ||
-	    mnstr_fsync(lg->log) ||
 	    pre_allocate(lg) != GDK_SUCCEED) {
 		fprintf(stderr, "!ERROR: log_tend: write failed\n");
 		return GDK_FAIL;
 	}
+	MT_lock_set(&lg->statelock);
+	*lsn = ++lg->written;
+	MT_lock_unset(&lg->statelock);
+	return GDK_SUCCEED;
+}
+
+/* sync all transactions ended so far, called with the synclock held */
+static gdk_return
+log_sync(logger *lg)
+{
+	lng target, batch;
+
+	MT_lock_set(&lg->statelock);
+	target = lg->written;
+	batch = target - lg->synced;
+	MT_lock_unset(&lg->statelock);
+	if (batch == 0 || lg->log == NULL)
+		return GDK_SUCCEED;
+	if (mnstr_fsync(lg->log)) {
+		fprintf(stderr, "!ERROR: log_tsync: sync failed\n");
+		return GDK_FAIL;
+	}
+	MT_lock_set(&lg->statelock);
+	lg->synced = target;
+	lg->lastsync = GDKusec();
+	lg->stats.syncs++;
+	if (batch > lg->stats.maxbatch)
+		lg->stats.maxbatch = batch;
+	MT_lock_unset(&lg->statelock);
+	if (lg->debug & 1)
+		fprintf(stderr, "#log_tsync " LLFMT " transactions\n", batch);
 	return GDK_SUCCEED;
 }
 
+/* Wait until the transaction with sequence number lsn is on disk; with
+ * lsn 0, only sync what is left over from the sync interval. */
+gdk_return
+log_tsync(logger *lg, lng lsn)
+{
+	lng t0 = GDKusec(), wait;
+	gdk_return res = GDK_SUCCEED;
+	int done;
+
+	MT_lock_set(&lg->synclock);
+	MT_lock_set(&lg->statelock);
+	done = lsn > 0 ? lg->synced >= lsn : lg->synced == lg->written;
+	MT_lock_unset(&lg->statelock);
+	if (!done) {
+		if (lg->sync_interval > 0 &&
+		    t0 - lg->lastsync < (lng) lg->sync_interval * 1000) {
+			/* relaxed durability: leave it to a later sync */
+		} else {
+			if (lsn > 0 && lg->commit_delay > 0)
+				MT_sleep_ms(lg->commit_delay);
+			res = log_sync(lg);
+		}
+	}
+	if (lsn > 0) {
+		wait = GDKusec() - t0;
+		MT_lock_set(&lg->statelock);
+		lg->stats.commits++;
+		lg->stats.latency += wait;
+		if (wait > lg->stats.maxlatency)
+			lg->stats.maxlatency = wait;
+		MT_lock_unset(&lg->statelock);
+	}
+	MT_lock_unset(&lg->synclock);
+	return res;
+}
+
+void
+logger_get_stats(logger *lg, logger_stats *st)
+{
+	MT_lock_set(&lg->statelock);
+	*st = lg->stats;
+	MT_lock_unset(&lg->statelock);
+}
+
 gdk_return
 log_abort(logger *lg)
 {
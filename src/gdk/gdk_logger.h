@@ -21,6 +21,7 @@ typedef struct logaction {
 	char *name;		/* optional */
 	BAT *b;			/* temporary bat with changes */
 	BAT *uid;		/* temporary bat with bun positions to update */
+	int tid;		/* logger tid at commit, for replayed updates */
 } logaction;
 
 /* during the recover process a number of transactions could be active */
@@ -37,6 +38,23 @@ typedef struct trans {
 typedef gdk_return (*preversionfix_fptr)(int oldversion, int newversion);
 typedef gdk_return (*postversionfix_fptr)(void *lg);
 
+/* Counters of the commits made durable by log_tsync and of the
+ * checkpoints (logger_restart) and the bats logger_flush_dirty wrote
+ * in between */
+typedef struct logger_stats {
+	lng commits;		/* transactions that waited for a sync */
+	lng syncs;		/* syncs of the log */
+	lng maxbatch;		/* most transactions made durable by one sync */
+	lng latency;		/* total usec committers waited */
+	lng maxlatency;		/* longest wait of a committer in usec */
+	lng checkpoints;	/* number of checkpoints */
+	lng ckptime;		/* usec the last checkpoint took */
+	lng maxckptime;		/* longest checkpoint in usec */
+	lng flushbats;		/* bats written before a checkpoint */
+	lng flushbytes;		/* bytes written before a checkpoint */
+	int flushprogress;	/* percentage of the catalog flushed in this pass */
+} logger_stats;
+
 typedef struct logger {
 	int debug;
 	lng changes;
@@ -70,6 +88,16 @@ typedef struct logger {
 				   commit). */
 	void *buf;
 	size_t bufsize;
+	/* group commit, see log_tsync */
+	MT_Lock synclock;	/* held by the thread syncing the log */
+	MT_Lock statelock;	/* protects the fields below */
+	lng written;		/* number of transactions ended in the log */
+	lng synced;		/* number of those known to be on disk */
+	lng lastsync;		/* GDKusec() of the last sync */
+	int commit_delay;	/* msec a syncing committer waits for others */
+	int sync_interval;	/* msec between syncs, 0 to sync every commit */
+	logger_stats stats;
+	BUN flushpos;		/* catalog position of logger_flush_dirty */
 } logger;
 
 /* Holds logger settings
@@ -123,6 +151,10 @@ gdk_export gdk_return log_delta(logger *lg, BAT *uid, BAT *uval, const char *n);
 
 gdk_export gdk_return log_tstart(logger *lg);	/* TODO return transaction id */
 gdk_export gdk_return log_tend(logger *lg);
+gdk_export gdk_return log_tend_delayed(logger *lg, lng *lsn);
+gdk_export gdk_return log_tsync(logger *lg, lng lsn);
+gdk_export void logger_get_stats(logger *lg, logger_stats *st);
+gdk_export gdk_return logger_flush_dirty(logger *lg, lng budget, lng *written, int *done);
 gdk_export gdk_return log_abort(logger *lg);
 
 gdk_export gdk_return log_sequence(logger *lg, int seq, lng id);
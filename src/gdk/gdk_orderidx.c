@@ -10,7 +10,7 @@
 #include "gdk.h"
 #include "gdk_private.h"
 
-#define ORDERIDX_VERSION	((oid) 3)
+#define ORDERIDX_VERSION	((oid) 4)
 
 #ifdef PERSISTENTIDX
 struct idxsync {
@@ -54,17 +54,19 @@ BATidxsync(void *arg)
 }
 #endif
 
-/* return TRUE if we have a orderidx on the tail, even if we need to read
- * one from disk */
-int
-BATcheckorderidx(BAT *b)
+/* The order index heap starts with ORDERIDXOFF header values: the
+ * version, the number of values covered, whether the index is
+ * stable, and the length of the first sorted run.  The oids of the
+ * values appended after the index was built follow in a second
+ * sorted run, the delta, which is empty for a freshly built index
+ * (see OIDXappend). */
+
+/* load a persisted order index covering cnt values if there is one;
+ * must be called with the hash lock held; returns TRUE if b has an
+ * order index afterwards */
+static int
+oidx_load(BAT *b, BUN cnt)
 {
-	int ret;
-	lng t = 0;
-
-	assert(b->batCacheid > 0);
-	ALGODEBUG t = GDKusec();
-	MT_lock_set(&GDKhashLock(b->batCacheid));
 	if (b->torderidx == (Heap *) 1) {
 		Heap *hp;
 		const char *nme = BBP_physical(b->batCacheid);
@@ -87,15 +89,15 @@ BATcheckorderidx(BAT *b)
 					    ((oid) 1 << 24) |
 #endif
 					    ORDERIDX_VERSION) &&
-				    hdata[1] == (oid) BATcount(b) &&
+				    hdata[1] == (oid) cnt &&
 				    (hdata[2] == 0 || hdata[2] == 1) &&
+				    hdata[3] <= hdata[1] &&
 				    fstat(fd, &st) == 0 &&
 				    st.st_size >= (off_t) (hp->size = hp->free = (ORDERIDXOFF + hdata[1]) * SIZEOF_OID) &&
 				    HEAPload(hp, nme, "torderidx", 0) == GDK_SUCCEED) {
 					close(fd);
 					b->torderidx = hp;
 					ALGODEBUG fprintf(stderr, "#BATcheckorderidx: reusing persisted orderidx %d\n", b->batCacheid);
-					MT_lock_unset(&GDKhashLock(b->batCacheid));
 					return 1;
 				}
 				close(fd);
@@ -107,9 +109,24 @@ BATcheckorderidx(BAT *b)
 		GDKfree(hp);
 		GDKclrerr();	/* we're not currently interested in errors */
 	}
-	ret = b->torderidx != NULL;
+	return b->torderidx != NULL;
+}
+
+/* return TRUE if we have a orderidx on the tail, even if we need to read
+ * one from disk */
+int
+BATcheckorderidx(BAT *b)
+{
+	int ret, ondisk;
+	lng t = 0;
+
+	assert(b->batCacheid > 0);
+	ALGODEBUG t = GDKusec();
+	MT_lock_set(&GDKhashLock(b->batCacheid));
+	ondisk = b->torderidx == (Heap *) 1;
+	ret = oidx_load(b, BATcount(b));
 	MT_lock_unset(&GDKhashLock(b->batCacheid));
-	ALGODEBUG if (ret) fprintf(stderr, "#BATcheckorderidx: already has orderidx %d, waited " LLFMT " usec\n", b->batCacheid, GDKusec() - t);
+	ALGODEBUG if (ret && !ondisk) fprintf(stderr, "#BATcheckorderidx: already has orderidx %d, waited " LLFMT " usec\n", b->batCacheid, GDKusec() - t);
 	return ret;
 }
 
@@ -140,6 +157,7 @@ createOIDXheap(BAT *b, int stable)
 	*mv++ = ORDERIDX_VERSION;
 	*mv++ = (oid) BATcount(b);
 	*mv++ = (oid) !!stable;
+	*mv++ = (oid) BATcount(b);
 	return m;
 }
 
@@ -166,78 +184,6 @@ persistOIDX(BAT *b)
 #endif
 }
 
-gdk_return
-BATorderidx(BAT *b, int stable)
-{
-	Heap *m;
-	oid *restrict mv;
-	oid seq;
-	BUN p, q;
-	BAT *bn = NULL;
-
-	if (BATcheckorderidx(b))
-		return GDK_SUCCEED;
-	MT_lock_set(&GDKhashLock(b->batCacheid));
-	if (b->torderidx) {
-		MT_lock_unset(&GDKhashLock(b->batCacheid));
-		return GDK_SUCCEED;
-	}
-	if ((m = createOIDXheap(b, stable)) == NULL) {
-		MT_lock_unset(&GDKhashLock(b->batCacheid));
-		return GDK_FAIL;
-	}
-
-	mv = (oid *) m->base + ORDERIDXOFF;
-
-	seq = b->hseqbase;
-	for (p = 0, q = BATcount(b); p < q; p++)
-		mv[p] = seq + p;
-
-	if (!BATtdense(b)) {
-		/* we need to sort a copy of the column so as not to
-		 * change the original */
-		bn = COLcopy(b, b->ttype, TRUE, TRANSIENT);
-		if (bn == NULL) {
-			HEAPfree(m, 1);
-			GDKfree(m);
-			MT_lock_unset(&GDKhashLock(b->batCacheid));
-			return GDK_FAIL;
-		}
-		if (stable) {
-			if (GDKssort(Tloc(bn, 0), mv,
-				     bn->tvheap ? bn->tvheap->base : NULL,
-				     BATcount(bn), Tsize(bn), SIZEOF_OID,
-				     bn->ttype) != GDK_SUCCEED) {
-				HEAPfree(m, 1);
-				GDKfree(m);
-				MT_lock_unset(&GDKhashLock(b->batCacheid));
-				BBPunfix(bn->batCacheid);
-				return GDK_FAIL;
-			}
-		} else {
-			GDKqsort(Tloc(bn, 0), mv,
-				 bn->tvheap ? bn->tvheap->base : NULL,
-				 BATcount(bn), Tsize(bn), SIZEOF_OID,
-				 bn->ttype);
-		}
-		/* we must unfix after releasing the lock since we
-		 * might get deadlock otherwise (we're holding a lock
-		 * based on b->batCacheid; unfix tries to get a lock
-		 * based on bn->batCacheid, usually but (crucially)
-		 * not always a different lock) */
-	}
-
-	b->torderidx = m;
-	b->batDirtydesc = TRUE;
-	persistOIDX(b);
-	MT_lock_unset(&GDKhashLock(b->batCacheid));
-
-	if (bn)
-		BBPunfix(bn->batCacheid);
-
-	return GDK_SUCCEED;
-}
-
 #define BINARY_MERGE(TYPE)						\
 	do {								\
 		TYPE *v = (TYPE *) Tloc(b, 0);				\
@@ -285,13 +231,13 @@ BATorderidx(BAT *b, int stable)
 			if ((chld = left_child(cur)) < n_ar &&		\
 			    (minhp[chld] < minhp[min] ||		\
 			     (minhp[chld] == minhp[min] &&		\
-			      *p[cur] < *p[min]))) {			\
+			      *p[chld] < *p[min]))) {			\
 				min = chld;				\
 			}						\
 			if ((chld = right_child(cur)) < n_ar &&		\
 			    (minhp[chld] < minhp[min] ||		\
 			     (minhp[chld] == minhp[min] &&		\
-			      *p[cur] < *p[min]))) {			\
+			      *p[chld] < *p[min]))) {			\
 				min = chld;				\
 			}						\
 			if (min != cur) {				\
@@ -307,7 +253,7 @@ BATorderidx(BAT *b, int stable)
 		TYPE *minhp, t;						\
 		TYPE *v = (TYPE *) Tloc(b, 0);				\
 		if ((minhp = (TYPE *) GDKmalloc(sizeof(TYPE)*n_ar)) == NULL) { \
-			goto bailout;					\
+			return GDK_FAIL;				\
 		}							\
 		/* init min heap */					\
 		for (i = 0; i < n_ar; i++) {				\
@@ -347,70 +293,22 @@ BATorderidx(BAT *b, int stable)
 		GDKfree(minhp);						\
 	} while (0)
 
-gdk_return
-GDKmergeidx(BAT *b, BAT**a, int n_ar)
+/* Merge the n_ar runs of oids p[i] up to q[i] into mv.  Each run is
+ * ordered on the values of b, the result is too; equal values are
+ * ordered on oid, so that merging stable runs gives a stable
+ * result.  p and q are used as work space. */
+static gdk_return
+OIDXmerge(BAT *b, oid *restrict mv, oid **p, oid **q, int n_ar)
 {
-	Heap *m;
 	int i;
-	size_t nmelen;
-	oid *restrict mv;
-	const char *nme = BBP_physical(b->batCacheid);
-
-	if (BATcheckorderidx(b))
-		return GDK_SUCCEED;
-	MT_lock_set(&GDKhashLock(b->batCacheid));
-	if (b->torderidx) {
-		MT_lock_unset(&GDKhashLock(b->batCacheid));
-		return GDK_SUCCEED;
-	}
-	nmelen = strlen(nme) + 12;
-	if ((m = GDKzalloc(sizeof(Heap))) == NULL ||
-	    (m->farmid = BBPselectfarm(b->batRole, b->ttype, orderidxheap)) < 0 ||
-	    (m->filename = GDKmalloc(nmelen)) == NULL ||
-	    snprintf(m->filename, nmelen, "%s.torderidx", nme) < 0 ||
-	    HEAPalloc(m, BATcount(b) + ORDERIDXOFF, SIZEOF_OID) != GDK_SUCCEED) {
-		if (m)
-			GDKfree(m->filename);
-		GDKfree(m);
-		MT_lock_unset(&GDKhashLock(b->batCacheid));
-		return GDK_FAIL;
-	}
-	m->free = (BATcount(b) + ORDERIDXOFF) * SIZEOF_OID;
-
-	mv = (oid *) m->base;
-	*mv++ = ORDERIDX_VERSION;
-	*mv++ = (oid) BATcount(b);
-	/* all participating indexes must be stable for the combined
-	 * index to be stable */
-	*mv = 1;
-	for (i = 0; i < n_ar; i++) {
-		if ((*mv &= ((const oid *) a[i]->torderidx->base)[2]) == 0)
-			break;
-	}
-	mv++;
 
 	if (n_ar == 1) {
-		/* One oid order bat, nothing to merge */
-		assert(BATcount(a[0]) == BATcount(b));
-		assert((VIEWtparent(a[0]) == b->batCacheid ||
-			VIEWtparent(a[0]) == VIEWtparent(b)) &&
-		       a[0]->torderidx);
-		memcpy(mv, (const oid *) a[0]->torderidx->base + ORDERIDXOFF,
-		       BATcount(a[0]) * SIZEOF_OID);
+		/* One run, nothing to merge */
+		memcpy(mv, p[0], (q[0] - p[0]) * SIZEOF_OID);
 	} else if (n_ar == 2) {
 		/* sort merge with 1 comparison per BUN */
-		const oid *restrict p0, *restrict p1, *q0, *q1;
-		assert(BATcount(a[0]) + BATcount(a[1]) == BATcount(b));
-		assert((VIEWtparent(a[0]) == b->batCacheid ||
-			VIEWtparent(a[0]) == VIEWtparent(b)) &&
-		       a[0]->torderidx);
-		assert((VIEWtparent(a[1]) == b->batCacheid ||
-			VIEWtparent(a[1]) == VIEWtparent(b)) &&
-		       a[1]->torderidx);
-		p0 = (const oid *) a[0]->torderidx->base + ORDERIDXOFF;
-		p1 = (const oid *) a[1]->torderidx->base + ORDERIDXOFF;
-		q0 = p0 + BATcount(a[0]);
-		q1 = p1 + BATcount(a[1]);
+		const oid *restrict p0 = p[0], *restrict p1 = p[1];
+		const oid *q0 = q[0], *q1 = q[1];
 
 		switch (ATOMstorage(b->ttype)) {
 		case TYPE_bte: BINARY_MERGE(bte); break;
@@ -426,34 +324,11 @@ GDKmergeidx(BAT *b, BAT**a, int n_ar)
 		default:
 			/* TODO: support strings, date, timestamps etc. */
 			assert(0);
-			HEAPfree(m, 1);
-			GDKfree(m);
-			MT_lock_unset(&GDKhashLock(b->batCacheid));
 			return GDK_FAIL;
 		}
-
 	} else {
 		/* use min-heap */
-		oid **p, **q, *t_oid;
-
-		p = (oid **) GDKmalloc(n_ar*sizeof(oid *));
-		q = (oid **) GDKmalloc(n_ar*sizeof(oid *));
-		if (p == NULL || q == NULL) {
-		  bailout:
-			GDKfree(p);
-			GDKfree(q);
-			HEAPfree(m, 1);
-			GDKfree(m);
-			MT_lock_unset(&GDKhashLock(b->batCacheid));
-			return GDK_FAIL;
-		}
-		for (i = 0; i < n_ar; i++) {
-			assert((VIEWtparent(a[i]) == b->batCacheid ||
-				VIEWtparent(a[i]) == VIEWtparent(b)) &&
-			       a[i]->torderidx);
-			p[i] = (oid *) a[i]->torderidx->base + ORDERIDXOFF;
-			q[i] = p[i] + BATcount(a[i]);
-		}
+		oid *t_oid;
 
 		switch (ATOMstorage(b->ttype)) {
 		case TYPE_bte: NWAY_MERGE(bte); break;
@@ -471,11 +346,254 @@ GDKmergeidx(BAT *b, BAT**a, int n_ar)
 		default:
 			/* TODO: support strings, date, timestamps etc. */
 			assert(0);
+			return GDK_FAIL;
+		}
+	}
+	return GDK_SUCCEED;
+}
+
+/* Large columns are sorted in parts, each part by its own thread, and
+ * the sorted parts are merged with OIDXmerge. */
+#define OIDXPARMINCNT	((BUN) 1 << 20)	/* smaller columns are sorted by one thread */
+
+typedef struct {
+	BAT *bn;		/* copy of the column, sorted part by part */
+	oid *mv;		/* the oids, sorted along with bn */
+	BUN lo, hi;		/* the part sorted by this thread */
+	int stable;
+	gdk_return ret;
+} oidxpart;
+
+static void
+OIDXsortpart(void *arg)
+{
+	oidxpart *op = arg;
+	BAT *bn = op->bn;
+
+	if (op->stable) {
+		op->ret = GDKssort(Tloc(bn, op->lo), op->mv + op->lo, NULL,
+				   op->hi - op->lo, Tsize(bn), SIZEOF_OID,
+				   bn->ttype);
+	} else {
+		GDKqsort(Tloc(bn, op->lo), op->mv + op->lo, NULL,
+			 op->hi - op->lo, Tsize(bn), SIZEOF_OID, bn->ttype);
+		op->ret = GDK_SUCCEED;
+	}
+}
+
+/* sort bn, a copy of b, in nparts parts in parallel and merge the
+ * resulting runs of oids into mv */
+static gdk_return
+OIDXparallel(BAT *b, BAT *bn, oid *restrict mv, int stable, int nparts)
+{
+	BUN cnt = BATcount(b);
+	oidxpart *ps;
+	oid *tmp, **p, **q;
+	gdk_return ret = GDK_FAIL;
+	int i;
+	lng t0 = 0;
+
+	ALGODEBUG t0 = GDKusec();
+	ps = GDKmalloc(nparts * sizeof(oidxpart));
+	tmp = GDKmalloc(cnt * SIZEOF_OID);
+	p = GDKmalloc(nparts * sizeof(oid *));
+	q = GDKmalloc(nparts * sizeof(oid *));
+	if (ps == NULL || tmp == NULL || p == NULL || q == NULL)
+		goto bailout;
+	memcpy(tmp, mv, cnt * SIZEOF_OID);
+	for (i = 0; i < nparts; i++) {
+		ps[i].bn = bn;
+		ps[i].mv = tmp;
+		ps[i].lo = i * (cnt / nparts);
+		ps[i].hi = i == nparts - 1 ? cnt : (i + 1) * (cnt / nparts);
+		ps[i].stable = stable;
+		ps[i].ret = GDK_FAIL;
+	}
+	GDKparallel(nparts, OIDXsortpart, ps, sizeof(oidxpart));
+	for (i = 0; i < nparts; i++) {
+		if (ps[i].ret != GDK_SUCCEED)
 			goto bailout;
+		p[i] = tmp + ps[i].lo;
+		q[i] = tmp + ps[i].hi;
+	}
+	GDKprogress(cnt, 2 * cnt);
+	ret = OIDXmerge(b, mv, p, q, nparts);
+	GDKprogress(2 * cnt, 2 * cnt);
+	ALGODEBUG fprintf(stderr, "#BATorderidx(%s#" BUNFMT "): sorted %d parts "
+			  "in parallel (" LLFMT " usec)\n", BATgetId(b), cnt,
+			  nparts, GDKusec() - t0);
+  bailout:
+	GDKfree(ps);
+	GDKfree(tmp);
+	GDKfree(p);
+	GDKfree(q);
+	return ret;
+}
+
+gdk_return
+BATorderidx(BAT *b, int stable)
+{
+	Heap *m;
+	oid *restrict mv;
+	oid seq;
+	BUN p, q;
+	BAT *bn = NULL;
+	int nparts = 1;
+
+	if (BATcheckorderidx(b))
+		return GDK_SUCCEED;
+	MT_lock_set(&GDKhashLock(b->batCacheid));
+	if (b->torderidx) {
+		MT_lock_unset(&GDKhashLock(b->batCacheid));
+		return GDK_SUCCEED;
+	}
+	if ((m = createOIDXheap(b, stable)) == NULL) {
+		MT_lock_unset(&GDKhashLock(b->batCacheid));
+		return GDK_FAIL;
+	}
+
+	mv = (oid *) m->base + ORDERIDXOFF;
+
+	seq = b->hseqbase;
+	for (p = 0, q = BATcount(b); p < q; p++)
+		mv[p] = seq + p;
+
+	if (!BATtdense(b)) {
+		/* we need to sort a copy of the column so as not to
+		 * change the original */
+		bn = COLcopy(b, b->ttype, TRUE, TRANSIENT);
+		if (bn == NULL) {
+			HEAPfree(m, 1);
+			GDKfree(m);
+			MT_lock_unset(&GDKhashLock(b->batCacheid));
+			return GDK_FAIL;
+		}
+		switch (ATOMbasetype(b->ttype)) {
+		case TYPE_bte:
+		case TYPE_sht:
+		case TYPE_int:
+		case TYPE_lng:
+#ifdef HAVE_HGE
+		case TYPE_hge:
+#endif
+		case TYPE_flt:
+		case TYPE_dbl:
+			if (GDKnr_threads > 1 && BATcount(b) >= OIDXPARMINCNT)
+				nparts = (int) MIN((BUN) GDKnr_threads,
+						   BATcount(b) / (OIDXPARMINCNT / 4));
+			break;
+		default:
+			break;
 		}
+		if (nparts > 1) {
+			if (OIDXparallel(b, bn, mv, stable, nparts) != GDK_SUCCEED) {
+				HEAPfree(m, 1);
+				GDKfree(m);
+				MT_lock_unset(&GDKhashLock(b->batCacheid));
+				BBPunfix(bn->batCacheid);
+				return GDK_FAIL;
+			}
+		} else if (stable) {
+			if (GDKssort(Tloc(bn, 0), mv,
+				     bn->tvheap ? bn->tvheap->base : NULL,
+				     BATcount(bn), Tsize(bn), SIZEOF_OID,
+				     bn->ttype) != GDK_SUCCEED) {
+				HEAPfree(m, 1);
+				GDKfree(m);
+				MT_lock_unset(&GDKhashLock(b->batCacheid));
+				BBPunfix(bn->batCacheid);
+				return GDK_FAIL;
+			}
+		} else {
+			GDKqsort(Tloc(bn, 0), mv,
+				 bn->tvheap ? bn->tvheap->base : NULL,
+				 BATcount(bn), Tsize(bn), SIZEOF_OID,
+				 bn->ttype);
+		}
+		/* we must unfix after releasing the lock since we
+		 * might get deadlock otherwise (we're holding a lock
+		 * based on b->batCacheid; unfix tries to get a lock
+		 * based on bn->batCacheid, usually but (crucially)
+		 * not always a different lock) */
+	}
+
+	b->torderidx = m;
+	b->batDirtydesc = TRUE;
+	persistOIDX(b);
+	MT_lock_unset(&GDKhashLock(b->batCacheid));
+
+	if (bn)
+		BBPunfix(bn->batCacheid);
+
+	return GDK_SUCCEED;
+}
+
+gdk_return
+GDKmergeidx(BAT *b, BAT**a, int n_ar)
+{
+	Heap *m;
+	int i;
+	size_t nmelen;
+	oid *restrict mv;
+	oid **p = NULL, **q = NULL;
+	const char *nme = BBP_physical(b->batCacheid);
+
+	if (BATcheckorderidx(b))
+		return GDK_SUCCEED;
+	MT_lock_set(&GDKhashLock(b->batCacheid));
+	if (b->torderidx) {
+		MT_lock_unset(&GDKhashLock(b->batCacheid));
+		return GDK_SUCCEED;
+	}
+	nmelen = strlen(nme) + 12;
+	if ((m = GDKzalloc(sizeof(Heap))) == NULL ||
+	    (m->farmid = BBPselectfarm(b->batRole, b->ttype, orderidxheap)) < 0 ||
+	    (m->filename = GDKmalloc(nmelen)) == NULL ||
+	    snprintf(m->filename, nmelen, "%s.torderidx", nme) < 0 ||
+	    HEAPalloc(m, BATcount(b) + ORDERIDXOFF, SIZEOF_OID) != GDK_SUCCEED) {
+		if (m)
+			GDKfree(m->filename);
+		GDKfree(m);
+		MT_lock_unset(&GDKhashLock(b->batCacheid));
+		return GDK_FAIL;
+	}
+	m->free = (BATcount(b) + ORDERIDXOFF) * SIZEOF_OID;
+
+	mv = (oid *) m->base;
+	*mv++ = ORDERIDX_VERSION;
+	*mv++ = (oid) BATcount(b);
+	/* all participating indexes must be stable for the combined
+	 * index to be stable */
+	*mv = 1;
+	for (i = 0; i < n_ar; i++) {
+		if ((*mv &= ((const oid *) a[i]->torderidx->base)[2]) == 0)
+			break;
+	}
+	mv++;
+	*mv++ = (oid) BATcount(b);
+
+	p = (oid **) GDKmalloc(n_ar * sizeof(oid *));
+	q = (oid **) GDKmalloc(n_ar * sizeof(oid *));
+	if (p == NULL || q == NULL)
+		goto bailout;
+	for (i = 0; i < n_ar; i++) {
+		assert((VIEWtparent(a[i]) == b->batCacheid ||
+			VIEWtparent(a[i]) == VIEWtparent(b)) &&
+		       a[i]->torderidx);
+		p[i] = (oid *) a[i]->torderidx->base + ORDERIDXOFF;
+		q[i] = p[i] + BATcount(a[i]);
+	}
+	if (OIDXmerge(b, mv, p, q, n_ar) != GDK_SUCCEED) {
+	  bailout:
 		GDKfree(p);
 		GDKfree(q);
+		HEAPfree(m, 1);
+		GDKfree(m);
+		MT_lock_unset(&GDKhashLock(b->batCacheid));
+		return GDK_FAIL;
 	}
+	GDKfree(p);
+	GDKfree(q);
 
 #ifdef PERSISTENTIDX
 	if ((BBP_status(b->batCacheid) & BBPEXISTING) &&
@@ -499,6 +617,164 @@ GDKmergeidx(BAT *b, BAT**a, int n_ar)
 	return GDK_SUCCEED;
 }
 
+/* merge the delta of the order index of b into its first run; this
+ * rewrites the index in place, so it must only be called while b is
+ * being appended to, with the hash lock held */
+static gdk_return
+oidx_fold(BAT *b)
+{
+	Heap *m = b->torderidx;
+	oid *restrict mv = (oid *) m->base + ORDERIDXOFF;
+	BUN base = ORDERIDXBASE(b), cnt = (BUN) ((oid *) m->base)[1];
+	oid *tmp, *p[2], *q[2];
+
+	if (base == cnt)
+		return GDK_SUCCEED;
+	if ((tmp = GDKmalloc(cnt * SIZEOF_OID)) == NULL)
+		return GDK_FAIL;
+	p[0] = mv;
+	q[0] = p[1] = mv + base;
+	q[1] = mv + cnt;
+	if (OIDXmerge(b, tmp, p, q, 2) != GDK_SUCCEED) {
+		GDKfree(tmp);
+		return GDK_FAIL;
+	}
+	memcpy(mv, tmp, cnt * SIZEOF_OID);
+	GDKfree(tmp);
+	((oid *) m->base)[3] = (oid) cnt;
+	m->dirty = TRUE;
+	return GDK_SUCCEED;
+}
+
+/* Extend the order index of b to cover the values appended to it, cnt
+ * being the number of values b had before the append.  Instead of
+ * sorting everything again, the oids of the appended values are
+ * sorted and merged into the second run of the index, the delta,
+ * which searches consult next to the first run (see ORDERfnddelta).
+ * Once the delta outgrows an eighth of the first run, the two runs
+ * are merged into one. */
+void
+OIDXappend(BAT *b, BUN cnt)
+{
+	Heap *m;
+	oid *restrict mv;
+	oid *tmp = NULL, *p[2], *q[2];
+	BUN base, ncnt = BATcount(b), i;
+
+	if (b->torderidx == NULL || ncnt == cnt)
+		return;
+	assert(!VIEWtparent(b));
+	switch (ATOMstorage(b->ttype)) {
+	case TYPE_bte:
+	case TYPE_sht:
+	case TYPE_int:
+	case TYPE_lng:
+#ifdef HAVE_HGE
+	case TYPE_hge:
+#endif
+	case TYPE_flt:
+	case TYPE_dbl:
+		break;
+	default:
+		/* OIDXmerge can't merge the delta of other types */
+		OIDXdestroy(b);
+		return;
+	}
+	MT_lock_set(&GDKhashLock(b->batCacheid));
+	if (!oidx_load(b, cnt)) {
+		MT_lock_unset(&GDKhashLock(b->batCacheid));
+		return;
+	}
+	m = b->torderidx;
+	base = ORDERIDXBASE(b);
+	if (HEAPextend(m, (ORDERIDXOFF + ncnt) * SIZEOF_OID, 1) != GDK_SUCCEED)
+		goto bailout;
+	mv = (oid *) m->base + ORDERIDXOFF;
+	for (i = cnt; i < ncnt; i++)
+		mv[i] = b->hseqbase + i;
+	if (ncnt - cnt == 1) {
+		/* insert a single oid after those of equal values */
+		if (cnt > base) {
+			i = binsearch(mv, b->hseqbase, b->ttype, Tloc(b, 0),
+				      NULL, b->twidth, base, cnt,
+				      Tloc(b, cnt), 1, 1);
+			memmove(mv + i + 1, mv + i, (cnt - i) * SIZEOF_OID);
+			mv[i] = b->hseqbase + cnt;
+		}
+	} else {
+		/* sort a copy of the appended values along with their
+		 * oids and merge the result with the delta */
+		if ((tmp = GDKmalloc((ncnt - base) * MAX(SIZEOF_OID, Tsize(b)))) == NULL)
+			goto bailout;
+		memcpy(tmp, Tloc(b, cnt), (ncnt - cnt) * Tsize(b));
+		if (GDKssort(tmp, mv + cnt, NULL, ncnt - cnt, Tsize(b),
+			     SIZEOF_OID, b->ttype) != GDK_SUCCEED)
+			goto bailout;
+		if (cnt > base) {
+			p[0] = mv + base;
+			q[0] = p[1] = mv + cnt;
+			q[1] = mv + ncnt;
+			if (OIDXmerge(b, tmp, p, q, 2) != GDK_SUCCEED)
+				goto bailout;
+			memcpy(mv + base, tmp, (ncnt - base) * SIZEOF_OID);
+		}
+		GDKfree(tmp);
+		tmp = NULL;
+	}
+	((oid *) m->base)[1] = (oid) ncnt;
+	m->free = (ORDERIDXOFF + ncnt) * SIZEOF_OID;
+	m->dirty = TRUE;
+	if (ncnt - base > base / 8 && oidx_fold(b) != GDK_SUCCEED)
+		goto bailout;
+	ALGODEBUG fprintf(stderr, "#OIDXappend(b=%s#" BUNFMT "): "
+			  "extended orderidx, delta " BUNFMT "\n",
+			  BATgetId(b), ncnt, ncnt - ORDERIDXBASE(b));
+	MT_lock_unset(&GDKhashLock(b->batCacheid));
+	return;
+
+  bailout:
+	GDKfree(tmp);
+	MT_lock_unset(&GDKhashLock(b->batCacheid));
+	OIDXdestroy(b);
+	GDKclrerr();
+}
+
+/* Copy the order index of b as a single sorted run into mv, which
+ * has room for BATcount(b) oids, merging the delta into the copy if
+ * there is one.  The index itself is not changed: other threads may
+ * be reading it without holding the lock. */
+gdk_return
+OIDXcopy(BAT *b, oid *restrict mv)
+{
+	Heap *m;
+	oid *o, *p[2], *q[2];
+	BUN base, cnt;
+	gdk_return ret = GDK_SUCCEED;
+	lng t0 = 0;
+
+	ALGODEBUG t0 = GDKusec();
+	MT_lock_set(&GDKhashLock(b->batCacheid));
+	m = b->torderidx;
+	assert(m != NULL && m != (Heap *) 1);
+	o = (oid *) m->base + ORDERIDXOFF;
+	base = ORDERIDXBASE(b);
+	cnt = (BUN) ((oid *) m->base)[1];
+	assert(cnt == BATcount(b));
+	if (base == cnt) {
+		memcpy(mv, o, cnt * SIZEOF_OID);
+	} else {
+		p[0] = o;
+		q[0] = p[1] = o + base;
+		q[1] = o + cnt;
+		ret = OIDXmerge(b, mv, p, q, 2);
+		ALGODEBUG fprintf(stderr, "#OIDXcopy(b=%s#" BUNFMT "): "
+				  "merged delta (" LLFMT " usec)\n",
+				  BATgetId(b), BATcount(b), GDKusec() - t0);
+	}
+	MT_lock_unset(&GDKhashLock(b->batCacheid));
+	return ret;
+}
+
 void
 OIDXfree(BAT *b)
 {
@@ -508,6 +784,19 @@ OIDXfree(BAT *b)
 		MT_lock_set(&GDKhashLock(b->batCacheid));
 		if ((hp = b->torderidx) != NULL && hp != (Heap *) 1) {
 			b->torderidx = (Heap *) 1;
+			/* an order index that was persisted and extended
+			 * since is saved again */
+			if (hp->storage == STORE_MEM &&
+			    hp->dirty &&
+			    ((oid *) hp->base)[0] & ((oid) 1 << 24) &&
+			    GDKsave(hp->farmid, hp->filename, NULL, hp->base,
+				    hp->free, STORE_MEM, FALSE) != GDK_SUCCEED) {
+				/* if saving failed, remove */
+				GDKunlink(hp->farmid, BATDIR,
+					  BBP_physical(b->batCacheid),
+					  "torderidx");
+				b->torderidx = NULL;
+			}
 			HEAPfree(hp, 0);
 			GDKfree(hp);
 		}
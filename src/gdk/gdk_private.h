@@ -184,6 +184,8 @@ __hidden gdk_return HEAPshrink(Heap *h, size_t size)
 	__attribute__((__visibility__("hidden")));
 __hidden int HEAPwarm(Heap *h)
 	__attribute__((__visibility__("hidden")));
+__hidden void IMPSappend(BAT *b, BUN cnt)
+	__attribute__((__visibility__("hidden")));
 __hidden void IMPSfree(BAT *b)
 	__attribute__((__visibility__("hidden")));
 __hidden int IMPSgetbin(int tpe, bte bits, const char *restrict bins, const void *restrict v)
@@ -198,8 +200,12 @@ __hidden void *MT_mremap(const char *path, int mode, void *old_address, size_t o
 	__attribute__((__visibility__("hidden")));
 __hidden int MT_msync(void *p, size_t len)
 	__attribute__((__visibility__("hidden")));
+__hidden void OIDXappend(BAT *b, BUN cnt)
+	__attribute__((__visibility__("hidden")));
 __hidden void OIDXfree(BAT *b)
 	__attribute__((__visibility__("hidden")));
+__hidden BUN ORDERfnddelta(BAT *b, const void *v, int last)
+	__attribute__((__visibility__("hidden")));
 __hidden void persistOIDX(BAT *b)
 	__attribute__((__visibility__("hidden")));
 __hidden gdk_return rangejoin(BAT *r1, BAT *r2, BAT *l, BAT *rl, BAT *rh, BAT *sl, BAT *sr, int li, int hi, BUN maxsize)
@@ -246,6 +252,8 @@ struct Imprints {
 	void *dict;		/* pointer into imprints heap (dictionary)    */
 	BUN impcnt;		/* counter for imprints                       */
 	BUN dictcnt;		/* counter for cache dictionary               */
+	BUN pages;		/* room for imprints in pages                 */
+	BUN drift;		/* appended values outside the bins           */
 };
 
 typedef struct {
@@ -318,6 +326,9 @@ extern MT_Lock MT_system_lock;
 	} while (0)
 #define TYPEerror(t1,t2)	(ATOMstorage(ATOMtype(t1)) != ATOMstorage(ATOMtype(t2)))
 
+/* number of oids in the first sorted run of the order index of b */
+#define ORDERIDXBASE(b)	((BUN) ((const oid *) (b)->torderidx->base)[3])
+
 #define GDKswapLock(x)  GDKbatLock[(x)&BBP_BATMASK].swap
 #define GDKhashLock(x)  GDKbatLock[(x)&BBP_BATMASK].hash
 #define GDKimprintsLock(x)  GDKbatLock[(x)&BBP_BATMASK].imprints
@@ -335,11 +335,11 @@ BUN
 ORDERfnd(BAT *b, const void *v)
 {
 	assert(b->torderidx);
-	if (BATcount(b) == 0)
+	if (ORDERIDXBASE(b) == 0)
 		return BUN_NONE;
 	return binsearch((oid *) b->torderidx->base + ORDERIDXOFF, 0, b->ttype,
 			 Tloc(b, 0), b->tvheap ? b->tvheap->base : NULL,
-			 b->twidth, 0, BATcount(b), v, 1, -1);
+			 b->twidth, 0, ORDERIDXBASE(b), v, 1, -1);
 }
 
 /* Return the BUN of the first (lowest numbered) tail value that is
@@ -371,11 +371,11 @@ BUN
 ORDERfndfirst(BAT *b, const void *v)
 {
 	assert(b->torderidx);
-	if (BATcount(b) == 0)
+	if (ORDERIDXBASE(b) == 0)
 		return 0;
 	return binsearch((oid *) b->torderidx->base + ORDERIDXOFF, 0, b->ttype,
 			 Tloc(b, 0), b->tvheap ? b->tvheap->base : NULL,
-			 b->twidth, 0, BATcount(b), v, 1, 0);
+			 b->twidth, 0, ORDERIDXBASE(b), v, 1, 0);
 }
 
 /* Return the BUN of the first (lowest numbered) tail value beyond v.
@@ -408,9 +408,23 @@ BUN
 ORDERfndlast(BAT *b, const void *v)
 {
 	assert(b->torderidx);
-	if (BATcount(b) == 0)
+	if (ORDERIDXBASE(b) == 0)
 		return 0;
 	return binsearch((oid *) b->torderidx->base + ORDERIDXOFF, 0, b->ttype,
 			 Tloc(b, 0), b->tvheap ? b->tvheap->base : NULL,
-			 b->twidth, 0, BATcount(b), v, 1, 1);
+			 b->twidth, 0, ORDERIDXBASE(b), v, 1, 1);
+}
+
+/* use the delta of the orderidx, i.e. the oids of the values appended
+ * since the first run of the index was sorted; last has the same
+ * meaning as for binsearch; returns BUN on order index */
+BUN
+ORDERfnddelta(BAT *b, const void *v, int last)
+{
+	assert(b->torderidx);
+	if (ORDERIDXBASE(b) == BATcount(b))
+		return BATcount(b);
+	return binsearch((oid *) b->torderidx->base + ORDERIDXOFF, 0, b->ttype,
+			 Tloc(b, 0), b->tvheap ? b->tvheap->base : NULL,
+			 b->twidth, ORDERIDXBASE(b), BATcount(b), v, 1, last);
 }
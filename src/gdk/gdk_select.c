@@ -754,6 +754,105 @@ fullscan_any(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 	return cnt;
 }
 
+/* range select on strings using imprints
+ *
+ * The imprints of a string column are built on IMPSstrkey, the first
+ * eight bytes of the strings, which orders like the strings do.  The
+ * pages whose imprint has no bit in the key range of [tl,th] are
+ * skipped, the pages that only have bits strictly inside it qualify
+ * as a whole (a key strictly between the keys of the bounds means the
+ * string is strictly between the bounds), and the values of the other
+ * pages are compared. */
+static BUN
+impsselect_str(BAT *b, BAT *s, BAT *bn, const char *tl, const char *th,
+	       int li, int hi, int lval, int hval,
+	       BUN r, BUN q, BUN cnt, lng off, oid *restrict dst)
+{
+	BATiter bi = bat_iterator(b);
+	Imprints *imprints;
+	BUN pr_off = 0;
+	BUN p = r, i, e, n, dcnt, icnt;
+	const cchdc_t *restrict d;
+	const BUN page = IMPS_PAGE >> b->tshift;
+	lng kl = lval ? IMPSstrkey(tl) : lng_nil;
+	lng kh = hval ? IMPSstrkey(th) : GDK_lng_max;
+	int lbin, hbin;
+	uint64_t mask, innermask, m = 0;
+	const char *v;
+	oid o;
+	int c;
+
+	if (VIEWtparent(b)) {
+		BAT *parent = BBPdescriptor(VIEWtparent(b));
+		imprints = parent->timprints;
+		pr_off = (BUN) (((const char *) Tloc(b, 0) -
+				 (const char *) Tloc(parent, 0)) >> b->tshift);
+	} else {
+		imprints = b->timprints;
+	}
+	assert(imprints != NULL && imprints != (Imprints *) 1);
+	ALGODEBUG fprintf(stderr,
+			  "#BATselect(b=%s#"BUNFMT",s=%s%s,anti=0): "
+			  "imprints select str\n", BATgetId(b), BATcount(b),
+			  s ? BATgetId(s) : "NULL",
+			  s && BATtdense(s) ? "(dense)" : "");
+
+	lbin = IMPSgetbin(TYPE_lng, imprints->bits, imprints->bins, &kl);
+	hbin = IMPSgetbin(TYPE_lng, imprints->bits, imprints->bins, &kh);
+	/* bits lbin..hbin inclusive */
+	mask = (((((uint64_t) 1 << hbin) - 1) << 1) | 1) - (((uint64_t) 1 << lbin) - 1);
+	innermask = IMPSunsetBit(64, IMPSunsetBit(64, mask, lbin), hbin);
+
+	d = (const cchdc_t *) imprints->dict;
+	/* i is the first position of the current page(s) in the
+	 * parent, e the position beyond them */
+	for (dcnt = 0, icnt = 0, i = 0;
+	     dcnt < imprints->dictcnt && i < q + pr_off;
+	     dcnt++) {
+		n = d[dcnt].repeat ? 1 : d[dcnt].cnt;
+		while (n-- > 0 && i < q + pr_off) {
+			e = i + (d[dcnt].repeat ? d[dcnt].cnt : 1) * page;
+			switch (imprints->bits) {
+			case 8: m = ((const uint8_t *) imprints->imps)[icnt]; break;
+			case 16: m = ((const uint16_t *) imprints->imps)[icnt]; break;
+			case 32: m = ((const uint32_t *) imprints->imps)[icnt]; break;
+			case 64: m = ((const uint64_t *) imprints->imps)[icnt]; break;
+			}
+			icnt++;
+			if (e > q + pr_off)
+				e = q + pr_off;
+			if (e <= p + pr_off || (m & mask) == 0) {
+				/* nothing here */
+				if (p + pr_off < e)
+					p = e - pr_off;
+				i = e;
+				continue;
+			}
+			for (; p + pr_off < e; p++) {
+				if ((m & ~innermask) != 0) {
+					v = BUNtvar(bi, p);
+					if (GDK_STRNIL(v) ||
+					    (lval &&
+					     ((c = strCmpNoNil((const unsigned char *) tl, (const unsigned char *) v)) > 0 ||
+					      (!li && c == 0))) ||
+					    (hval &&
+					     ((c = strCmpNoNil((const unsigned char *) th, (const unsigned char *) v)) < 0 ||
+					      (!hi && c == 0))))
+						continue;
+				}
+				o = (oid) (p + off);
+				buninsfix(bn, dst, cnt, o,
+					  (BUN) ((dbl) cnt / (dbl) (p == r ? 1 : p - r)
+						 * (dbl) (q-p) * 1.1 + 1024),
+					  BATcapacity(bn) + q - p, BUN_NONE);
+				cnt++;
+			}
+			i = e;
+		}
+	}
+	return cnt;
+}
+
 static BUN
 fullscan_str(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 	     int li, int hi, int equi, int anti, int lval, int hval,
@@ -764,6 +863,9 @@ fullscan_str(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 	BUN p = r;
 	oid o = (oid) (p + off);
 
+	if (use_imprints && !equi && !anti)
+		return impsselect_str(b, s, bn, tl, th, li, hi, lval, hval,
+				      r, q, cnt, off, dst);
 	if (!equi || !GDK_ELIMDOUBLES(b->tvheap))
 		return fullscan_any(b, s, bn, tl, th, li, hi, equi, anti,
 				    lval, hval, r, q, cnt, off, dst,
@@ -868,6 +970,434 @@ scan_sel(candscan, o = *candlist++, w = (BUN) ((*(oid *) Tloc(s,q?(q - 1):0)) +
 scan_sel(fullscan, o = (oid) (p+off), w = (BUN) (q+off))
 
 
+/* SIMD scan select
+ *
+ * For full scans (no candidate list, or a dense one) over columns of
+ * fixed-size numeric values without imprints, the selection is done
+ * with AVX2 or AVX-512 instructions when the CPU supports them.
+ * Values are compared a vector at a time, and the positions of the
+ * qualifying values are written to the result with a compress-store,
+ * so that there is no branch per value.  The instruction set is
+ * chosen at run time, the scalar scan is used when neither is
+ * available.  bte and sht values are widened to int before being
+ * compared.
+ *
+ * All kernels compute the same as the scalar scan select: for a range
+ * select, tl and th are the inclusive bounds after normalization by
+ * BATselect, for an equi-select tl == th, and for an anti-select the
+ * bounds are exclusive and nils do not qualify. */
+#if SIZEOF_OID == 8 && (defined(__x86_64__) || defined(__amd64__)) && \
+	(defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#define HAVE_SIMDSELECT 1
+#include <immintrin.h>
+
+#define SIMDCHUNK	((BUN) 1 << 16)	/* values scanned between capacity checks */
+
+typedef BUN (*simdselect_fptr)(const void *src, BUN p, BUN q,
+			       const void *tl, const void *th, int anti,
+			       oid off, oid *restrict dst);
+
+/* scalar test of the remaining values at the end of a vector loop */
+#define simdtail(TYPE)							\
+	do {								\
+		const TYPE *restrict w = (const TYPE *) src;		\
+		TYPE vl = *(const TYPE *) tl;				\
+		TYPE vh = *(const TYPE *) th;				\
+		TYPE nil = TYPE##_nil;					\
+		for (; p < q; p++) {					\
+			TYPE v = w[p];					\
+			dst[cnt] = p + off;				\
+			cnt += anti ? (v <= vl || v >= vh) && v != nil	\
+				: v >= vl && v <= vh;			\
+		}							\
+	} while (0)
+
+/* for each 4 bit mask, the 32 bit lanes that hold the selected 64
+ * bit lanes, left aligned */
+static const int simdperm[16][8] __attribute__((__aligned__(32))) = {
+	{0, 0, 0, 0, 0, 0, 0, 0},
+	{0, 1, 0, 0, 0, 0, 0, 0},
+	{2, 3, 0, 0, 0, 0, 0, 0},
+	{0, 1, 2, 3, 0, 0, 0, 0},
+	{4, 5, 0, 0, 0, 0, 0, 0},
+	{0, 1, 4, 5, 0, 0, 0, 0},
+	{2, 3, 4, 5, 0, 0, 0, 0},
+	{0, 1, 2, 3, 4, 5, 0, 0},
+	{6, 7, 0, 0, 0, 0, 0, 0},
+	{0, 1, 6, 7, 0, 0, 0, 0},
+	{2, 3, 6, 7, 0, 0, 0, 0},
+	{0, 1, 2, 3, 6, 7, 0, 0},
+	{4, 5, 6, 7, 0, 0, 0, 0},
+	{0, 1, 4, 5, 6, 7, 0, 0},
+	{2, 3, 4, 5, 6, 7, 0, 0},
+	{0, 1, 2, 3, 4, 5, 6, 7},
+};
+
+/* AVX2: write the oids of the 4 values starting at position P whose
+ * bit is set in the 4 bit mask M; this writes 4 oids, of which only
+ * the first popcount(M) count */
+#define simdemit_avx2(M, P)						\
+	do {								\
+		__m256i _o = _mm256_add_epi64(_mm256_set1_epi64x((lng) ((P) + off)), seq); \
+		__m256i _s = _mm256_load_si256((const __m256i *) simdperm[(M)]); \
+		_mm256_storeu_si256((__m256i *) (dst + cnt),		\
+				    _mm256_permutevar8x32_epi32(_o, _s)); \
+		cnt += __builtin_popcount(M);				\
+	} while (0)
+
+/* AVX2 kernel for values compared as 8 int lanes */
+#define simdfunc_avx2_int(TYPE, LOAD)					\
+static BUN __attribute__((__target__("avx2")))				\
+simdselect_##TYPE##_avx2(const void *src, BUN p, BUN q,			\
+			 const void *tl, const void *th, int anti,	\
+			 oid off, oid *restrict dst)			\
+{									\
+	const __m256i seq = _mm256_set_epi64x(3, 2, 1, 0);		\
+	const __m256i lo = _mm256_set1_epi32(*(const TYPE *) tl);	\
+	const __m256i hi = _mm256_set1_epi32(*(const TYPE *) th);	\
+	const __m256i nil = _mm256_set1_epi32(TYPE##_nil);		\
+	BUN cnt = 0;							\
+	unsigned m;							\
+									\
+	for (; p + 8 <= q; p += 8) {					\
+		const TYPE *w = (const TYPE *) src + p;			\
+		__m256i v = LOAD;					\
+		if (anti)						\
+			m = ~_mm256_movemask_ps(_mm256_castsi256_ps(	\
+				_mm256_or_si256(_mm256_and_si256(	\
+					_mm256_cmpgt_epi32(v, lo),	\
+					_mm256_cmpgt_epi32(hi, v)),	\
+					_mm256_cmpeq_epi32(v, nil)))) & 0xFF; \
+		else							\
+			m = ~_mm256_movemask_ps(_mm256_castsi256_ps(	\
+				_mm256_or_si256(			\
+					_mm256_cmpgt_epi32(lo, v),	\
+					_mm256_cmpgt_epi32(v, hi)))) & 0xFF; \
+		simdemit_avx2(m & 0xF, p);				\
+		simdemit_avx2(m >> 4, p + 4);				\
+	}								\
+	simdtail(TYPE);							\
+	return cnt;							\
+}
+
+simdfunc_avx2_int(bte, _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *) w)))
+simdfunc_avx2_int(sht, _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *) w)))
+simdfunc_avx2_int(int, _mm256_loadu_si256((const __m256i *) w))
+
+static BUN __attribute__((__target__("avx2")))
+simdselect_lng_avx2(const void *src, BUN p, BUN q,
+		    const void *tl, const void *th, int anti,
+		    oid off, oid *restrict dst)
+{
+	const __m256i seq = _mm256_set_epi64x(3, 2, 1, 0);
+	const __m256i lo = _mm256_set1_epi64x(*(const lng *) tl);
+	const __m256i hi = _mm256_set1_epi64x(*(const lng *) th);
+	const __m256i nil = _mm256_set1_epi64x(lng_nil);
+	BUN cnt = 0;
+	unsigned m;
+
+	for (; p + 4 <= q; p += 4) {
+		__m256i v = _mm256_loadu_si256((const __m256i *) ((const lng *) src + p));
+		if (anti)
+			m = ~_mm256_movemask_pd(_mm256_castsi256_pd(
+				_mm256_or_si256(_mm256_and_si256(
+					_mm256_cmpgt_epi64(v, lo),
+					_mm256_cmpgt_epi64(hi, v)),
+					_mm256_cmpeq_epi64(v, nil)))) & 0xF;
+		else
+			m = ~_mm256_movemask_pd(_mm256_castsi256_pd(
+				_mm256_or_si256(
+					_mm256_cmpgt_epi64(lo, v),
+					_mm256_cmpgt_epi64(v, hi)))) & 0xF;
+		simdemit_avx2(m, p);
+	}
+	simdtail(lng);
+	return cnt;
+}
+
+static BUN __attribute__((__target__("avx2")))
+simdselect_flt_avx2(const void *src, BUN p, BUN q,
+		    const void *tl, const void *th, int anti,
+		    oid off, oid *restrict dst)
+{
+	const __m256i seq = _mm256_set_epi64x(3, 2, 1, 0);
+	const __m256 lo = _mm256_set1_ps(*(const flt *) tl);
+	const __m256 hi = _mm256_set1_ps(*(const flt *) th);
+	const __m256 nil = _mm256_set1_ps(flt_nil);
+	BUN cnt = 0;
+	unsigned m;
+
+	for (; p + 8 <= q; p += 8) {
+		__m256 v = _mm256_loadu_ps((const flt *) src + p);
+		if (anti)
+			m = _mm256_movemask_ps(_mm256_and_ps(_mm256_or_ps(
+				_mm256_cmp_ps(v, lo, _CMP_LE_OQ),
+				_mm256_cmp_ps(v, hi, _CMP_GE_OQ)),
+				_mm256_cmp_ps(v, nil, _CMP_NEQ_UQ)));
+		else
+			m = _mm256_movemask_ps(_mm256_and_ps(
+				_mm256_cmp_ps(v, lo, _CMP_GE_OQ),
+				_mm256_cmp_ps(v, hi, _CMP_LE_OQ)));
+		simdemit_avx2(m & 0xF, p);
+		simdemit_avx2(m >> 4, p + 4);
+	}
+	simdtail(flt);
+	return cnt;
+}
+
+static BUN __attribute__((__target__("avx2")))
+simdselect_dbl_avx2(const void *src, BUN p, BUN q,
+		    const void *tl, const void *th, int anti,
+		    oid off, oid *restrict dst)
+{
+	const __m256i seq = _mm256_set_epi64x(3, 2, 1, 0);
+	const __m256d lo = _mm256_set1_pd(*(const dbl *) tl);
+	const __m256d hi = _mm256_set1_pd(*(const dbl *) th);
+	const __m256d nil = _mm256_set1_pd(dbl_nil);
+	BUN cnt = 0;
+	unsigned m;
+
+	for (; p + 4 <= q; p += 4) {
+		__m256d v = _mm256_loadu_pd((const dbl *) src + p);
+		if (anti)
+			m = _mm256_movemask_pd(_mm256_and_pd(_mm256_or_pd(
+				_mm256_cmp_pd(v, lo, _CMP_LE_OQ),
+				_mm256_cmp_pd(v, hi, _CMP_GE_OQ)),
+				_mm256_cmp_pd(v, nil, _CMP_NEQ_UQ)));
+		else
+			m = _mm256_movemask_pd(_mm256_and_pd(
+				_mm256_cmp_pd(v, lo, _CMP_GE_OQ),
+				_mm256_cmp_pd(v, hi, _CMP_LE_OQ)));
+		simdemit_avx2(m, p);
+	}
+	simdtail(dbl);
+	return cnt;
+}
+
+/* AVX-512: compress-store the oids of the 8 values starting at
+ * position P whose bit is set in the 8 bit mask M */
+#define simdemit_avx512(M, P)						\
+	do {								\
+		__mmask8 _m = (__mmask8) (M);				\
+		_mm512_mask_compressstoreu_epi64(dst + cnt, _m,		\
+			_mm512_add_epi64(_mm512_set1_epi64((lng) ((P) + off)), seq)); \
+		cnt += __builtin_popcount(_m);				\
+	} while (0)
+
+/* AVX-512 kernel for values compared as 16 int lanes */
+#define simdfunc_avx512_int(TYPE, LOAD)					\
+static BUN __attribute__((__target__("avx512f")))			\
+simdselect_##TYPE##_avx512(const void *src, BUN p, BUN q,		\
+			   const void *tl, const void *th, int anti,	\
+			   oid off, oid *restrict dst)			\
+{									\
+	const __m512i seq = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);	\
+	const __m512i lo = _mm512_set1_epi32(*(const TYPE *) tl);	\
+	const __m512i hi = _mm512_set1_epi32(*(const TYPE *) th);	\
+	const __m512i nil = _mm512_set1_epi32(TYPE##_nil);		\
+	BUN cnt = 0;							\
+	unsigned m;							\
+									\
+	for (; p + 16 <= q; p += 16) {					\
+		const TYPE *w = (const TYPE *) src + p;			\
+		__m512i v = LOAD;					\
+		if (anti)						\
+			m = (_mm512_cmple_epi32_mask(v, lo) |		\
+			     _mm512_cmpge_epi32_mask(v, hi)) &		\
+				_mm512_cmpneq_epi32_mask(v, nil);	\
+		else							\
+			m = _mm512_cmpge_epi32_mask(v, lo) &		\
+				_mm512_cmple_epi32_mask(v, hi);		\
+		simdemit_avx512(m & 0xFF, p);				\
+		simdemit_avx512(m >> 8, p + 8);				\
+	}								\
+	simdtail(TYPE);							\
+	return cnt;							\
+}
+
+simdfunc_avx512_int(bte, _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i *) w)))
+simdfunc_avx512_int(sht, _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i *) w)))
+simdfunc_avx512_int(int, _mm512_loadu_si512(w))
+
+static BUN __attribute__((__target__("avx512f")))
+simdselect_lng_avx512(const void *src, BUN p, BUN q,
+		      const void *tl, const void *th, int anti,
+		      oid off, oid *restrict dst)
+{
+	const __m512i seq = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+	const __m512i lo = _mm512_set1_epi64(*(const lng *) tl);
+	const __m512i hi = _mm512_set1_epi64(*(const lng *) th);
+	const __m512i nil = _mm512_set1_epi64(lng_nil);
+	BUN cnt = 0;
+	unsigned m;
+
+	for (; p + 8 <= q; p += 8) {
+		__m512i v = _mm512_loadu_si512((const lng *) src + p);
+		if (anti)
+			m = (_mm512_cmple_epi64_mask(v, lo) |
+			     _mm512_cmpge_epi64_mask(v, hi)) &
+				_mm512_cmpneq_epi64_mask(v, nil);
+		else
+			m = _mm512_cmpge_epi64_mask(v, lo) &
+				_mm512_cmple_epi64_mask(v, hi);
+		simdemit_avx512(m, p);
+	}
+	simdtail(lng);
+	return cnt;
+}
+
+static BUN __attribute__((__target__("avx512f")))
+simdselect_flt_avx512(const void *src, BUN p, BUN q,
+		      const void *tl, const void *th, int anti,
+		      oid off, oid *restrict dst)
+{
+	const __m512i seq = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+	const __m512 lo = _mm512_set1_ps(*(const flt *) tl);
+	const __m512 hi = _mm512_set1_ps(*(const flt *) th);
+	const __m512 nil = _mm512_set1_ps(flt_nil);
+	BUN cnt = 0;
+	unsigned m;
+
+	for (; p + 16 <= q; p += 16) {
+		__m512 v = _mm512_loadu_ps((const flt *) src + p);
+		if (anti)
+			m = (_mm512_cmp_ps_mask(v, lo, _CMP_LE_OQ) |
+			     _mm512_cmp_ps_mask(v, hi, _CMP_GE_OQ)) &
+				_mm512_cmp_ps_mask(v, nil, _CMP_NEQ_UQ);
+		else
+			m = _mm512_cmp_ps_mask(v, lo, _CMP_GE_OQ) &
+				_mm512_cmp_ps_mask(v, hi, _CMP_LE_OQ);
+		simdemit_avx512(m & 0xFF, p);
+		simdemit_avx512(m >> 8, p + 8);
+	}
+	simdtail(flt);
+	return cnt;
+}
+
+static BUN __attribute__((__target__("avx512f")))
+simdselect_dbl_avx512(const void *src, BUN p, BUN q,
+		      const void *tl, const void *th, int anti,
+		      oid off, oid *restrict dst)
+{
+	const __m512i seq = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+	const __m512d lo = _mm512_set1_pd(*(const dbl *) tl);
+	const __m512d hi = _mm512_set1_pd(*(const dbl *) th);
+	const __m512d nil = _mm512_set1_pd(dbl_nil);
+	BUN cnt = 0;
+	unsigned m;
+
+	for (; p + 8 <= q; p += 8) {
+		__m512d v = _mm512_loadu_pd((const dbl *) src + p);
+		if (anti)
+			m = (_mm512_cmp_pd_mask(v, lo, _CMP_LE_OQ) |
+			     _mm512_cmp_pd_mask(v, hi, _CMP_GE_OQ)) &
+				_mm512_cmp_pd_mask(v, nil, _CMP_NEQ_UQ);
+		else
+			m = _mm512_cmp_pd_mask(v, lo, _CMP_GE_OQ) &
+				_mm512_cmp_pd_mask(v, hi, _CMP_LE_OQ);
+		simdemit_avx512(m, p);
+	}
+	simdtail(dbl);
+	return cnt;
+}
+
+/* the instruction set to use: 0 if not determined yet, 1 for none */
+static int simdisa = 0;
+#define SIMD_NONE	1
+#define SIMD_AVX2	2
+#define SIMD_AVX512	3
+
+static simdselect_fptr
+simdkernel(int t)
+{
+	if (simdisa == 0) {
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx512f"))
+			simdisa = SIMD_AVX512;
+		else if (__builtin_cpu_supports("avx2"))
+			simdisa = SIMD_AVX2;
+		else
+			simdisa = SIMD_NONE;
+	}
+	switch (simdisa) {
+	case SIMD_AVX512:
+		switch (t) {
+		case TYPE_bte:
+			return simdselect_bte_avx512;
+		case TYPE_sht:
+			return simdselect_sht_avx512;
+		case TYPE_int:
+			return simdselect_int_avx512;
+		case TYPE_lng:
+			return simdselect_lng_avx512;
+		case TYPE_flt:
+			return simdselect_flt_avx512;
+		case TYPE_dbl:
+			return simdselect_dbl_avx512;
+		}
+		break;
+	case SIMD_AVX2:
+		switch (t) {
+		case TYPE_bte:
+			return simdselect_bte_avx2;
+		case TYPE_sht:
+			return simdselect_sht_avx2;
+		case TYPE_int:
+			return simdselect_int_avx2;
+		case TYPE_lng:
+			return simdselect_lng_avx2;
+		case TYPE_flt:
+			return simdselect_flt_avx2;
+		case TYPE_dbl:
+			return simdselect_dbl_avx2;
+		}
+		break;
+	}
+	return NULL;
+}
+
+/* select the positions [p,q) of b into bn using a SIMD kernel;
+ * return the number of qualifying values, or BUN_NONE after
+ * reclaiming bn if it cannot be extended */
+static BUN
+simdselect(BAT *b, BAT *s, BAT *bn, simdselect_fptr kernel,
+	   const void *tl, const void *th, int equi, int anti,
+	   BUN p, BUN q, lng off)
+{
+	BUN r = p, cnt = 0, n, ncap;
+
+	ALGODEBUG fprintf(stderr,
+			  "#BATselect(b=%s#"BUNFMT",s=%s%s,anti=%d): "
+			  "simdscan %s%s\n", BATgetId(b), BATcount(b),
+			  s ? BATgetId(s) : "NULL",
+			  s && BATtdense(s) ? "(dense)" : "",
+			  anti, simdisa == SIMD_AVX512 ? "avx512" : "avx2",
+			  equi ? " equi" : anti ? " anti" : "");
+	while (p < q) {
+		n = MIN(q - p, SIMDCHUNK);
+		if (BATcapacity(bn) < cnt + n) {
+			/* grow by the selectivity so far, like
+			 * buninsfix does */
+			ncap = (BUN) ((dbl) cnt / (dbl) (p == r ? 1 : p - r)
+				      * (dbl) (q - p) * 1.1 + 1024);
+			ncap = cnt + MIN(MAX(ncap, n), q - p);
+			BATsetcount(bn, cnt);
+			if (BATextend(bn, ncap) != GDK_SUCCEED) {
+				BBPreclaim(bn);
+				return BUN_NONE;
+			}
+		}
+		/* the kernels may write up to a vector's worth of
+		 * oids beyond the qualifying ones, but never beyond
+		 * the n positions they scan */
+		cnt += (*kernel)(Tloc(b, 0), p, p + n, tl, th, anti,
+				 (oid) off, (oid *) Tloc(bn, cnt));
+		p += n;
+	}
+	return cnt;
+}
+#endif
+
 static BAT *
 BAT_scanselect(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 	       int li, int hi, int equi, int anti, int lval, int hval,
@@ -881,6 +1411,9 @@ BAT_scanselect(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 	oid o, *restrict dst;
 	lng off;
 	const oid *candlist;
+#ifdef HAVE_SIMDSELECT
+	simdselect_fptr kernel;
+#endif
 
 	assert(b != NULL);
 	assert(bn != NULL);
@@ -970,6 +1503,13 @@ BAT_scanselect(BAT *b, BAT *s, BAT *bn, const void *tl, const void *th,
 			q = BUNlast(b);
 		}
 		candlist = NULL;
+#ifdef HAVE_SIMDSELECT
+		if (!use_imprints && (kernel = simdkernel(t)) != NULL) {
+			cnt = simdselect(b, s, bn, kernel, tl,
+					 equi ? tl : th, equi, anti,
+					 p, q, off);
+		} else
+#endif
 		/* call type-specific core scan select function */
 		switch (t) {
 		case TYPE_bte:
@@ -1462,6 +2002,8 @@ BATselect(BAT *b, BAT *s, const void *tl, const void *th,
 	if (BATordered(b) || BATordered_rev(b) || use_orderidx) {
 		BUN low = 0;
 		BUN high = b->batCount;
+		/* range in the delta of the order index */
+		BUN dlow = 0, dhigh = 0;
 
 		if (BATtdense(b)) {
 			/* positional */
@@ -1547,20 +2089,31 @@ BATselect(BAT *b, BAT *s, const void *tl, const void *th,
 					  s ? BATgetId(s) : "NULL",
 					  s && BATtdense(s) ? "(dense)" : "",
 					  anti);
+			/* search both the first run of the index and
+			 * the delta of values appended since */
+			high = ORDERIDXBASE(b);
+			dhigh = BATcount(b);
 			if (lval) {
-				if (li)
+				if (li) {
 					low = ORDERfndfirst(b, tl);
-				else
+					dlow = ORDERfnddelta(b, tl, 0);
+				} else {
 					low = ORDERfndlast(b, tl);
+					dlow = ORDERfnddelta(b, tl, 1);
+				}
 			} else {
 				/* skip over nils at start of column */
 				low = ORDERfndlast(b, nil);
+				dlow = ORDERfnddelta(b, nil, 1);
 			}
 			if (hval) {
-				if (hi)
+				if (hi) {
 					high = ORDERfndlast(b, th);
-				else
+					dhigh = ORDERfnddelta(b, th, 1);
+				} else {
 					high = ORDERfndfirst(b, th);
+					dhigh = ORDERfnddelta(b, th, 0);
+				}
 			}
 		}
 		if (anti) {
@@ -1621,19 +2174,23 @@ BATselect(BAT *b, BAT *s, const void *tl, const void *th,
 				oid *rbn;
 
 				rs = (const oid *) b->torderidx->base + ORDERIDXOFF;
-				rs += low;
-				bn = COLnew(0, TYPE_oid, high-low, TRANSIENT);
+				bn = COLnew(0, TYPE_oid, high - low + dhigh - dlow, TRANSIENT);
 				if (bn == NULL)
 					return NULL;
 
 				rbn = (oid *) Tloc((bn), 0);
 
 				for (i = low; i < high; i++) {
-					if (vwl <= *rs && *rs < vwh) {
-						*rbn++ = *rs;
+					if (vwl <= rs[i] && rs[i] < vwh) {
+						*rbn++ = rs[i];
+						cnt++;
+					}
+				}
+				for (i = dlow; i < dhigh; i++) {
+					if (vwl <= rs[i] && rs[i] < vwh) {
+						*rbn++ = rs[i];
 						cnt++;
 					}
-					rs++;
 				}
 				BATsetcount(bn, cnt);
 
@@ -1811,7 +2368,9 @@ BATselect(BAT *b, BAT *s, const void *tl, const void *th,
 	} else {
 		int use_imprints = 0;
 		if (!equi &&
-		    !b->tvarsized &&
+		    (!b->tvarsized ||
+		     (ATOMbasetype(b->ttype) == TYPE_str && !anti &&
+		      (s == NULL || BATtdense(s)))) &&
 		    (b->batPersistence == PERSISTENT ||
 		     (parent != 0 &&
 		      (tmp = BBPquickdesc(parent, 0)) != NULL &&
@@ -1819,7 +2378,8 @@ BATselect(BAT *b, BAT *s, const void *tl, const void *th,
 			/* use imprints if
 			 *   i) bat is persistent, or parent is persistent
 			 *  ii) it is not an equi-select, and
-			 * iii) is not var-sized.
+			 * iii) is not var-sized, or is a string range
+			 *      select without candidate list.
 			 */
 			use_imprints = 1;
 		}
@@ -2002,9 +2562,17 @@ rangejoin(BAT *r1, BAT *r2, BAT *l, BAT *rl, BAT *rh, BAT *sl, BAT *sr, int li,
 	lh = ll + l->batCount;
 	if ((!sl || (sl && BATtdense(sl))) &&
 	    (BATcheckorderidx(l) || (VIEWtparent(l) && BATcheckorderidx(BBPquickdesc(VIEWtparent(l), 0))))) {
-		use_orderidx = 1;
+		BAT *pl = l;
+
 		if (VIEWtparent(l) && !BATcheckorderidx(l)) {
-			l = BBPdescriptor(VIEWtparent(l));
+			pl = BBPdescriptor(VIEWtparent(l));
+		}
+		/* the binary searches below need a single sorted
+		 * run; an index with a delta is not merged here since
+		 * only appends may change it */
+		if (ORDERIDXBASE(pl) == BATcount(pl)) {
+			use_orderidx = 1;
+			l = pl;
 		}
 	}
 
@@ -2172,13 +2740,15 @@ rangejoin(BAT *r1, BAT *r2, BAT *l, BAT *rl, BAT *rh, BAT *sl, BAT *sr, int li,
 		     (tmp = BBPquickdesc(VIEWtparent(l), 0)) != NULL &&
 		     tmp->batPersistence == PERSISTENT) ||
 		    BATcheckimprints(l)) &&
+		   t != TYPE_str &&
 		   BATimprints(l) == GDK_SUCCEED) {
 		/* implementation using imprints on left column
 		 *
 		 * we use imprints if we can (the type is right for
 		 * imprints) and either the left bat is persistent or
 		 * already has imprints, or the right bats are long
-		 * enough (for creating imprints being worth it) */
+		 * enough (for creating imprints being worth it);
+		 * strings have imprints, but no scan below */
 		BUN maximum;
 
 		sorted = 2;
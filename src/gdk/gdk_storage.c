@@ -882,6 +882,276 @@ BATdelete(BAT *b)
 	b->batCopiedtodisk = FALSE;
 }
 
+/*
+ * Column files
+ *
+ * The header is followed by the tail heap and, for strings, the
+ * string heap, both written through a single block_stream2 so that
+ * the blocks can be compressed.  The header is written as is, so a
+ * column file can only be read on a machine with the same byte order
+ * and layout, which is checked when reading.
+ */
+#define COLFILE_MAGIC	"MonetCol"
+#define COLFILE_VERSION	1
+#define COLFILE_BLOCK	((size_t) 1 << 20)
+
+/* bits of the properties field; they describe the column that was
+ * written, but since anybody can supply a column file they are not
+ * trusted when reading */
+#define COLFILE_SORTED		1
+#define COLFILE_REVSORTED	2
+#define COLFILE_KEY		4
+#define COLFILE_NONIL		8
+#define COLFILE_NIL		16
+#define COLFILE_HASHASH		32
+
+typedef struct {
+	char magic[8];		/* COLFILE_MAGIC, not null-terminated */
+	lng count;		/* number of values */
+	lng tailsize;		/* bytes in the tail heap */
+	lng varsize;		/* bytes in the string heap, or 0 */
+	int version;		/* COLFILE_VERSION */
+	int byteorder;		/* 1234 in the byte order of the writer */
+	int width;		/* width of the values in the tail heap */
+	int compression;	/* compression_method of the blocks */
+	int properties;		/* COLFILE_ bits */
+	char type[IDLENGTH];	/* name of the atom */
+} colfile_header;
+
+static int
+colfile_readheader(stream *f, colfile_header *h)
+{
+	return mnstr_read(f, h, sizeof(*h), 1) == 1 &&
+		memcmp(h->magic, COLFILE_MAGIC, sizeof(h->magic)) == 0 &&
+		h->version == COLFILE_VERSION &&
+		h->byteorder == 1234;
+}
+
+/* read size bytes, which may span several blocks */
+static int
+colfile_read(stream *s, void *buf, size_t size)
+{
+	ssize_t n;
+
+	while (size > 0) {
+		if ((n = mnstr_read(s, buf, 1, size)) <= 0)
+			return 0;
+		buf = (char *) buf + n;
+		size -= (size_t) n;
+	}
+	return 1;
+}
+
+/* The offsets and the string heap of a column file can't be trusted
+ * either: every offset must point into the heap, which must end in a
+ * NUL byte, and the hash table at the start of the heap is cleared so
+ * that later inserts don't follow links read from the file.  A heap
+ * below GDK_ELIMLIMIT must hold every string only once, which other
+ * code depends on, so its strings are entered into a new BAT. */
+static BAT *
+colfile_strings(BAT *bn, const char *filename)
+{
+	Heap *vh = bn->tvheap;
+	BUN i, cnt = BATcount(bn);
+	size_t off;
+	BAT *b;
+
+	if (cnt > 0 &&
+	    (vh->free <= GDK_VAROFFSET || vh->base[vh->free - 1] != '\0')) {
+		GDKerror("BATreadcolumn: %s has a malformed string heap\n", filename);
+		BBPreclaim(bn);
+		return NULL;
+	}
+	for (i = 0; i < cnt; i++) {
+		off = VarHeapVal(Tloc(bn, 0), i, bn->twidth);
+		if (off < GDK_VAROFFSET || off >= vh->free) {
+			GDKerror("BATreadcolumn: %s has a string offset outside its heap\n", filename);
+			BBPreclaim(bn);
+			return NULL;
+		}
+	}
+	vh->hashash = 0;
+	if (vh->free >= GDK_ELIMLIMIT) {
+		memset(vh->base, 0, GDK_STRHASHSIZE);
+		return bn;
+	}
+	if ((b = COLnew(0, bn->ttype, cnt, bn->batRole)) == NULL) {
+		BBPreclaim(bn);
+		return NULL;
+	}
+	for (i = 0; i < cnt; i++) {
+		off = VarHeapVal(Tloc(bn, 0), i, bn->twidth);
+		if (BUNappend(b, vh->base + off, FALSE) != GDK_SUCCEED) {
+			BBPreclaim(b);
+			BBPreclaim(bn);
+			return NULL;
+		}
+	}
+	BBPreclaim(bn);
+	return b;
+}
+
+gdk_return
+BATwritecolumn(BAT *b, const char *filename, int compression)
+{
+	colfile_header h;
+	stream *f, *s;
+	BAT *m = NULL;
+	const char *nme;
+	gdk_return ret = GDK_FAIL;
+
+	ERRORcheck(b == NULL, "BATwritecolumn: BAT required\n", GDK_FAIL);
+	ERRORcheck(ATOMvarsized(b->ttype) && ATOMstorage(b->ttype) != TYPE_str, "BATwritecolumn: bad tail type (varsized and not str)\n", GDK_FAIL);
+	if (b->ttype == TYPE_void) {
+		/* write the values of a dense column */
+		if ((m = COLcopy(b, TYPE_oid, 1, TRANSIENT)) == NULL)
+			return GDK_FAIL;
+		b = m;
+	}
+	nme = ATOMname(b->ttype);
+	memset(&h, 0, sizeof(h));
+	memcpy(h.magic, COLFILE_MAGIC, sizeof(h.magic));
+	h.count = (lng) BATcount(b);
+	h.tailsize = (lng) (BATcount(b) << b->tshift);
+	h.varsize = b->tvheap ? (lng) b->tvheap->free : 0;
+	h.version = COLFILE_VERSION;
+	h.byteorder = 1234;
+	h.width = b->twidth;
+	h.compression = compression;
+	h.properties = (b->tsorted ? COLFILE_SORTED : 0) |
+		(b->trevsorted ? COLFILE_REVSORTED : 0) |
+		(b->tkey ? COLFILE_KEY : 0) |
+		(b->tnonil ? COLFILE_NONIL : 0) |
+		(b->tnil ? COLFILE_NIL : 0) |
+		(b->tvheap && b->tvheap->hashash ? COLFILE_HASHASH : 0);
+	strncpy(h.type, nme, sizeof(h.type) - 1);
+
+	if ((f = open_wstream(filename)) == NULL) {
+		GDKsyserror("BATwritecolumn: cannot open %s\n", filename);
+		goto bailout;
+	}
+	if (mnstr_write(f, &h, sizeof(h), 1) != 1) {
+		GDKerror("BATwritecolumn: cannot write header of %s\n", filename);
+		close_stream(f);
+		goto bailout;
+	}
+	if ((s = block_stream2(f, COLFILE_BLOCK, (compression_method) compression, COLUMN_COMPRESSION_NONE)) == NULL) {
+		GDKerror("BATwritecolumn: compression method %d not available\n", compression);
+		close_stream(f);
+		goto bailout;
+	}
+	if ((h.tailsize > 0 &&
+	     mnstr_write(s, Tloc(b, 0), 1, (size_t) h.tailsize) != (ssize_t) h.tailsize) ||
+	    (h.varsize > 0 &&
+	     mnstr_write(s, b->tvheap->base, 1, (size_t) h.varsize) != (ssize_t) h.varsize) ||
+	    mnstr_flush(s) != 0) {
+		GDKerror("BATwritecolumn: cannot write %s\n", filename);
+		close_stream(s);
+		goto bailout;
+	}
+	close_stream(s);
+	ret = GDK_SUCCEED;
+  bailout:
+	if (m)
+		BBPunfix(m->batCacheid);
+	return ret;
+}
+
+int
+BATiscolumnfile(const char *filename)
+{
+	colfile_header h;
+	stream *f;
+	int ret;
+
+	if ((f = open_rstream(filename)) == NULL)
+		return 0;
+	ret = colfile_readheader(f, &h);
+	close_stream(f);
+	return ret;
+}
+
+BAT *
+BATreadcolumn(int tt, const char *filename, int role)
+{
+	colfile_header h;
+	stream *f, *s;
+	BAT *bn;
+
+	ERRORcheck(tt <= 0 , "BATreadcolumn: bad tail type (<=0)\n", NULL);
+	ERRORcheck(ATOMvarsized(tt) && ATOMstorage(tt) != TYPE_str, "BATreadcolumn: bad tail type (varsized and not str)\n", NULL);
+	ERRORcheck(role < 0 || role >= 32, "BATreadcolumn: role error\n", NULL);
+
+	if ((f = open_rstream(filename)) == NULL) {
+		GDKsyserror("BATreadcolumn: cannot open %s\n", filename);
+		return NULL;
+	}
+	if (!colfile_readheader(f, &h)) {
+		GDKerror("BATreadcolumn: %s is not a column file of this machine\n", filename);
+		close_stream(f);
+		return NULL;
+	}
+	h.type[sizeof(h.type) - 1] = 0;
+	if (strcmp(h.type, ATOMname(tt)) != 0 ||
+	    h.count < 0 || (ulng) h.count > (ulng) BUN_MAX ||
+	    (ATOMstorage(tt) == TYPE_str ?
+	     (h.width != 1 && h.width != 2 && h.width != 4 && h.width != 8) || h.varsize < 0 :
+	     h.width <= 0 || h.width != ATOMsize(tt) || h.varsize != 0) ||
+	    (ulng) h.count > (ulng) (SIZE_MAX / (size_t) h.width) ||
+	    h.tailsize != h.count * h.width) {
+		GDKerror("BATreadcolumn: %s does not hold a column of type %s\n", filename, ATOMname(tt));
+		close_stream(f);
+		return NULL;
+	}
+	if ((s = block_stream2(f, COLFILE_BLOCK, (compression_method) h.compression, COLUMN_COMPRESSION_NONE)) == NULL) {
+		GDKerror("BATreadcolumn: compression method %d not available\n", h.compression);
+		close_stream(f);
+		return NULL;
+	}
+	if ((bn = COLnew(0, tt, (BUN) h.count, role)) == NULL) {
+		close_stream(s);
+		return NULL;
+	}
+	if (bn->twidth != h.width) {
+		/* strings: take over the offset width of the writer */
+		bn->twidth = h.width;
+		bn->tshift = ATOMelmshift(h.width);
+		if (HEAPextend(&bn->theap, (size_t) h.tailsize, 0) != GDK_SUCCEED)
+			goto bailout;
+		bn->batCapacity = (BUN) (bn->theap.size >> bn->tshift);
+	}
+	if (h.varsize > 0 && bn->tvheap->size < (size_t) h.varsize &&
+	    HEAPextend(bn->tvheap, (size_t) h.varsize, 0) != GDK_SUCCEED)
+		goto bailout;
+	if (!colfile_read(s, Tloc(bn, 0), (size_t) h.tailsize) ||
+	    (h.varsize > 0 &&
+	     !colfile_read(s, bn->tvheap->base, (size_t) h.varsize))) {
+		GDKerror("BATreadcolumn: couldn't read the complete file %s\n", filename);
+		goto bailout;
+	}
+	close_stream(s);
+	if (h.varsize > 0) {
+		bn->tvheap->free = (size_t) h.varsize;
+		bn->tvheap->dirty = 1;
+	}
+	BATsetcount(bn, (BUN) h.count);
+	bn->theap.dirty = 1;
+	if (ATOMstorage(tt) == TYPE_str &&
+	    (bn = colfile_strings(bn, filename)) == NULL)
+		return NULL;
+	/* like BATattach, assume nothing about the values */
+	bn->tnonil = h.count == 0;
+	bn->tnil = 0;
+	bn->tdense = 0;
+	bn->tsorted = bn->trevsorted = bn->tkey = h.count <= 1;
+	return bn;
+
+  bailout:
+	close_stream(s);
+	BBPreclaim(bn);
+	return NULL;
+}
+
 /*
  * BAT specific printing
  */
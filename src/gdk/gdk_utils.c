@@ -303,6 +303,7 @@ static MT_Lock GDKstoppedLock MT_LOCK_INITIALIZER("GDKstoppedLock");
 
 size_t _MT_pagesize = 0;	/* variable holding page size */
 size_t _MT_npages = 0;		/* variable holding memory size in pages */
+size_t _MT_cachesize = 0;	/* variable holding size of a core's cache */
 
 void
 MT_init(void)
@@ -398,6 +399,19 @@ MT_init(void)
 #else
 # error "don't know how to get the amount of physical memory for your OS"
 #endif
+
+#if defined(HAVE_SYSCONF) && defined(_SC_LEVEL2_CACHE_SIZE)
+	{
+		/* the level 2 cache is private to a core, the shared
+		 * level 3 cache is reported for all cores together */
+		long size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+
+		if (size > 0)
+			_MT_cachesize = (size_t) size;
+	}
+#endif
+	if (_MT_cachesize == 0)
+		_MT_cachesize = 256 * 1024;	/* default */
 }
 
 /*
@@ -797,6 +811,8 @@ GDKreset(int status, int exit)
 		memset((char*) THRprintbuf,0, sizeof(THRprintbuf));
 		gdk_bbp_reset();
 		MT_lock_unset(&GDKthreadLock);
+		/* the threads are gone, a later GDKinit starts them again */
+		ATOMIC_CLEAR(GDKstopped, GDKstoppedLock);
 		//gdk_system_reset(); CHECK OUT
 	}
 #ifndef HAVE_EMBEDDED
@@ -1418,6 +1434,53 @@ THRprintf(stream *s, const char *format, ...)
 	return n;
 }
 
+/*
+ * Run f on each of the n argument blocks of size bytes starting at
+ * args, all but the first on a thread of their own.  The calling
+ * thread does the first block, and also any block for which no
+ * thread could be started.  Returns when all blocks are done.
+ */
+void
+GDKparallel(int n, void (*f)(void *), void *args, size_t size)
+{
+	MT_Id *tids = NULL;
+	int i, started = 1;
+
+	if (n > 1)
+		tids = GDKmalloc(n * sizeof(MT_Id));
+	if (tids) {
+		for (; started < n; started++)
+			if (MT_create_thread(&tids[started], f,
+					     (char *) args + started * size,
+					     MT_THR_JOINABLE) < 0)
+				break;
+	}
+	f(args);
+	for (i = started; i < n; i++)
+		f((char *) args + i * size);
+	for (i = 1; i < started; i++)
+		MT_join_thread(tids[i]);
+	GDKfree(tids);
+}
+
+static void (*progresshook)(void *, BUN, BUN);
+
+void
+GDKsetprogress(void (*hook)(void *arg, BUN done, BUN total))
+{
+	progresshook = hook;
+}
+
+void
+GDKprogress(BUN done, BUN total)
+{
+	void (*hook)(void *, BUN, BUN) = progresshook;
+	void *arg;
+
+	if (hook && (arg = GDKprogressarg) != NULL)
+		(*hook)(arg, done, total);
+}
+
 static const char *_gdk_version_string = VERSION;
 /**
  * Returns the GDK version as internally allocated string.  Hence the
@@ -69,9 +69,11 @@ gdk_export gdk_return GDKsetenv(const char *name, const char *value);
 /* virtual memory defines */
 gdk_export size_t _MT_npages;
 gdk_export size_t _MT_pagesize;
+gdk_export size_t _MT_cachesize;
 
 #define MT_pagesize()	_MT_pagesize
 #define MT_npages()	_MT_npages
+#define MT_cachesize()	_MT_cachesize
 
 gdk_export void MT_init(void);	/*  init the package. */
 gdk_export int GDKinit(opt *set, int setlen);
@@ -100,6 +102,17 @@ gdk_export const char *GDKversion(void);
 
 gdk_export gdk_return GDKextractParentAndLastDirFromPath(const char *path, char *last_dir_parent, char *last_dir);
 
+/* Long running operations (such as building an index) report their
+ * progress with GDKprogress.  If a hook was set with GDKsetprogress,
+ * it is called with the progress argument of the calling thread (see
+ * GDKsetprogressarg), the amount of work done, and the total. */
+gdk_export void GDKsetprogress(void (*hook)(void *arg, BUN done, BUN total));
+gdk_export void GDKprogress(BUN done, BUN total);
+
+/* Call f on each of the n blocks of size bytes starting at args in
+ * parallel and wait for all of them to finish. */
+gdk_export void GDKparallel(int n, void (*f)(void *), void *args, size_t size);
+
 // these are used in embedded mode to jump out of GDKfatal
 gdk_export jmp_buf GDKfataljump;
 gdk_export str GDKfatalmsg;
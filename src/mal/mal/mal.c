@@ -98,6 +98,9 @@ int mal_init(void){
 	initHeartbeat();
 #endif
 	initResource();
+#ifdef HAVE_EMBEDDED
+	GDKsetprogress(runtimeProgress);
+#endif
 	if( malBootstrap() == 0)
 		return -1;
 	/* set up the profiler if needed, output sent to console */
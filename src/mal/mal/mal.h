@@ -162,6 +162,7 @@ typedef struct VARRECORD {
 	int eolife;					/* pc index when it should be garbage collected */
 	int stc;				    /* pc index for rendering schema.table.column  */
 	BUN rowcnt;					/* estimated row count*/
+	int rowsize;				/* estimated bytes per row */
 } *VarPtr, VarRecord;
 
 /* For performance analysis we keep track of the number of calls and
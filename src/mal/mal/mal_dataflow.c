@@ -43,7 +43,8 @@ typedef struct FLOWEVENT {
 	int pc;         /* pc in underlying malblock */
 	int blocks;     /* awaiting for variables */
 	sht state;      /* of execution */
-	lng clk;
+	lng clk;        /* when it was queued */
+	int worker;     /* lane of the worker that executed it */
 	sht cost;
 	lng hotclaim;   /* memory foot print of result variables */
 	lng argclaim;   /* memory foot print of arguments */
@@ -53,12 +54,38 @@ typedef struct FLOWEVENT {
 typedef struct queue {
 	int size;	/* size of queue */
 	int last;	/* last element in the queue */
-	int exitcount;	/* how many threads should exit */
 	FlowEvent *data;
 	MT_Lock l;	/* it's a shared resource, ie we need locks */
 	MT_Sema s;	/* threads wait on empty queues */
 } Queue;
 
+/*
+ * The pending instructions are kept in one lane per worker slot, each
+ * with its own lock, so workers do not all contend for one queue.
+ * Instructions made eligible by a result are put on the lane of the
+ * worker that produced it, which pops its own lane LIFO and thus finds
+ * the data still in its caches.  A worker with an empty lane steals
+ * the oldest instruction of another lane, which also keeps the
+ * clients that share the pool from starving each other.
+ * The semaphore counts the instructions over all lanes.
+ */
+typedef struct lane {
+	int first;	/* oldest element, where thieves take from */
+	int last;	/* one past the newest element */
+	int size;
+	FlowEvent *data;
+	MT_Lock l;
+} Lane;
+
+typedef struct todolist {
+	MT_Lock l;	/* protects exitcount */
+	MT_Sema s;	/* threads wait for pending instructions */
+	int exitcount;	/* how many threads should exit */
+	volatile ATOMIC_TYPE pending;	/* instructions over all lanes */
+	volatile ATOMIC_TYPE nlanes;	/* lanes in use, highest worker slot + 1 */
+	Lane lanes[THREADS];
+} TodoList;
+
 /*
  * The dataflow dependency is administered in a graph list structure.
  * For each instruction we keep the list of instructions that
@@ -75,6 +102,8 @@ typedef struct DATAFLOW {
 	int *edges;         /* dependency graph */
 	MT_Lock flowlock;   /* lock to protect the above */
 	Queue *done;        /* instructions handled */
+	volatile ATOMIC_TYPE steals;	/* instructions taken from another lane */
+	volatile ATOMIC_TYPE waited;	/* usec instructions spent queued */
 } *DataFlow, DataFlowRec;
 
 static struct worker {
@@ -84,25 +113,24 @@ static struct worker {
 	MT_Sema s;
 } workers[THREADS];
 
-static Queue *todo = 0;	/* pending instructions */
+static TodoList *todo = 0;	/* pending instructions */
 
 #ifdef ATOMIC_LOCK
 static MT_Lock exitingLock MT_LOCK_INITIALIZER("exitingLock");
+static MT_Lock todoLock MT_LOCK_INITIALIZER("todoLock");
 #endif
 static volatile ATOMIC_TYPE exiting = 0;
 static MT_Lock dataflowLock MT_LOCK_INITIALIZER("dataflowLock");
 
+static void todo_destroy(TodoList *t);
+
 void
 mal_dataflow_reset(void)
 {
 	stopMALdataflow();
 	memset((char*) workers, 0,  sizeof(workers));
-	if( todo) {
-		GDKfree(todo->data);
-		MT_lock_destroy(&todo->l);
-		MT_sema_destroy(&todo->s);
-		GDKfree(todo);
-	}
+	if( todo)
+		todo_destroy(todo);
 	todo = 0;	/* pending instructions */
 	exiting = 0;
 }
@@ -141,8 +169,6 @@ q_create(int sz, const char *name)
 		GDKfree(q);
 		return NULL;
 	}
-	q->exitcount = 0;
-
 	MT_lock_init(&q->l, name);
 	MT_sema_init(&q->s, 0, name);
 	return q;
@@ -183,6 +209,103 @@ q_enqueue(Queue *q, FlowEvent d)
 	MT_sema_up(&q->s);
 }
 
+static FlowEvent
+q_dequeue(Queue *q)
+{
+	FlowEvent r = NULL;
+
+	assert(q);
+	MT_sema_down(&q->s);
+	if (ATOMIC_GET(exiting, exitingLock))
+		return NULL;
+	MT_lock_set(&q->l);
+	assert(q->last > 0);
+	if (q->last > 0) {
+		/* LIFO favors garbage collection */
+		r = q->data[--q->last];
+		q->data[q->last] = 0;
+	}
+	/* else: terminating */
+	MT_lock_unset(&q->l);
+	assert(r);
+	return r;
+}
+
+static TodoList*
+todo_create(void)
+{
+	TodoList *t = (TodoList*)GDKzalloc(sizeof(TodoList));
+	int i;
+
+	if (t == NULL)
+		return NULL;
+	for (i = 0; i < THREADS; i++)
+		MT_lock_init(&t->lanes[i].l, "todo lane");
+	MT_lock_init(&t->l, "todo");
+	MT_sema_init(&t->s, 0, "todo");
+	return t;
+}
+
+static void
+todo_destroy(TodoList *t)
+{
+	int i;
+
+	assert(t);
+	for (i = 0; i < THREADS; i++) {
+		MT_lock_destroy(&t->lanes[i].l);
+		GDKfree(t->lanes[i].data);
+	}
+	MT_lock_destroy(&t->l);
+	MT_sema_destroy(&t->s);
+	GDKfree(t);
+}
+
+static void
+lane_use(int lane)
+{
+	while ((int) ATOMIC_GET(todo->nlanes, todoLock) <= lane)
+		ATOMIC_SET(todo->nlanes, lane + 1, todoLock);
+}
+
+/* make room for one more element, compacting the lane first */
+static void
+lane_grow(Lane *l)
+{
+	if (l->first > 0 && l->first == l->last) {
+		l->first = l->last = 0;
+	}
+	if (l->last < l->size)
+		return;
+	if (l->first > 0) {
+		memmove(l->data, l->data + l->first, (l->last - l->first) * sizeof(FlowEvent));
+		l->last -= l->first;
+		l->first = 0;
+		return;
+	}
+	l->size = l->size ? l->size << 1 : 64;
+	l->data = (FlowEvent*) GDKrealloc(l->data, sizeof(FlowEvent) * l->size);
+	assert(l->data);
+}
+
+static void
+todo_enqueue(int lane, FlowEvent d)
+{
+	Lane *l;
+
+	assert(todo);
+	assert(d);
+	assert(lane >= 0 && lane < THREADS);
+	l = &todo->lanes[lane];
+	d->clk = GDKusec();
+	MT_lock_set(&l->l);
+	lane_grow(l);
+	l->data[l->last++] = d;
+	MT_lock_unset(&l->l);
+	(void) ATOMIC_INC(todo->pending, todoLock);
+	MT_sema_up(&todo->s);
+}
+
 /*
  * A priority queue over the hot claims of memory may
  * be more effective. It priorizes those instructions
@@ -190,113 +313,134 @@ q_enqueue(Queue *q, FlowEvent d)
  */
 
 #ifdef USE_MAL_ADMISSION
+/* put it at the old end of the lane, the owner gets to it last */
 static void
-q_requeue_(Queue *q, FlowEvent d)
+todo_requeue(int lane, FlowEvent d)
 {
-	int i;
+	Lane *l;
 
-	assert(q);
+	assert(todo);
 	assert(d);
-	if (q->last == q->size) {
-		/* enlarge buffer */
-		q->size <<= 1;
-		q->data = (FlowEvent*) GDKrealloc(q->data, sizeof(FlowEvent) * q->size);
-		assert(q->data);
+	l = &todo->lanes[lane];
+	MT_lock_set(&l->l);
+	lane_grow(l);
+	if (l->first > 0) {
+		l->data[--l->first] = d;
+	} else {
+		memmove(l->data + 1, l->data, l->last * sizeof(FlowEvent));
+		l->data[0] = d;
+		l->last++;
+	}
+	MT_lock_unset(&l->l);
+	(void) ATOMIC_INC(todo->pending, todoLock);
+	MT_sema_up(&todo->s);
+}
+#endif
+
+static FlowEvent
+lane_take(Lane *l, int i)
+{
+	FlowEvent r = l->data[i];
+
+	if (i == l->first) {
+		l->first++;
+	} else {
+		memmove(l->data + i, l->data + i + 1, (l->last - i - 1) * sizeof(FlowEvent));
+		l->last--;
 	}
-	for (i = q->last; i > 0; i--)
-		q->data[i] = q->data[i - 1];
-	q->data[0] = d;
-	q->last++;
+	return r;
 }
+
 static void
-q_requeue(Queue *q, FlowEvent d)
+todo_taken(FlowEvent r, int stolen)
 {
-	assert(q);
-	assert(d);
-	MT_lock_set(&q->l);
-	q_requeue_(q, d);
-	MT_lock_unset(&q->l);
-	MT_sema_up(&q->s);
+	(void) ATOMIC_DEC(todo->pending, todoLock);
+	(void) ATOMIC_ADD(r->flow->waited, (ATOMIC_TYPE) (GDKusec() - r->clk), todoLock);
+	if (stolen)
+		(void) ATOMIC_INC(r->flow->steals, todoLock);
 }
-#endif
 
+/*
+ * Workers of the pool first pop their own lane, then steal from the
+ * others.  A worker dedicated to a client looks in all lanes for the
+ * instruction of its client with the lowest pc.
+ */
 static FlowEvent
-q_dequeue(Queue *q, Client cntxt)
+todo_dequeue(int lane, Client cntxt)
 {
-	FlowEvent r = NULL, s = NULL;
-	//int i;
+	FlowEvent r = NULL;
+	int i, n, k;
+	Lane *l;
 
-	assert(q);
-	MT_sema_down(&q->s);
+	assert(todo);
+	MT_sema_down(&todo->s);
 	if (ATOMIC_GET(exiting, exitingLock))
 		return NULL;
-	MT_lock_set(&q->l);
 	if (cntxt) {
-		int i, minpc = -1;
-
-		for (i = q->last - 1; i >= 0; i--) {
-			if (q->data[i]->flow->cntxt == cntxt) {
-				if(minpc < 0){
-					minpc = i;
-					s = q->data[i];
-				}
-				r = q->data[i];
-				if( s && r && s->pc > r->pc){
-					minpc = i;
-					s = r;
+		Lane *best = NULL;
+		int bi = -1;
+
+		n = (int) ATOMIC_GET(todo->nlanes, todoLock);
+		for (k = 0; k < n; k++) {
+			l = &todo->lanes[k];
+			MT_lock_set(&l->l);
+			for (i = l->first; i < l->last; i++) {
+				if (l->data[i]->flow->cntxt == cntxt &&
+					(r == NULL || l->data[i]->pc < r->pc)) {
+					if (best && best != l)
+						MT_lock_unset(&best->l);
+					best = l;
+					bi = i;
+					r = l->data[i];
 				}
 			}
+			if (best != l)
+				MT_lock_unset(&l->l);
+		}
+		if (best) {
+			r = lane_take(best, bi);
+			MT_lock_unset(&best->l);
+			todo_taken(r, best != &todo->lanes[lane]);
 		}
-		if( minpc >= 0){
-			r = q->data[minpc];
-			i = minpc;
-			q->last--;
-			while (i < q->last) {
-				q->data[i] = q->data[i + 1];
-				i++;
-			}
-		} else r = NULL;
-
-		MT_lock_unset(&q->l);
 		return r;
 	}
-	if (q->exitcount > 0) {
-		q->exitcount--;
-		MT_lock_unset(&q->l);
+	MT_lock_set(&todo->l);
+	if (todo->exitcount > 0) {
+		todo->exitcount--;
+		MT_lock_unset(&todo->l);
 		return NULL;
 	}
-	assert(q->last > 0);
-	if (q->last > 0) {
-		/* LIFO favors garbage collection */
-		r = q->data[--q->last];
-/*  Line coverage test shows it is an expensive loop that is hardly ever leads to adjustment
-		for(i= q->last-1; r &&  i>=0; i--){
-			s= q->data[i];
-			if( s && s->flow && s->flow->stk &&
-			    r && r->flow && r->flow->stk &&
-			    s->flow->stk->tag < r->flow->stk->tag){
-				q->data[i]= r;
-				r = s;
+	MT_lock_unset(&todo->l);
+
+	/* the semaphore promised us an instruction, keep looking until we
+	 * have it */
+	for (;;) {
+		l = &todo->lanes[lane];
+		MT_lock_set(&l->l);
+		if (l->last > l->first) {
+			/* LIFO favors garbage collection */
+			r = l->data[--l->last];
+			MT_lock_unset(&l->l);
+			todo_taken(r, 0);
+			return r;
+		}
+		MT_lock_unset(&l->l);
+		n = (int) ATOMIC_GET(todo->nlanes, todoLock);
+		for (k = 1; k < n; k++) {
+			l = &todo->lanes[(lane + k) % n];
+			MT_lock_set(&l->l);
+			if (l->last > l->first) {
+				r = l->data[l->first++];
+				MT_lock_unset(&l->l);
+				todo_taken(r, 1);
+				return r;
 			}
+			MT_lock_unset(&l->l);
 		}
-*/
-		q->data[q->last] = 0;
-	}
-	/* else: terminating */
-	/* try out random draw *
-	{
-		int i;
-		i = rand() % q->last;
-		r = q->data[i];
-		for (i++; i < q->last; i++)
-			q->data[i - 1] = q->data[i];
-		q->last--; i
+		if (ATOMIC_GET(exiting, exitingLock))
+			return NULL;
+		MT_sleep_ms(0);
 	}
-	 */
-
-	MT_lock_unset(&q->l);
-	assert(r);
-	return r;
 }
 
 /*
@@ -329,6 +473,9 @@ DFLOWworker(void *T)
 	int i,last;
 	Client cntxt;
 	InstrPtr p;
+#ifdef HAVE_EMBEDDED
+	Client progress = NULL;
+#endif
 
 	thr = THRnew("DFLOWworker");
 
@@ -352,7 +499,7 @@ DFLOWworker(void *T)
 			MT_lock_set(&dataflowLock);
 			cntxt = t->cntxt;
 			MT_lock_unset(&dataflowLock);
-			fe = q_dequeue(todo, cntxt);
+			fe = todo_dequeue(id, cntxt);
 			if (fe == NULL) {
 				if (cntxt) {
 					/* we're not done yet with work for the current
@@ -376,6 +523,8 @@ DFLOWworker(void *T)
 		assert(fe);
 		flow = fe->flow;
 		assert(flow);
+		/* what it enables goes onto our lane */
+		fe->worker = id;
 
 		/* whenever we have a (concurrent) error, skip it */
 		MT_lock_set(&flow->flowlock);
@@ -393,12 +542,21 @@ DFLOWworker(void *T)
 			if( p->fcn != (MALfcn) deblockdataflow){
 				fe->hotclaim = 0;   /* don't assume priority anymore */
 				fe->maxclaim = 0;
-				if (todo->last == 0)
+				if (ATOMIC_GET(todo->pending, todoLock) == 0)
 					MT_sleep_ms(DELAYUNIT);
-				q_requeue(todo, fe);
+				todo_requeue(id, fe);
 				continue;
 			}
 		}
+#endif
+#ifdef HAVE_EMBEDDED
+		/* kernel progress goes to the client of the flow; workers
+		 * are shared, so only switch when the client changes */
+		if (flow->cntxt != progress) {
+			GDKsetprogressarg(NULL);
+			progress = flow->cntxt;
+			GDKsetprogressarg(progress);
+		}
 #endif
 		error = runMALsequence(flow->cntxt, flow->mb, fe->pc, fe->pc + 1, flow->stk, 0, 0);
 		PARDEBUG fprintf(stderr, "#executed pc= %d wrk= %d claim= " LLFMT "," LLFMT "," LLFMT " %s\n",
@@ -468,11 +626,7 @@ DFLOWworker(void *T)
 
 		q_enqueue(flow->done, fe);
 		if ( fnxt == 0 && malProfileMode) {
-			int last;
-			MT_lock_set(&todo->l);
-			last = todo->last;
-			MT_lock_unset(&todo->l);
-			if (last == 0)
+			if (ATOMIC_GET(todo->pending, todoLock) == 0)
 				profilerHeartbeatEvent("wait");
 		}
 	}
@@ -503,7 +657,7 @@ DFLOWinitialize(void)
 		MT_lock_unset(&mal_contextLock);
 		return 0;
 	}
-	todo = q_create(2048, "todo");
+	todo = todo_create();
 	if (todo == NULL) {
 		MT_lock_unset(&mal_contextLock);
 		return -1;
@@ -519,6 +673,7 @@ DFLOWinitialize(void)
 	for (i = 0; i < limit; i++) {
 		workers[i].flag = RUNNING;
 		workers[i].cntxt = NULL;
+		lane_use(i);
 		if (MT_create_thread(&workers[i].id, DFLOWworker, (void *) &workers[i], MT_THR_JOINABLE) < 0)
 			workers[i].flag = IDLE;
 		else
@@ -527,7 +682,7 @@ DFLOWinitialize(void)
 	MT_lock_unset(&dataflowLock);
 	if (created == 0) {
 		/* no threads created */
-		q_destroy(todo);
+		todo_destroy(todo);
 		todo = NULL;
 		MT_lock_unset(&mal_contextLock);
 		return -1;
@@ -715,7 +870,7 @@ DFLOWscheduler(DataFlow flow, struct worker *w)
 	int j;
 	InstrPtr p;
 #endif
-	int tasks=0, actions;
+	int tasks=0, actions, lanes, lane = 0;
 	str ret = MAL_SUCCEED;
 	FlowEvent fe, f = 0;
 
@@ -726,6 +881,7 @@ DFLOWscheduler(DataFlow flow, struct worker *w)
 		throw(MAL, "dataflow", "Empty dataflow block");
 	/* initialize the eligible statements */
 	fe = flow->status;
+	lanes = (int) ATOMIC_GET(todo->nlanes, todoLock);
 
 	MT_lock_set(&flow->flowlock);
 	for (i = 0; i < actions; i++)
@@ -739,7 +895,8 @@ DFLOWscheduler(DataFlow flow, struct worker *w)
 			for (j = p->retc; j < p->argc; j++)
 				fe[i].argclaim = getMemoryClaim(fe[0].flow->mb, fe[0].flow->stk, p, j, FALSE);
 #endif
-			q_enqueue(todo, flow->status + i);
+			/* spread the initial work over the lanes */
+			todo_enqueue(lane++ % lanes, flow->status + i);
 			flow->status[i].state = DFLOWrunning;
 			PARDEBUG fprintf(stderr, "#enqueue pc=%d claim=" LLFMT "\n", flow->status[i].pc, flow->status[i].argclaim);
 		}
@@ -749,7 +906,7 @@ DFLOWscheduler(DataFlow flow, struct worker *w)
 	PARDEBUG fprintf(stderr, "#run %d instructions in dataflow block\n", actions);
 
 	while (actions != tasks ) {
-		f = q_dequeue(flow->done, NULL);
+		f = q_dequeue(flow->done);
 		if (ATOMIC_GET(exiting, exitingLock))
 			break;
 		if (f == NULL)
@@ -769,7 +926,8 @@ DFLOWscheduler(DataFlow flow, struct worker *w)
 				if (flow->status[i].blocks == 1 ) {
 					flow->status[i].state = DFLOWrunning;
 					flow->status[i].blocks--;
-					q_enqueue(todo, flow->status + i);
+					/* on the lane of the worker that has its input */
+					todo_enqueue(f->worker, flow->status + i);
 					PARDEBUG fprintf(stderr, "#enqueue pc=%d claim= " LLFMT "\n", flow->status[i].pc, flow->status[i].argclaim);
 				} else {
 					flow->status[i].blocks--;
@@ -885,6 +1043,7 @@ runMALdataflow(Client cntxt, MalBlkPtr mb, int startpc, int stoppc, MalStkPtr st
 				workers[i].cntxt = cntxt;
 			}
 			workers[i].flag = RUNNING;
+			lane_use(i);
 			if (MT_create_thread(&workers[i].id, DFLOWworker, (void *) &workers[i], MT_THR_JOINABLE) < 0) {
 				/* cannot start new thread, run serially */
 				*ret = TRUE;
@@ -954,6 +1113,11 @@ runMALdataflow(Client cntxt, MalBlkPtr mb, int startpc, int stoppc, MalStkPtr st
 	if (msg == MAL_SUCCEED)
 		msg = DFLOWscheduler(flow, &workers[i]);
 
+	if (malProfileMode)
+		profilerSchedulerEvent(stoppc - startpc - 1,
+			(lng) ATOMIC_GET(flow->steals, todoLock),
+			(lng) ATOMIC_GET(flow->waited, todoLock));
+
 	GDKfree(flow->status);
 	GDKfree(flow->edges);
 	GDKfree(flow->nodes);
@@ -697,6 +697,7 @@ newVariable(MalBlkPtr mb, const char *name, size_t len, malType type)
 	}
 
 	setRowCnt(mb,n,0);
+	setRowSize(mb,n,0);
 	setVarType(mb, n, type);
 	clrVarFixed(mb, n);
 	clrVarUsed(mb, n);
@@ -784,6 +785,7 @@ clearVariable(MalBlkPtr mb, int varid)
 	v->initialized= 0;
 	v->used= 0;
 	v->rowcnt = 0;
+	v->rowsize = 0;
 	v->eolife = 0;
 	v->stc = 0;
 }
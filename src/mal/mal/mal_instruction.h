@@ -109,6 +109,8 @@
 
 #define setRowCnt(M,I,C)	(M)->var[I].rowcnt = C
 #define getRowCnt(M,I)		((M)->var[I].rowcnt)
+#define setRowSize(M,I,C)	(M)->var[I].rowsize = C
+#define getRowSize(M,I)		((M)->var[I].rowsize)
 
 #define setMitosisPartition(P,C)	(P)->mitosis = C
 #define getMitosisPartition(P)		((P)->mitosis)
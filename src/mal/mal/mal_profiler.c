@@ -425,6 +425,29 @@ profilerHeartbeatEvent(char *alter)
 	logjsonInternal(logbuffer);
 }
 
+/* Summary of a dataflow block: how much work was moved between
+ * worker lanes and how long instructions sat in the queues. */
+void
+profilerSchedulerEvent(int tasks, lng steals, lng waited)
+{
+	char logbuffer[LOGLEN], *logbase;
+	int loglen;
+
+	if (eventstream == NULL)
+		return;
+
+	lognew();
+	logadd("{%s",prettify); // fill in later with the event counter
+	logadd("\"user\":\"scheduler\",%s", prettify);
+	logadd("\"clk\":"LLFMT",%s", GDKusec(), prettify);
+	logadd("\"thread\":%d,%s", THRgettid(), prettify);
+	logadd("\"tasks\":%d,%s", tasks, prettify);
+	logadd("\"steals\":"LLFMT",%s", steals, prettify);
+	logadd("\"waitusec\":"LLFMT"%s", waited, prettify);
+	logadd("}\n"); // end marker
+	logjsonInternal(logbuffer);
+}
+
 void
 profilerEvent(MalBlkPtr mb, MalStkPtr stk, InstrPtr pci, int start, str usrname)
 {
@@ -38,6 +38,7 @@ mal_export void setHeartbeat(int delay);
 mal_export str setprofilerpoolsize(int size);
 mal_export void initHeartbeat(void);
 mal_export void profilerHeartbeatEvent(char *alter);
+mal_export void profilerSchedulerEvent(int tasks, lng steals, lng waited);
 mal_export int getprofilerlimit(void);
 mal_export void setprofilerlimit(int limit);
 
@@ -183,6 +183,26 @@ finishSessionProfiler(Client cntxt)
 #endif
 }
 
+#ifdef HAVE_EMBEDDED
+/* progress reported by the kernel during an instruction counts as
+ * part of that instruction */
+void
+runtimeProgress(void *arg, BUN done, BUN total)
+{
+	Client cntxt = arg;
+	float perc;
+
+	if (!cntxt->progress_callback || total == 0 || cntxt->progress_len == 0)
+		return;
+	MT_lock_set(&cntxt->progress_lock);
+	perc = (cntxt->progress_done + (float) done / total) / cntxt->progress_len;
+	if (perc > 1) perc = 1;
+	if (perc < 0) perc = 0;
+	cntxt->progress_callback(cntxt, cntxt->progress_data, cntxt->progress_len, cntxt->progress_done, perc);
+	MT_lock_unset(&cntxt->progress_lock);
+}
+#endif
+
 void
 runtimeProfileBegin(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci, RuntimeProfile prof)
 {
@@ -53,6 +53,18 @@ typedef struct{
 	MULTIarg *args;
 } MULTItask;
 
+/* Large inputs are cut into vectors of MANIFOLD_VECTOR rows, which
+ * are handed out to GDK threads one at a time. */
+#define MANIFOLD_VECTOR 4096
+
+typedef struct{
+	MULTItask *mut;
+	MT_Lock lock;
+	BUN next;		/* first row not handed out yet */
+	BUN cnt;
+	str msg;		/* first error message received */
+} MULTIpar;
+
 
 // Loop through the first BAT
 // keep the last error message received
@@ -158,7 +170,9 @@ MANIFOLDjob(MULTItask *mut)
 	// the mod.fcn arguments are ignored from the call
 	for( i = mut->pci->retc+2; i< mut->pci->argc; i++) {
 		if ( mut->args[i].b ){
-			if(ATOMstorage(mut->args[i].type) < TYPE_str){ 	
+			if(ATOMstorage(mut->args[i].type) == TYPE_void){
+				args[i] = (void*) &mut->args[i].o;
+			} else if(ATOMstorage(mut->args[i].type) < TYPE_str){ 	
 				args[i] = (char*) mut->args[i].first;
 			} else if(ATOMvarsized(mut->args[i].type)){	
 				mut->args[i].s = (str*) BUNtail(mut->args[i].bi, mut->args[i].o);
@@ -192,11 +206,84 @@ bunins_failed:
 	return msg;
 }
 
-/* The manifold optimizer should check for the possibility
- * to use this implementation instead of the MAL loop.
- */
-MALfcn
-MANIFOLDtypecheck(Client cntxt, MalBlkPtr mb, InstrPtr pci, int checkprops){
+/* Position the iterators of mut on the cnt rows starting at lo */
+static void
+MANIFOLDseek(MULTItask *mut, const MULTIarg *src, BUN lo, BUN cnt)
+{
+	int i;
+
+	for (i = 0; i < mut->pci->argc; i++) {
+		MULTIarg *a = &mut->args[i];
+
+		*a = src[i];
+		if (a->b == NULL)
+			continue;
+		a->cnt = cnt;
+		if (ATOMstorage(a->type) == TYPE_void)
+			a->o = a->b->tseqbase + lo;
+		else if (ATOMstorage(a->type) < TYPE_str)
+			a->first = Tloc(a->b, lo);
+		else
+			a->o = lo;
+	}
+}
+
+static void
+MANIFOLDworker(void *arg)
+{
+	MULTIpar *par = *(MULTIpar **) arg;
+	MULTItask mut = *par->mut;
+	str msg = MAL_SUCCEED;
+	BUN lo, n;
+
+	mut.args = (MULTIarg *) GDKmalloc(sizeof(MULTIarg) * mut.pci->argc);
+	if (mut.args == NULL)
+		msg = createException(MAL, "mal.manifold", MAL_MALLOC_FAIL);
+	while (msg == MAL_SUCCEED) {
+		MT_lock_set(&par->lock);
+		lo = par->msg ? par->cnt : par->next;
+		n = MIN(par->cnt - lo, (BUN) MANIFOLD_VECTOR);
+		par->next = lo + n;
+		MT_lock_unset(&par->lock);
+		if (n == 0)
+			break;
+		MANIFOLDseek(&mut, par->mut->args, lo, n);
+		msg = MANIFOLDjob(&mut);
+	}
+	GDKfree(mut.args);
+	if (msg) {
+		MT_lock_set(&par->lock);
+		if (par->msg == NULL)
+			par->msg = msg;
+		else
+			freeException(msg);
+		MT_lock_unset(&par->lock);
+	}
+}
+
+/* results written in place, at disjoint positions per vector */
+static int
+MANIFOLDfixed(int tpe)
+{
+	switch (ATOMstorage(tpe)) {
+	case TYPE_bte:
+	case TYPE_sht:
+	case TYPE_int:
+	case TYPE_lng:
+#ifdef HAVE_HGE
+	case TYPE_hge:
+#endif
+	case TYPE_oid:
+	case TYPE_flt:
+	case TYPE_dbl:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+static MALfcn
+MANIFOLDresolve(Client cntxt, MalBlkPtr mb, InstrPtr pci, int checkprops, int *unsafe){
 	int i, k, tpe= 0;
 	InstrPtr q=0;
 	MalBlkPtr nmb;
@@ -242,6 +329,8 @@ MANIFOLDtypecheck(Client cntxt, MalBlkPtr mb, InstrPtr pci, int checkprops){
 		fcn = NULL;
 	else {
 		fcn = q->fcn;
+		if (unsafe)
+			*unsafe = q->blk && q->blk->unsafeProp;
 		// retain the type detected
 		if ( !isVarFixed(mb, getArg(pci,0)))
 			setVarType( mb, getArg(pci,0), newBatType(getArgType(nmb,q,0)) );
@@ -254,6 +343,14 @@ MANIFOLDtypecheck(Client cntxt, MalBlkPtr mb, InstrPtr pci, int checkprops){
 	return fcn;
 }
 
+/* The manifold optimizer should check for the possibility
+ * to use this implementation instead of the MAL loop.
+ */
+MALfcn
+MANIFOLDtypecheck(Client cntxt, MalBlkPtr mb, InstrPtr pci, int checkprops){
+	return MANIFOLDresolve(cntxt, mb, pci, checkprops, NULL);
+}
+
 /*
  * The manifold should support aligned BATs as well
  */
@@ -261,13 +358,12 @@ str
 MANIFOLDevaluate(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci){
 	MULTItask mut;
 	MULTIarg *mat;
-	int i, tpe= 0;
+	int i, tpe= 0, unsafe = 0;
 	BUN cnt = 0;
-	oid o = 0;
 	str msg = MAL_SUCCEED;
 	MALfcn fcn;
 
-	fcn= MANIFOLDtypecheck(cntxt,mb,pci,0);
+	fcn= MANIFOLDresolve(cntxt,mb,pci,0,&unsafe);
 	if( fcn == NULL)
 		throw(MAL, "mal.manifold", "Illegal manifold function call");
 
@@ -305,15 +401,25 @@ MANIFOLDevaluate(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci){
 			else
 				mat[i].size = ATOMsize(tpe);
 			mat[i].cnt = cnt;
+			if ( mat[i].b->ttype == TYPE_void && mat[i].b->tseqbase == oid_nil){
+				BAT *b = COLcopy(mat[i].b, TYPE_oid, 1, TRANSIENT);
+
+				BBPunfix(mat[i].b->batCacheid);
+				if ((mat[i].b = b) == NULL){
+					msg = createException(MAL,"mal.manifold", MAL_MALLOC_FAIL);
+					goto wrapup;
+				}
+			}
 			if ( mat[i].b->ttype == TYPE_void){
-				o = mat[i].b->tseqbase;
-				mat[i].first = mat[i].last = (void*) &o;
+				// dense oids are generated from o
+				mat[i].type = TYPE_void;
+				mat[i].first = mat[i].last = NULL;
 			} else {
 				mat[i].first = (void*)  Tloc(mat[i].b, 0);
 				mat[i].last = (void*) Tloc(mat[i].b, BUNlast(mat[i].b));
 			}
 			mat[i].bi = bat_iterator(mat[i].b);
-			mat[i].o = 0;
+			mat[i].o = mat[i].type == TYPE_void ? mat[i].b->tseqbase : 0;
 			mat[i].q = BUNlast(mat[i].b);
 		} else {
 			mat[i].last = mat[i].first = (void *) getArgReference(stk,pci,i);
@@ -336,13 +442,37 @@ MANIFOLDevaluate(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci){
 	mat[0].b->tnonil=0;
 	mat[0].b->tsorted=0;
 	mat[0].b->trevsorted=0;
+	mat[0].type = mat[0].b->ttype;
 	mat[0].bi = bat_iterator(mat[0].b);
 	mat[0].first = (void *)  Tloc(mat[0].b, 0);
 	mat[0].last = (void *)  Tloc(mat[0].b, BUNlast(mat[0].b));
 
 	mut.pci = copyInstruction(pci);
 	mut.pci->fcn = fcn;
-	msg = MANIFOLDjob(&mut);
+	if (!unsafe && GDKnr_threads > 1 && cnt >= 2 * MANIFOLD_VECTOR &&
+	    MANIFOLDfixed(mat[0].b->ttype)) {
+		// side effect free calls with a fixed size result run in parallel
+		int nthreads = (int) MIN((BUN) GDKnr_threads, (cnt + MANIFOLD_VECTOR - 1) / MANIFOLD_VECTOR);
+		MULTIpar par, **pars;
+
+		pars = (MULTIpar **) GDKmalloc(sizeof(MULTIpar *) * nthreads);
+		if (pars == NULL) {
+			msg = createException(MAL,"mal.manifold",MAL_MALLOC_FAIL);
+		} else {
+			par.mut = &mut;
+			par.next = 0;
+			par.cnt = cnt;
+			par.msg = MAL_SUCCEED;
+			MT_lock_init(&par.lock, "manifold");
+			for (i = 0; i < nthreads; i++)
+				pars[i] = &par;
+			GDKparallel(nthreads, MANIFOLDworker, pars, sizeof(MULTIpar *));
+			MT_lock_destroy(&par.lock);
+			GDKfree(pars);
+			msg = par.msg;
+		}
+	} else
+		msg = MANIFOLDjob(&mut);
 	freeInstruction(mut.pci);
 
 	// consolidate the properties
@@ -240,8 +240,11 @@ OIDXgetorderidx(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 		BBPunfix(b->batCacheid);
 		throw(MAL, "bat.getorderidx", MAL_MALLOC_FAIL);
 	}
-	memcpy(Tloc(bn, 0), (const oid *) b->torderidx->base + ORDERIDXOFF,
-		   BATcount(b) * SIZEOF_OID);
+	if (OIDXcopy(b, (oid *) Tloc(bn, 0)) != GDK_SUCCEED) {
+		BBPunfix(b->batCacheid);
+		BBPreclaim(bn);
+		throw(MAL, "bat.getorderidx", MAL_MALLOC_FAIL);
+	}
 	BATsetcount(bn, BATcount(b));
 	bn->tkey = 1;
 	bn->tsorted = bn->trevsorted = BATcount(b) <= 1;
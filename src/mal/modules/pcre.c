@@ -135,22 +135,196 @@ strcasestr(const char *haystack, const char *needle)
 		}														\
 	} while (0)
 
+/* Most LIKE patterns used in practice are a literal with a % on
+ * either or both ends.  Those are classified once and matched with
+ * plain string functions instead of going through STRlike for every
+ * value; anything else still uses STRlike. */
+typedef enum {
+	LIKE_GENERAL,				/* anything else: use STRlike */
+	LIKE_NIL,					/* nil: the outcome is nil */
+	LIKE_ANY,					/* '%' */
+	LIKE_EXACT,					/* 'abc' */
+	LIKE_PREFIX,				/* 'abc%' */
+	LIKE_SUFFIX,				/* '%abc' */
+	LIKE_INFIX					/* '%abc%' */
+} like_kind;
+
+typedef struct {
+	like_kind kind;
+	const char *pat;			/* the original pattern */
+	char *lit;					/* literal part of a simple pattern */
+	size_t len;					/* its length */
+	bit caseignore;
+	char esc;
+} like_pattern;
+
+static str
+like_init(like_pattern *lp, const char *pat, bit caseignore, char esc)
+{
+	const char *b = pat, *e;
+	int lead, trail;
+
+	lp->kind = LIKE_GENERAL;
+	lp->pat = pat;
+	lp->lit = NULL;
+	lp->len = 0;
+	lp->caseignore = caseignore;
+	lp->esc = esc;
+	if (strcmp(pat, str_nil) == 0) {
+		lp->kind = LIKE_NIL;
+		return MAL_SUCCEED;
+	}
+	/* STRlike folds case through the UTF-8 tables; keep that there,
+	 * and leave escapes of the wildcards themselves to it as well */
+	if (caseignore || esc == '%' || esc == '_')
+		return MAL_SUCCEED;
+	while (*b == '%')
+		b++;
+	lead = b > pat;
+	e = b + strlen(b);
+	while (e > b && e[-1] == '%')
+		e--;
+	trail = *e != '\0';
+	if (e == b && (lead || trail)) {
+		lp->kind = LIKE_ANY;
+		return MAL_SUCCEED;
+	}
+	for (pat = b; pat < e; pat++)
+		if (*pat == '%' || *pat == '_' || (esc && *pat == esc))
+			return MAL_SUCCEED;
+	lp->len = (size_t) (e - b);
+	if ((lp->lit = GDKmalloc(lp->len + 1)) == NULL)
+		throw(MAL, "pcre.like", MAL_MALLOC_FAIL);
+	memcpy(lp->lit, b, lp->len);
+	lp->lit[lp->len] = '\0';
+	lp->kind = lead ? (trail ? LIKE_INFIX : LIKE_SUFFIX) : (trail ? LIKE_PREFIX : LIKE_EXACT);
+	return MAL_SUCCEED;
+}
+
+static void
+like_destroy(like_pattern *lp)
+{
+	GDKfree(lp->lit);
+	lp->lit = NULL;
+}
+
+static inline bit
+like_match(const like_pattern *lp, const char *v)
+{
+	size_t l;
+
+	switch (lp->kind) {
+	case LIKE_NIL:
+		return 0;
+	case LIKE_ANY:
+		return 1;
+	case LIKE_EXACT:
+		return strcmp(v, lp->lit) == 0;
+	case LIKE_PREFIX:
+		return strncmp(v, lp->lit, lp->len) == 0;
+	case LIKE_SUFFIX:
+		l = strlen(v);
+		return l >= lp->len && memcmp(v + l - lp->len, lp->lit, lp->len) == 0;
+	case LIKE_INFIX:
+		return strstr(v, lp->lit) != NULL;
+	default:
+		return STRlike(lp->pat, v, lp->caseignore, lp->esc);
+	}
+}
+
+/* A string heap below GDK_ELIMLIMIT holds every distinct value once,
+ * so the outcome of a match can be remembered per heap offset: 0 is
+ * not yet known, 1 no match, 2 match. */
+static bte *
+like_memo_init(BAT *b, const like_pattern *lp)
+{
+	if (lp->kind == LIKE_ANY || lp->kind == LIKE_NIL ||
+		!GDK_ELIMDOUBLES(b->tvheap))
+		return NULL;
+	return GDKzalloc((b->tvheap->free - GDK_VAROFFSET) / GDK_VARALIGN + 1);
+}
+
+static inline bit
+like_memo(const like_pattern *lp, bte *memo, var_t off, const char *v)
+{
+	bte *m = &memo[(off - GDK_VAROFFSET) / GDK_VARALIGN];
+
+	if (*m == 0)
+		*m = like_match(lp, v) ? 2 : 1;
+	return *m == 2;
+}
+
+#define LIKEtest(pos)											\
+	(v && *v != '\200' &&										\
+	 (memo ? like_memo(lp, memo, BUNtvaroff(bi, pos), v) : like_match(lp, v)) != anti)
+
+/* Exact matches and, on ordered or order indexed columns, prefix
+ * matches are range selections, which BATselect answers with a hash,
+ * binary search or the order index: 'abc%' is 'abc' <= v < 'abd'. */
+static BAT *
+like_rangeselect(BAT *b, BAT *s, const like_pattern *lp, int anti, int *done)
+{
+	char *hi;
+	size_t i;
+	BAT *bn;
+
+	*done = 0;
+	if (lp->kind == LIKE_EXACT) {
+		*done = 1;
+		return BATselect(b, s, lp->lit, NULL, 1, 1, anti);
+	}
+	if (lp->kind != LIKE_PREFIX ||
+		!(BATordered(b) || BATordered_rev(b) || b->torderidx))
+		return NULL;
+	for (i = lp->len; i > 0; i--)
+		if ((unsigned char) lp->lit[i - 1] != 0xFF)
+			break;
+	if (i == 0)
+		return NULL;
+	if ((hi = GDKstrndup(lp->lit, i)) == NULL) {
+		*done = 1;
+		return NULL;
+	}
+	hi[i - 1]++;
+	*done = 1;
+	bn = BATselect(b, s, lp->lit, hi, 1, 0, anti);
+	GDKfree(hi);
+	return bn;
+}
+
 static str
-pcre_likeselect(BAT **bnp, BAT *b, BAT *s, const char *pat, int caseignore, int anti)
+pcre_likeselect(BAT **bnp, BAT *b, BAT *s, const like_pattern *lp, int anti)
 {
 	BATiter bi = bat_iterator(b);
 	BAT *bn;
 	BUN p, q;
 	oid o, off;
 	const char *v;
+	bte *memo;
+	int done;
 
 	assert(ATOMstorage(b->ttype) == TYPE_str);
 	assert(anti == 0 || anti == 1);
 
+	if (lp->kind == LIKE_NIL) {
+		/* neither LIKE nor NOT LIKE nil holds for any value */
+		if ((*bnp = BATdense(0, 0, 0)) == NULL)
+			throw(MAL, "pcre.likeselect", MAL_MALLOC_FAIL);
+		return MAL_SUCCEED;
+	}
+	bn = like_rangeselect(b, s, lp, anti, &done);
+	if (done) {
+		if (bn == NULL)
+			throw(MAL, "pcre.likeselect", GDK_EXCEPTION);
+		*bnp = bn;
+		return MAL_SUCCEED;
+	}
+
 	bn = COLnew(0, TYPE_oid, s ? BATcount(s) : BATcount(b), TRANSIENT);
 	if (bn == NULL) {
 		throw(MAL, "pcre.likeselect", MAL_MALLOC_FAIL);
 	}
+	memo = like_memo_init(b, lp);
 	off = b->hseqbase;
 
 	if (s && !BATtdense(s)) {
@@ -167,11 +341,7 @@ pcre_likeselect(BAT **bnp, BAT *b, BAT *s, const char *pat, int caseignore, int
 		p = SORTfndfirst(s, &b->hseqbase);
 		candlist = (const oid *) Tloc(s, p);
 
-
-		if (anti)
-			candscanloop(v && *v != '\200' && !STRlike(pat, v, caseignore, '\0'));
-		else
-			candscanloop(v && *v != '\200' && STRlike(pat, v, caseignore, '\0'));
+		candscanloop(LIKEtest(r));
 	} else {
 		if (s) {
 			assert(BATtdense(s));
@@ -185,11 +355,9 @@ pcre_likeselect(BAT **bnp, BAT *b, BAT *s, const char *pat, int caseignore, int
 			p = off;
 			q = BUNlast(b) + off;
 		}
-		if (anti)
-			scanloop(v && *v != '\200' && !STRlike(pat, v, caseignore, '\0'));
-		else
-			scanloop(v && *v != '\200' && STRlike(pat, v, caseignore, '\0'));
+		scanloop(LIKEtest(p - off));
 	}
+	GDKfree(memo);
 	BATsetcount(bn, BATcount(bn)); /* set some properties */
 	bn->tsorted = 1;
 	bn->trevsorted = bn->batCount <= 1;
@@ -201,6 +369,7 @@ pcre_likeselect(BAT **bnp, BAT *b, BAT *s, const char *pat, int caseignore, int
 	return MAL_SUCCEED;
 
   bunins_failed:
+	GDKfree(memo);
 	BBPreclaim(bn);
 	*bnp = NULL;
 	throw(MAL, "pcre.likeselect", OPERATION_FAILED);
@@ -322,7 +491,10 @@ PCREsql2pcre(str *ret, const str *pat, const str *esc)
 static str
 PCRElike4(bit *ret, const str *s, const str *pat, const str *esc, const bit *isens)
 {
-	*ret = STRlike(*pat, *s, *isens, **esc);
+	if (strcmp(*s, str_nil) == 0 || strcmp(*pat, str_nil) == 0)
+		*ret = bit_nil;
+	else
+		*ret = STRlike(*pat, *s, *isens, **esc);
 	return MAL_SUCCEED;
 }
 
@@ -349,7 +521,7 @@ PCREnotlike3(bit *ret, const str *s, const str *pat, const str *esc)
 	bit r;
 
 	rethrow("str.not_like", tmp, PCRElike3(&r, s, pat, esc));
-	*ret = !r;
+	*ret = r == bit_nil ? bit_nil : !r;
 	return(MAL_SUCCEED);
 }
 
@@ -360,7 +532,7 @@ PCREnotlike2(bit *ret, const str *s, const str *pat)
 	bit r;
 
 	rethrow("str.not_like", tmp, PCRElike2(&r, s, pat));
-	*ret = !r;
+	*ret = r == bit_nil ? bit_nil : !r;
 	return(MAL_SUCCEED);
 }
 
@@ -387,7 +559,7 @@ PCREnotilike3(bit *ret, const str *s, const str *pat, const str *esc)
 	bit r;
 
 	rethrow("str.not_ilike", tmp, PCREilike3(&r, s, pat, esc));
-	*ret = !r;
+	*ret = r == bit_nil ? bit_nil : !r;
 	return(MAL_SUCCEED);
 }
 
@@ -398,64 +570,55 @@ PCREnotilike2(bit *ret, const str *s, const str *pat)
 	bit r;
 
 	rethrow("str.not_ilike", tmp, PCREilike2(&r, s, pat));
-	*ret = !r;
+	*ret = r == bit_nil ? bit_nil : !r;
 	return(MAL_SUCCEED);
 }
 
 static str
 BATPCRElike3(bat *ret, const bat *bid, const str *pat, const str *esc, const bit *isens, const bit *not)
 {
-	char *ppat = NULL;
-	str res = MAL_SUCCEED;
-
+	str res;
 	BAT *strs = BATdescriptor(*bid);
 	BATiter strsi;
 	BAT *r;
 	bit *br;
 	BUN p, q, i = 0;
+	like_pattern lp;
+	bte *memo;
 
 	if (strs == NULL) {
-		GDKfree(ppat);
 		throw(MAL, "batstr.like", OPERATION_FAILED);
 	}
 
 	r = COLnew(strs->hseqbase, TYPE_bit, BATcount(strs), TRANSIENT);
 	if( r==NULL) {
-		GDKfree(ppat);
+		BBPunfix(strs->batCacheid);
 		throw(MAL,"pcre.like3",MAL_MALLOC_FAIL);
 	}
+	if ((res = like_init(&lp, *pat, *isens, **esc)) != MAL_SUCCEED) {
+		BBPunfix(strs->batCacheid);
+		BBPreclaim(r);
+		return res;
+	}
 	br = (bit*)Tloc(r, 0);
 	strsi = bat_iterator(strs);
+	memo = like_memo_init(strs, &lp);
 
-	if (strcmp(ppat, str_nil) == 0) {
-		BATloop(strs, p, q) {
-			const char *s = (str)BUNtail(strsi, p);
-
-			if (strcmp(s, *pat) == 0)
-				br[i] = TRUE;
-			else
-				br[i] = FALSE;
-			if (*not)
-				br[i] = !br[i];
-			i++;
-		}
-	} else {
-
-		BATloop(strs, p, q) {
-			const char *s = (str)BUNtail(strsi, p);
+	BATloop(strs, p, q) {
+		const char *s = (str)BUNtail(strsi, p);
 
-			if (*s == *str_nil) {
-				br[i] = bit_nil;
-				r->tnonil = 0;
-				r->tnil = 1;
-			} else {
-				bit retval = STRlike(*pat, s, *isens, **esc);
-				br[i] = *not ? !retval:retval;
-			}
-			i++;
+		if (*s == *str_nil || lp.kind == LIKE_NIL) {
+			br[i] = bit_nil;
+			r->tnonil = 0;
+			r->tnil = 1;
+		} else {
+			bit retval = memo ? like_memo(&lp, memo, BUNtvaroff(strsi, p), s) : like_match(&lp, s);
+			br[i] = *not ? !retval:retval;
 		}
-
+		i++;
 	}
+	GDKfree(memo);
+	like_destroy(&lp);
 	BATsetcount(r, i);
 	r->tsorted = 0;
 	r->trevsorted = 0;
@@ -463,9 +626,8 @@ BATPCRElike3(bat *ret, const bat *bid, const str *pat, const str *esc, const bit
 
 	BBPkeepref(*ret = r->batCacheid);
 	BBPunfix(strs->batCacheid);
-	GDKfree(ppat);
 
-	return res;
+	return MAL_SUCCEED;
 }
 
 str
@@ -538,6 +700,7 @@ str
 PCRElikeselect2(bat *ret, const bat *bid, const bat *sid, const str *pat, const str *esc, const bit *caseignore, const bit *anti)
 {
 	BAT *b, *s = NULL, *bn = NULL;
+	like_pattern lp;
 	str res;
 
 	if ((b = BATdescriptor(*bid)) == NULL) {
@@ -547,8 +710,10 @@ PCRElikeselect2(bat *ret, const bat *bid, const bat *sid, const str *pat, const
 		BBPunfix(b->batCacheid);
 		throw(MAL, "algebra.likeselect", RUNTIME_OBJECT_MISSING);
 	}
-	(void) esc;
-	res = pcre_likeselect(&bn, b, s, *pat, *caseignore, *anti);
+	if ((res = like_init(&lp, *pat, *caseignore, **esc)) == MAL_SUCCEED) {
+		res = pcre_likeselect(&bn, b, s, &lp, *anti);
+		like_destroy(&lp);
+	}
 
 	BBPunfix(b->batCacheid);
 	if (s)
@@ -614,6 +779,7 @@ pcrejoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr,
 	BUN newcap;
 	oid lo, ro;
 	int rskipped = 0;	/* whether we skipped values in r */
+	like_pattern lp;
 	char *msg = MAL_SUCCEED;
 
 	ALGODEBUG fprintf(stderr, "#pcrejoin(l=%s#" BUNFMT "[%s]%s%s,"
@@ -671,6 +837,8 @@ pcrejoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr,
 		}
 		if (strcmp(vr, str_nil) == 0)
 			continue;
+		if ((msg = like_init(&lp, vr, caseignore, *esc)) != MAL_SUCCEED)
+			goto bailout;
 		nl = 0;
 		p = lcand;
 		n = lstart;
@@ -691,7 +859,7 @@ pcrejoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr,
 				continue;
 
 
-			retval = STRlike(vr, vl, caseignore, *esc);
+			retval = like_match(&lp, vl);
 			if (retval == 0) {
 				continue;
 			}
@@ -701,6 +869,7 @@ pcrejoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr,
 				BATsetcount(r2, BATcount(r2));
 				if (BATextend(r1, newcap) != GDK_SUCCEED ||
 					BATextend(r2, newcap) != GDK_SUCCEED) {
+					like_destroy(&lp);
 					msg = createException(MAL, "pcre.join", MAL_MALLOC_FAIL);
 					goto bailout;
 				}
@@ -726,6 +895,7 @@ pcrejoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr,
 			lastl = lo;
 			nl++;
 		}
+		like_destroy(&lp);
 		if (nl > 1) {
 			r2->tkey = 0;
 			r2->tdense = 0;
@@ -2466,7 +2466,6 @@ bit STRlike(const char* const_pattern, const char* const_data, bit case_insensit
 	str data = (char*) const_data;
 	bit retval = 0;
 
-	(void) escape; // FIXME
 	if (case_insensitive) {
 		STRLower(&pattern, (const str*) &const_pattern);
 		pattern_start = pattern;
@@ -2477,8 +2476,15 @@ bit STRlike(const char* const_pattern, const char* const_data, bit case_insensit
 		unsigned char *d = (unsigned char *) pattern++;
 		char sz_c = 0, sz_d = 0;
 		unsigned int cp_c = 0, cp_d = 0;
+		int literal = 0;
 
-		switch (*d) {
+		/* the escape character makes the next one a literal */
+		if (escape && *d == (unsigned char) escape && *pattern) {
+			d = (unsigned char *) pattern++;
+			literal = 1;
+		}
+
+		switch (literal ? 0 : *d) {
 		case '_':
 			if (*c == '\0') {
 				goto bailout;
@@ -2494,9 +2500,6 @@ bit STRlike(const char* const_pattern, const char* const_data, bit case_insensit
 			back_pat = pattern;
 			back_str = --data; /* Allow zero-length match */
 			break;
-/*        case '\\':
-			d = *pat++;
-			//FALLTHROUGH*/
 		default:        /* Literal character */
 			if (case_insensitive && *c != '\0') {
 				// get code points from strings
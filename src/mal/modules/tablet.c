@@ -40,6 +40,7 @@
 #include <string.h>
 #include <ctype.h>
 #include "algebra.h"
+#include "mtime.h"
 
 /*#define _DEBUG_TABLET_ */
 /*#define _DEBUG_TABLET_CNTRL */
@@ -803,6 +804,246 @@ SQLload_error(READERtask *task, lng idx, BUN attrs)
 	return line;
 }
 
+/*
+ * Most of the fields of a bulk load are numbers or dates written in
+ * their plain notation. For those, the value is parsed straight into
+ * the tail of the column by a parser specialised for the type. They
+ * only accept what the generic frstr function would turn into the same
+ * value; for anything else (white space, exponents, nil, possible
+ * overflow, invalid dates) they give up and frstr takes over.
+ */
+static const lng SQLpow10[19] = {
+	LL_CONSTANT(1), LL_CONSTANT(10), LL_CONSTANT(100),
+	LL_CONSTANT(1000), LL_CONSTANT(10000), LL_CONSTANT(100000),
+	LL_CONSTANT(1000000), LL_CONSTANT(10000000),
+	LL_CONSTANT(100000000), LL_CONSTANT(1000000000),
+	LL_CONSTANT(10000000000), LL_CONSTANT(100000000000),
+	LL_CONSTANT(1000000000000), LL_CONSTANT(10000000000000),
+	LL_CONSTANT(100000000000000), LL_CONSTANT(1000000000000000),
+	LL_CONSTANT(10000000000000000), LL_CONSTANT(100000000000000000),
+	LL_CONSTANT(1000000000000000000),
+};
+
+/* all powers of ten up to 10^22 are exact doubles */
+static const dbl SQLpow10dbl[23] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+/* Convert the digits in [s,e), at most 18 of them. Runs of eight
+ * digits are converted at once: with the characters loaded in a
+ * little-endian word, three multiplications combine neighbouring
+ * digits, pairs and quads. */
+static inline lng
+SQLparse_digits(const char *s, const char *e)
+{
+	lng v = 0;
+
+#ifndef WORDS_BIGENDIAN
+	while (e - s >= 8) {
+		uint64_t x;
+
+		memcpy(&x, s, sizeof(x));
+		x = ((x & (uint64_t) LL_CONSTANT(0x0F0F0F0F0F0F0F0F)) * 2561) >> 8;
+		x = ((x & (uint64_t) LL_CONSTANT(0x00FF00FF00FF00FF)) * 6553601) >> 16;
+		x = ((x & (uint64_t) LL_CONSTANT(0x0000FFFF0000FFFF)) * (uint64_t) LL_CONSTANT(42949672960001)) >> 32;
+		v = v * 100000000 + (lng) x;
+		s += 8;
+	}
+#endif
+	while (s < e)
+		v = v * 10 + (*s++ - '0');
+	return v;
+}
+
+/* Skip the digits at s; return NULL if there are more than max. */
+static inline const char *
+SQLskip_digits(const char *s, int max)
+{
+	const char *e = s + max;
+
+	while (s < e && *s >= '0' && *s <= '9')
+		s++;
+	if (*s >= '0' && *s <= '9')
+		return NULL;
+	return s;
+}
+
+/* [+-]?[0-9]{1,max} */
+static inline int
+SQLparse_int(const char *s, int max, lng *v)
+{
+	const char *e;
+	int neg = *s == '-';
+
+	s += neg || *s == '+';
+	if ((e = SQLskip_digits(s, max)) == NULL || e == s || *e)
+		return 0;
+	*v = SQLparse_digits(s, e);
+	if (neg)
+		*v = -*v;
+	return 1;
+}
+
+/* [+-]?[0-9]+(\.[0-9]*)? with at most precision - scale digits before
+ * and scale digits after the point */
+static inline int
+SQLparse_dec(const char *s, int scale, int precision, lng *v)
+{
+	const char *e, *f;
+	int neg = *s == '-';
+	lng r;
+
+	s += neg || *s == '+';
+	if ((e = SQLskip_digits(s, precision - scale)) == NULL || e == s)
+		return 0;
+	r = SQLparse_digits(s, e) * SQLpow10[scale];
+	if (*e == '.') {
+		if ((f = SQLskip_digits(e + 1, scale)) == NULL)
+			return 0;
+		r += SQLparse_digits(e + 1, f) * SQLpow10[scale - (f - e - 1)];
+		e = f;
+	}
+	if (*e)
+		return 0;
+	*v = neg ? -r : r;
+	return 1;
+}
+
+/* [+-]?[0-9]+(\.[0-9]*)? with at most 15 digits in all, so that the
+ * digits form an exact double which, divided by an exact power of
+ * ten, is correctly rounded just like the result of strtod */
+static inline int
+SQLparse_dbl(const char *s, dbl *v)
+{
+	const char *e, *f;
+	int neg = *s == '-';
+	lng m;
+	dbl d;
+
+	s += neg || *s == '+';
+	if ((e = SQLskip_digits(s, 15)) == NULL || e == s)
+		return 0;
+	m = SQLparse_digits(s, e);
+	f = e;
+	if (*e == '.') {
+		if ((f = SQLskip_digits(e + 1, 15 - (int) (e - s))) == NULL)
+			return 0;
+		m = m * SQLpow10[f - e - 1] + SQLparse_digits(e + 1, f);
+	}
+	if (*f)
+		return 0;
+	d = (dbl) m;
+	if (f > e)
+		d /= SQLpow10dbl[f - e - 1];
+	*v = neg ? -d : d;
+	return 1;
+}
+
+#define twodigits(s)	((s)[0] >= '0' && (s)[0] <= '9' && (s)[1] >= '0' && (s)[1] <= '9')
+#define twovalue(s)		(((s)[0] - '0') * 10 + (s)[1] - '0')
+
+/* YYYY-MM-DD, possibly followed by more */
+static inline int
+SQLparse_date(const char *s, date *v)
+{
+	int year, month, day;
+
+	if (!twodigits(s) || !twodigits(s + 2) || s[4] != '-' ||
+		!twodigits(s + 5) || s[7] != '-' || !twodigits(s + 8))
+		return 0;
+	year = twovalue(s) * 100 + twovalue(s + 2);
+	month = twovalue(s + 5);
+	day = twovalue(s + 8);
+	if (MTIMEdate_create(v, &year, &month, &day) != MAL_SUCCEED ||
+		*v == date_nil)
+		return 0;
+	return 1;
+}
+
+/* YYYY-MM-DD[ T]HH:MM:SS(\.[0-9]{1,3})? in the local time zone */
+static inline int
+SQLparse_timestamp(const char *s, timestamp *v)
+{
+	int hour, min, sec, msec = 0, i;
+	date d;
+	daytime t;
+
+	if (!SQLparse_date(s, &d) || (s[10] != ' ' && s[10] != 'T'))
+		return 0;
+	s += 11;
+	if (!twodigits(s) || s[2] != ':' || !twodigits(s + 3) ||
+		s[5] != ':' || !twodigits(s + 6))
+		return 0;
+	hour = twovalue(s);
+	min = twovalue(s + 3);
+	sec = twovalue(s + 6);
+	s += 8;
+	if (*s == '.') {
+		/* more than three digits would need rounding */
+		for (i = 0, s++; i < 3; i++) {
+			msec *= 10;
+			if (*s >= '0' && *s <= '9')
+				msec += *s++ - '0';
+			else if (i == 0)
+				return 0;
+		}
+	}
+	if (*s ||
+		MTIMEdaytime_create(&t, &hour, &min, &sec, &msec) != MAL_SUCCEED ||
+		t == daytime_nil ||
+		MTIMEtimestamp_create_default(v, &d, &t) != MAL_SUCCEED ||
+		ts_isnil(*v))
+		return 0;
+	return 1;
+}
+
+static inline int
+SQLparse_field(Column *fmt, const char *s, void *dst)
+{
+	lng v;
+
+	if (fmt->parse == TABLET_DECIMAL) {
+		if (fmt->precision > 18 ||
+			!SQLparse_dec(s, fmt->scale, fmt->precision, &v))
+			return 0;
+		switch (fmt->adt) {
+		case TYPE_bte: *(bte *) dst = (bte) v; return 1;
+		case TYPE_sht: *(sht *) dst = (sht) v; return 1;
+		case TYPE_int: *(int *) dst = (int) v; return 1;
+		case TYPE_lng: *(lng *) dst = v; return 1;
+		}
+		return 0;
+	}
+	switch (fmt->adt) {
+	case TYPE_bte:
+		if (!SQLparse_int(s, 2, &v))
+			return 0;
+		*(bte *) dst = (bte) v;
+		return 1;
+	case TYPE_sht:
+		if (!SQLparse_int(s, 4, &v))
+			return 0;
+		*(sht *) dst = (sht) v;
+		return 1;
+	case TYPE_int:
+		if (!SQLparse_int(s, 9, &v))
+			return 0;
+		*(int *) dst = (int) v;
+		return 1;
+	case TYPE_lng:
+		return SQLparse_int(s, 18, (lng *) dst);
+	case TYPE_dbl:
+		return SQLparse_dbl(s, (dbl *) dst);
+	default:
+		if (fmt->adt == TYPE_date)
+			return SQLparse_date(s, (date *) dst) && s[10] == 0;
+		if (fmt->adt == TYPE_timestamp)
+			return SQLparse_timestamp(s, (timestamp *) dst);
+	}
+	return 0;
+}
+
 /*
  * The parsing of the individual values is straightforward. If the value represents
  * the null-replacement string then we grab the underlying nil.
@@ -827,6 +1068,11 @@ SQLinsert_val(READERtask *task, int col, int idx)
 	if (s == 0) {
 		adt = fmt->nildata;
 		fmt->c->tnonil = 0;
+	} else if (fmt->parse != TABLET_GENERIC &&
+			   BUNlast(fmt->c) < BATcapacity(fmt->c) &&
+			   SQLparse_field(fmt, s, Tloc(fmt->c, BUNlast(fmt->c)))) {
+		fmt->c->batCount++;
+		return 0;
 	} else
 		adt = fmt->frstr(fmt, fmt->adt, s);
 
@@ -1202,6 +1448,175 @@ SQLworkdivider(READERtask *task, READERtask *ptask, int nr_attrs, int threads)
 		task->time[i] = 0;
 }
 
+/*
+ * The record boundaries of a large input buffer are found in parallel.
+ * The buffer is cut into chunks of at least SPLITCHUNK bytes that are
+ * scanned by separate threads.  Whether a chunk starts inside a quoted
+ * field depends on all chunks before it, so with a quote character each
+ * chunk is scanned speculatively twice: once starting outside and once
+ * starting inside a quoted field.  The producer then strings the chunks
+ * together, for each chunk picking the scan that matches the state in
+ * which the previous chunk ended.  A chunk whose first record does not
+ * start on its first byte (because an escape or a multi-byte record
+ * separator straddles the boundary) is scanned again by the producer.
+ * The scanners jump to the next separator, quote or escape with
+ * memchr, which most C libraries implement with SIMD instructions.
+ */
+#define SPLITCHUNK	(256 * 1024)
+
+typedef struct {
+	READERtask *task;
+	char *lo, *hi;				/* the chunk */
+	char **seps[2];				/* separators found starting outside/inside quotes */
+	int nseps[2], maxseps[2];
+	char q[2];					/* quote state at the end of the scan */
+	char *next[2];				/* where the scan of the next chunk should start */
+	int error;					/* null byte or allocation failure */
+} SPLITtask;
+
+/* Find the record separators in the chunk starting at e with quote
+ * state q, following the rules of the sequential scan in SQLproducer.
+ * Returns where the scan continues, which may be beyond the chunk. */
+static char *
+SQLsplit_scan(SPLITtask *t, int k, char *e, char q)
+{
+	READERtask *task = t->task;
+	const char *rsep = task->rsep;
+	size_t rseplen = task->rseplen;
+	char quote = task->quote;
+	char *hi = t->hi, *p, *r;
+
+	while (e < hi) {
+		/* skip to the first byte that needs attention */
+		if (q) {
+			if ((p = memchr(e, q, hi - e)) == NULL)
+				p = hi;
+		} else {
+			if ((p = memchr(e, *rsep, hi - e)) == NULL)
+				p = hi;
+			if (quote && (r = memchr(e, quote, p - e)) != NULL)
+				p = r;
+		}
+		if ((r = memchr(e, '\\', p - e)) != NULL)
+			p = r;
+		if ((e = p) == hi)
+			break;
+		if (q && *e == q) {
+			q = 0;
+			e++;
+		} else if (!q && quote && *e == quote) {
+			q = quote;
+			e++;
+		} else if (*e == '\\') {
+			e += 2;
+		} else if (!q && strncmp(e, rsep, rseplen) == 0) {
+			if (t->nseps[k] == t->maxseps[k]) {
+				char **seps = GDKrealloc(t->seps[k], 2 * (t->maxseps[k] + 1024) * sizeof(char *));
+				if (seps == NULL) {
+					t->error = 1;
+					break;
+				}
+				t->seps[k] = seps;
+				t->maxseps[k] = 2 * (t->maxseps[k] + 1024);
+			}
+			t->seps[k][t->nseps[k]++] = e;
+			e += rseplen;
+		} else {
+			e++;
+		}
+	}
+	t->q[k] = q;
+	t->next[k] = e;
+	return e;
+}
+
+static void
+SQLsplitter(void *arg)
+{
+	SPLITtask *t = (SPLITtask *) arg;
+
+	/* the sequential scan deals with embedded null bytes */
+	if (memchr(t->lo, 0, t->hi - t->lo) != NULL) {
+		t->error = 1;
+		return;
+	}
+	SQLsplit_scan(t, 0, t->lo, 0);
+	if (t->task->quote)
+		SQLsplit_scan(t, 1, t->lo, t->task->quote);
+}
+
+/* Find the record separators in the buffer from s up to end in
+ * parallel.  Returns the number of separators, which are stored in
+ * *sepsp, or -1 if the buffer is to be scanned sequentially. */
+static int
+SQLsplit_buffer(READERtask *task, char *s, char *end, char ***sepsp)
+{
+	SPLITtask ts[MAXWORKERS];
+	int nchunks, i, k, n = 0, nalloc = 0, error = 0;
+	size_t len = (size_t) (end - s);
+	char **seps = NULL, *pos = s, q = 0;
+	lng t0 = GDKusec();
+
+	*sepsp = NULL;
+	nchunks = GDKnr_threads < MAXWORKERS ? GDKnr_threads : MAXWORKERS;
+	if ((size_t) nchunks > len / SPLITCHUNK)
+		nchunks = (int) (len / SPLITCHUNK);
+	if (nchunks < 2)
+		return -1;
+	memset(ts, 0, sizeof(ts));
+	for (i = 0; i < nchunks; i++) {
+		ts[i].task = task;
+		ts[i].lo = s + i * (len / nchunks);
+		ts[i].hi = i == nchunks - 1 ? end : s + (i + 1) * (len / nchunks);
+	}
+	GDKparallel(nchunks, SQLsplitter, ts, sizeof(SPLITtask));
+	for (i = 0; i < nchunks; i++)
+		error |= ts[i].error;
+	/* string the chunks together */
+	for (i = 0; !error && i < nchunks; i++) {
+		k = q != 0;
+		if (pos != ts[i].lo) {
+			/* the speculative scans started at the wrong place */
+			ts[i].nseps[k] = 0;
+			SQLsplit_scan(&ts[i], k, pos, q);
+			if (ts[i].error) {
+				error = 1;
+				break;
+			}
+		}
+		if (n + ts[i].nseps[k] > nalloc) {
+			char **p;
+
+			nalloc = 2 * (n + ts[i].nseps[k]);
+			if ((p = GDKrealloc(seps, nalloc * sizeof(char *))) == NULL) {
+				error = 1;
+				break;
+			}
+			seps = p;
+		}
+		memcpy(seps + n, ts[i].seps[k], ts[i].nseps[k] * sizeof(char *));
+		n += ts[i].nseps[k];
+		q = ts[i].q[k];
+		pos = ts[i].next[k];
+	}
+	for (i = 0; i < nchunks; i++) {
+		GDKfree(ts[i].seps[0]);
+		GDKfree(ts[i].seps[1]);
+	}
+	if (error) {
+		GDKfree(seps);
+		return -1;
+	}
+#ifdef _DEBUG_TABLET_CNTRL
+	mnstr_printf(GDKout, "#split " SZFMT " bytes into %d records with %d threads in " LLFMT " usec\n",
+				 len, n, nchunks, GDKusec() - t0);
+#else
+	(void) t0;
+#endif
+	*sepsp = seps;
+	return n;
+}
+
 /*
  * Reading is handled by a separate task as a preparation for more parallelism.
  * A buffer is filled with proper lines.
@@ -1224,6 +1639,8 @@ SQLproducer(void *p)
 	const char *rsep = task->rsep;
 	size_t rseplen = strlen(rsep), partial = 0;
 	char quote = task->quote;
+	char **seps = NULL;	/* record separators found in parallel */
+	int nseps = -1, sepcur = 0;
 	Thread thr;
 
 	thr = THRnew("SQLproducer");
@@ -1307,7 +1724,11 @@ SQLproducer(void *p)
 		 * status is when we back off a few bytes from where the last
 		 * scan ended (we need to back off some since we could be in
 		 * the middle of the record separator).  If this is too
-		 * costly, we have to rethink the matter. */
+		 * costly, we have to rethink the matter.
+		 * In a large buffer the record separators are found in
+		 * parallel up front (see SQLsplit_buffer). */
+		nseps = SQLsplit_buffer(task, s, end, &seps);
+		sepcur = 0;
 		for (e = s; *e && e < end && cnt < task->maxrow;) {
 			/* tokenize the record completely the format of the input
 			 * should comply to the following grammar rule [
@@ -1317,7 +1738,14 @@ SQLproducer(void *p)
 			 * user should supply the correct number of fields.
 			 * In the first phase we simply break the lines at the
 			 * record boundary. */
-			if (quote == 0) {
+			if (nseps >= 0) {
+				if (sepcur < nseps) {
+					e = seps[sepcur++];
+				} else {
+					partial = end - s;
+					e = 0;	/* nonterminated record, we need more */
+				}
+			} else if (quote == 0) {
 				switch (rseplen) {
 				case 1:
 					for (; *e; e++) {
@@ -1439,6 +1867,9 @@ SQLproducer(void *p)
 		}
 
 	  reportlackofinput:
+		GDKfree(seps);
+		seps = NULL;
+		nseps = -1;
 #ifdef _DEBUG_TABLET_CNTRL
 		mnstr_printf(GDKout, "#SQL producer got buffer %d filled with %d records \n",
 					 cur, task->top[cur]);
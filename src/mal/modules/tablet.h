@@ -53,8 +53,17 @@ typedef struct Column_t {
 	char quote;					/* if set use this character for string quotes */
 	const void *nildata;
 	int size;
+	int parse;					/* kind of value, see below */
 } Column;
 
+/*
+ * The kind of value tells SQLload_file which specialised parser it
+ * may try on the plain notation of a field before resorting to frstr.
+ */
+#define TABLET_GENERIC	0		/* always use frstr */
+#define TABLET_ATOM		1		/* frstr uses the fromstr of the atom */
+#define TABLET_DECIMAL	2		/* fixed point, with scale and precision */
+
 /*
  * All table printing is based on building a report structure first.
  * This table structure is private to a client, which made us to
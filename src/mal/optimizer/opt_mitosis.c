@@ -11,6 +11,62 @@
 #include "mal_interpreter.h"
 #include <gdk_utils.h>
 
+/*
+ * The row size of the target is the sum of the widths of all columns
+ * of its table that the plan binds, var heaps included.  The SQL
+ * compiler records the width of the stored column with the bind;
+ * when it is missing the width of the type is used.
+ */
+static int
+rowSize(MalBlkPtr mb, InstrPtr target)
+{
+	InstrPtr p, q;
+	int i, j, w, size = 0;
+	str schema = getVarConstant(mb, getArg(target, 2)).val.sval;
+	str table = getVarConstant(mb, getArg(target, 3)).val.sval;
+
+	for (i = 1; i < mb->stop; i++) {
+		p = getInstrPtr(mb, i);
+		if (getModuleId(p) != sqlRef ||
+			(getFunctionId(p) != bindRef && getFunctionId(p) != bindidxRef) ||
+			p->retc != 1 || p->argc != 6 ||
+			strcmp(schema, getVarConstant(mb, getArg(p, 2)).val.sval) ||
+			strcmp(table, getVarConstant(mb, getArg(p, 3)).val.sval))
+			continue;
+		/* count every column once */
+		for (j = 1; j < i; j++) {
+			q = getInstrPtr(mb, j);
+			if (getModuleId(q) == sqlRef &&
+				getFunctionId(q) == getFunctionId(p) &&
+				q->retc == 1 && q->argc == 6 &&
+				strcmp(schema, getVarConstant(mb, getArg(q, 2)).val.sval) == 0 &&
+				strcmp(table, getVarConstant(mb, getArg(q, 3)).val.sval) == 0 &&
+				strcmp(getVarConstant(mb, getArg(p, 4)).val.sval, getVarConstant(mb, getArg(q, 4)).val.sval) == 0)
+				break;
+		}
+		if (j < i)
+			continue;
+		w = getRowSize(mb, getArg(p, 0));
+		if (w <= 0)
+			w = ATOMsize(getBatType(getArgType(mb, p, 0)));
+		size += w;
+	}
+	return size > 0 ? size : (int) sizeof(oid);
+}
+
+/*
+ * Pieces that do not fill the cache of the core processing them cost
+ * more in plan overhead than they gain in parallelism.  This only
+ * raises the minimum for narrow rows.
+ */
+static BUN
+minPartCnt(int row_size)
+{
+	BUN minpart = (BUN) (MT_cachesize() / row_size);
+
+	return minpart > MINPARTCNT ? minpart : MINPARTCNT;
+}
+
 static int
 eligible(MalBlkPtr mb)
 {
@@ -34,10 +90,9 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 {
 	int i, j, limit, slimit, estimate = 0, pieces = 1, mito_parts = 0, mito_size = 0, row_size = 0, mt = -1;
 	str schema = 0, table = 0;
-	BUN r = 0, rowcnt = 0;    /* table should be sizeable to consider parallel execution*/
+	BUN r = 0, rowcnt = 0, minpart;    /* table should be sizeable to consider parallel execution*/
 	InstrPtr q, *old, target = 0;
-	size_t argsize = 6 * sizeof(lng), m = 0;
-	/*     per op:   6 = (2+1)*2   <=  2 args + 1 res, each with head & tail */
+	size_t argsize, m = 0;
 	int threads = GDKnr_threads ? GDKnr_threads : 1;
 	int activeClients;
 #ifndef HAVE_EMBEDDED
@@ -78,7 +133,9 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 		        getFunctionId(p) == subeval_aggrRef)
 			return 0;
 
-		/* Mergetable cannot handle intersect/except's for now */
+		/* Mergetable cannot handle intersect/except's for now;
+		 * without mitosis, BATgroup groups large inputs in
+		 * parallel by itself */
 		if (getModuleId(p) == algebraRef && getFunctionId(p) == groupbyRef) 
 			return 0;
 
@@ -97,8 +154,6 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 		 */
 		r = getRowCnt(mb, getArg(p, 0));
 		if (r >= rowcnt) {
-			/* the rowsize depends on the column types, assume void-headed */
-			row_size = ATOMsize(getBatType(getArgType(mb,p,0)));
 			rowcnt = r;
 			target = p;
 			estimate++;
@@ -107,6 +162,7 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 	}
 	if (target == 0)
 		return 0;
+	row_size = rowSize(mb, target);
 	/*
 	 * The number of pieces should be based on the footprint of the
 	 * queryplan, such that preferrably it can be handled without
@@ -120,7 +176,12 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 	 *
 	 * Take into account the number of client connections, 
 	 * because all user together are responsible for resource contentions
+	 *
+	 * The footprint of a row is that of the columns of the target
+	 * table used by the plan, plus as much again for the
+	 * intermediates derived from them and a candidate oid.
 	 */
+	argsize = 2 * (size_t) row_size + sizeof(oid);
 	m = monet_memory / argsize;
 	/* if data exceeds memory size,
 	 * i.e., (rowcnt*argsize > monet_memory),
@@ -135,10 +196,10 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 		 * i.e., (pieces => rowcnt/(m/threads))
 		 * (assuming that (m > threads*MINPARTCNT)) */
 		pieces = (int) (rowcnt / (m / threads / activeClients)) + 1;
-	} else if (rowcnt > MINPARTCNT) {
+	} else if (rowcnt > (minpart = minPartCnt(row_size))) {
 	/* exploit parallelism, but ensure minimal partition size to
 	 * limit overhead */
-		pieces = (int) MIN(rowcnt / MINPARTCNT, (BUN) threads);
+		pieces = (int) MIN(rowcnt / minpart, (BUN) threads);
 	}
 	/* when testing, always aim for full parallelism, but avoid
 	 * empty pieces */
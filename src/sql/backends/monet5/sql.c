@@ -804,6 +804,21 @@ mvc_bind_idxbat(mvc *m, const char *sname, const char *tname, const char *iname,
 	return b;
 }
 
+/* Rows in each but the last piece of a partitioned bind.  The pieces
+ * start on a multiple of PARTALIGN rows, so that they do not share
+ * cachelines, pages or imprint lines with their neighbours. */
+#define PARTALIGN 1024
+
+static BUN
+mvc_partsize(BUN cnt, int nr_parts)
+{
+	BUN psz = cnt / nr_parts;
+
+	if (psz > PARTALIGN)
+		psz -= psz % PARTALIGN;
+	return psz;
+}
+
 /* str mvc_bind_wrap(int *bid, str *sname, str *tname, str *cname, int *access); */
 str
 mvc_bind_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
@@ -834,7 +849,7 @@ mvc_bind_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 			int nr_parts = *getArgReference_int(stk, pci, 7 + upd);
 
 			if (*access == 0) {
-				psz = cnt ? (cnt / nr_parts) : 0;
+				psz = mvc_partsize(cnt, nr_parts);
 				bn = BATslice(b, part_nr * psz, (part_nr + 1 == nr_parts) ? cnt : ((part_nr + 1) * psz));
 				BAThseqbase(bn, part_nr * psz);
 			} else {
@@ -845,7 +860,7 @@ mvc_bind_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 					throw(SQL,"sql.bind","Cannot access the update column");
 
 				cnt = BATcount(c);
-				psz = cnt ? (cnt / nr_parts) : 0;
+				psz = mvc_partsize(cnt, nr_parts);
 				l = part_nr * psz;
 				h = (part_nr + 1 == nr_parts) ? cnt : ((part_nr + 1) * psz);
 				h--;
@@ -937,7 +952,7 @@ mvc_bind_idxbat_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 			int nr_parts = *getArgReference_int(stk, pci, 7 + upd);
 
 			if (*access == 0) {
-				psz = cnt ? (cnt / nr_parts) : 0;
+				psz = mvc_partsize(cnt, nr_parts);
 				bn = BATslice(b, part_nr * psz, (part_nr + 1 == nr_parts) ? cnt : ((part_nr + 1) * psz));
 				BAThseqbase(bn, part_nr * psz);
 			} else {
@@ -947,7 +962,7 @@ mvc_bind_idxbat_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 				if ( c == NULL)
 					throw(SQL,"sql.bindidx","can not access index column");
 				cnt = BATcount(c);
-				psz = cnt ? (cnt / nr_parts) : 0;
+				psz = mvc_partsize(cnt, nr_parts);
 				l = part_nr * psz;
 				h = (part_nr + 1 == nr_parts) ? cnt : ((part_nr + 1) * psz);
 				h--;
@@ -1694,7 +1709,7 @@ SQLtid(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 		int part_nr = *getArgReference_int(stk, pci, 4);
 		int nr_parts = *getArgReference_int(stk, pci, 5);
 
-		nr /= nr_parts;
+		nr = mvc_partsize(nr, nr_parts);
 		sb = (oid) (part_nr * nr);
 		if (nr_parts == (part_nr + 1)) {	/* last part gets the inserts */
 			nr = cnt - (part_nr * nr);	/* keep rest */
@@ -2618,7 +2633,8 @@ mvc_import_table_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 }
 
 /* str mvc_bin_import_table_wrap(.., str *sname, str *tname, str *fname..);
- * binary attachment only works for simple binary types.
+ * binary attachment only works for simple binary types, unless the
+ * file is a column file (see BATwritecolumn), which is loaded as is.
  * Non-simple types require each line to contain a valid ascii representation
  * of the text terminate by a new-line. These strings are passed to the corresponding
  * atom conversion routines to fill the column.
@@ -2693,6 +2709,12 @@ mvc_bin_import_table_wrap(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pc
 		if (strcmp(fname, str_nil) == 0) {
 			// no filename for this column, skip for now because we potentially don't know the count yet
 			continue;
+		} else if (BATiscolumnfile(fname)) {
+			/* a column file carries the heaps themselves */
+			c = BATreadcolumn(tpe, fname, TRANSIENT);
+			if (c == NULL)
+				throw(SQL, "sql", "Failed to load column file %s", fname);
+			BATsetaccess(c, BAT_READ);
 		} else if (tpe < TYPE_str || tpe == TYPE_date || tpe == TYPE_daytime || tpe == TYPE_timestamp) {
 			c = BATattach(col->type.type->localtype, fname, TRANSIENT);
 			if (c == NULL)
@@ -3556,7 +3578,8 @@ sql_rowid(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 		throw(SQL,"sql.rowid","Can not bind to column");
 	/* UGH (move into storage backends!!) */
 	d = c->data;
-	*rid = d->ibase + BATcount(b);
+	/* a merged copy holds the inserts in the main bat */
+	*rid = d->mbid ? (oid) d->cnt : d->ibase + BATcount(b);
 	BBPunfix(b->batCacheid);
 	return MAL_SUCCEED;
 }
@@ -4328,6 +4351,195 @@ sql_storage(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 	throw(SQL, "sql.storage", MAL_MALLOC_FAIL);
 }
 
+/*
+ * The pending inserts and updates of the columns, as seen by the
+ * current transaction.
+ * create function deltas()
+ * returns table ("schema" string, "table" string, "column" string, "count" bigint, inserts bigint, updates bigint, merged boolean, versions int)
+ * external name sql.deltas;
+ */
+str
+sql_deltas(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
+{
+	BAT *sch, *tab, *col, *cnt, *ins, *upd, *merged, *versions;
+	mvc *m = NULL;
+	str msg;
+	sql_trans *tr;
+	node *nsch, *ntab, *ncol;
+	bat *rsch = getArgReference_bat(stk, pci, 0);
+	bat *rtab = getArgReference_bat(stk, pci, 1);
+	bat *rcol = getArgReference_bat(stk, pci, 2);
+	bat *rcnt = getArgReference_bat(stk, pci, 3);
+	bat *rins = getArgReference_bat(stk, pci, 4);
+	bat *rupd = getArgReference_bat(stk, pci, 5);
+	bat *rmerged = getArgReference_bat(stk, pci, 6);
+	bat *rversions = getArgReference_bat(stk, pci, 7);
+
+	if ((msg = getSQLContext(cntxt, mb, &m, NULL)) != NULL)
+		return msg;
+	if ((msg = checkSQLContext(cntxt)) != NULL)
+		return msg;
+
+	tr = m->session->tr;
+	sch = COLnew(0, TYPE_str, 0, TRANSIENT);
+	tab = COLnew(0, TYPE_str, 0, TRANSIENT);
+	col = COLnew(0, TYPE_str, 0, TRANSIENT);
+	cnt = COLnew(0, TYPE_lng, 0, TRANSIENT);
+	ins = COLnew(0, TYPE_lng, 0, TRANSIENT);
+	upd = COLnew(0, TYPE_lng, 0, TRANSIENT);
+	merged = COLnew(0, TYPE_bit, 0, TRANSIENT);
+	versions = COLnew(0, TYPE_int, 0, TRANSIENT);
+
+	if (sch == NULL || tab == NULL || col == NULL || cnt == NULL ||
+	    ins == NULL || upd == NULL || merged == NULL || versions == NULL)
+		goto bailout;
+
+	for (nsch = tr->schemas.set->h; nsch; nsch = nsch->next) {
+		sql_schema *s = nsch->data;
+
+		if (!isalpha((int) s->base.name[0]) || !s->tables.set)
+			continue;
+		for (ntab = s->tables.set->h; ntab; ntab = ntab->next) {
+			sql_table *t = ntab->data;
+
+			if (!isTable(t) || !t->columns.set)
+				continue;
+			for (ncol = t->columns.set->h; ncol; ncol = ncol->next) {
+				sql_column *c = ncol->data;
+				sql_delta_stats st;
+				lng l;
+				bit b;
+
+				store_funcs.delta_col(tr, c, &st);
+				if (BUNappend(sch, s->base.name, FALSE) != GDK_SUCCEED ||
+				    BUNappend(tab, t->base.name, FALSE) != GDK_SUCCEED ||
+				    BUNappend(col, c->base.name, FALSE) != GDK_SUCCEED)
+					goto bailout;
+				l = (lng) st.cnt;
+				if (BUNappend(cnt, &l, FALSE) != GDK_SUCCEED)
+					goto bailout;
+				l = (lng) st.ins;
+				if (BUNappend(ins, &l, FALSE) != GDK_SUCCEED)
+					goto bailout;
+				l = (lng) st.upd;
+				if (BUNappend(upd, &l, FALSE) != GDK_SUCCEED)
+					goto bailout;
+				b = st.merged != 0;
+				if (BUNappend(merged, &b, FALSE) != GDK_SUCCEED ||
+				    BUNappend(versions, &st.versions, FALSE) != GDK_SUCCEED)
+					goto bailout;
+			}
+		}
+	}
+
+	BBPkeepref(*rsch = sch->batCacheid);
+	BBPkeepref(*rtab = tab->batCacheid);
+	BBPkeepref(*rcol = col->batCacheid);
+	BBPkeepref(*rcnt = cnt->batCacheid);
+	BBPkeepref(*rins = ins->batCacheid);
+	BBPkeepref(*rupd = upd->batCacheid);
+	BBPkeepref(*rmerged = merged->batCacheid);
+	BBPkeepref(*rversions = versions->batCacheid);
+	return MAL_SUCCEED;
+
+  bailout:
+	if (sch)
+		BBPunfix(sch->batCacheid);
+	if (tab)
+		BBPunfix(tab->batCacheid);
+	if (col)
+		BBPunfix(col->batCacheid);
+	if (cnt)
+		BBPunfix(cnt->batCacheid);
+	if (ins)
+		BBPunfix(ins->batCacheid);
+	if (upd)
+		BBPunfix(upd->batCacheid);
+	if (merged)
+		BBPunfix(merged->batCacheid);
+	if (versions)
+		BBPunfix(versions->batCacheid);
+	throw(SQL, "sql.deltas", MAL_MALLOC_FAIL);
+}
+
+/*
+ * The store lock waits of commits per table, counted in buckets of
+ * waits below 2^n microseconds.
+ * create function lock_waits()
+ * returns table ("schema" string, "table" string, below_usec bigint, waits bigint)
+ * external name sql.lock_waits;
+ */
+str
+sql_lock_waits(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
+{
+	BAT *sch, *tab, *below, *cnt;
+	mvc *m = NULL;
+	str msg;
+	sql_trans *tr;
+	node *nsch, *ntab;
+	bat *rsch = getArgReference_bat(stk, pci, 0);
+	bat *rtab = getArgReference_bat(stk, pci, 1);
+	bat *rbelow = getArgReference_bat(stk, pci, 2);
+	bat *rcnt = getArgReference_bat(stk, pci, 3);
+
+	if ((msg = getSQLContext(cntxt, mb, &m, NULL)) != NULL)
+		return msg;
+	if ((msg = checkSQLContext(cntxt)) != NULL)
+		return msg;
+
+	tr = m->session->tr;
+	sch = COLnew(0, TYPE_str, 0, TRANSIENT);
+	tab = COLnew(0, TYPE_str, 0, TRANSIENT);
+	below = COLnew(0, TYPE_lng, 0, TRANSIENT);
+	cnt = COLnew(0, TYPE_lng, 0, TRANSIENT);
+
+	if (sch == NULL || tab == NULL || below == NULL || cnt == NULL)
+		goto bailout;
+
+	for (nsch = tr->schemas.set->h; nsch; nsch = nsch->next) {
+		sql_schema *s = nsch->data;
+
+		if (!isalpha((int) s->base.name[0]) || !s->tables.set)
+			continue;
+		for (ntab = s->tables.set->h; ntab; ntab = ntab->next) {
+			sql_table *t = ntab->data;
+			lng waits[LOCK_WAIT_BUCKETS];
+			int i;
+
+			if (!isTable(t) || !store_lock_waits(t->base.id, waits))
+				continue;
+			for (i = 0; i < LOCK_WAIT_BUCKETS; i++) {
+				lng l = i < LOCK_WAIT_BUCKETS - 1 ? (lng) 1 << i : lng_nil;
+
+				if (waits[i] == 0)
+					continue;
+				if (BUNappend(sch, s->base.name, FALSE) != GDK_SUCCEED ||
+				    BUNappend(tab, t->base.name, FALSE) != GDK_SUCCEED ||
+				    BUNappend(below, &l, FALSE) != GDK_SUCCEED ||
+				    BUNappend(cnt, &waits[i], FALSE) != GDK_SUCCEED)
+					goto bailout;
+			}
+		}
+	}
+
+	BBPkeepref(*rsch = sch->batCacheid);
+	BBPkeepref(*rtab = tab->batCacheid);
+	BBPkeepref(*rbelow = below->batCacheid);
+	BBPkeepref(*rcnt = cnt->batCacheid);
+	return MAL_SUCCEED;
+
+  bailout:
+	if (sch)
+		BBPunfix(sch->batCacheid);
+	if (tab)
+		BBPunfix(tab->batCacheid);
+	if (below)
+		BBPunfix(below->batCacheid);
+	if (cnt)
+		BBPunfix(cnt->batCacheid);
+	throw(SQL, "sql.lock_waits", MAL_MALLOC_FAIL);
+}
+
 void
 freeVariables(Client c, MalBlkPtr mb, MalStkPtr glb, int start)
 {
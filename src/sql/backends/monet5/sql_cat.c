@@ -655,8 +655,10 @@ alter_table(Client cntxt, mvc *sql, char *sname, sql_table *t)
 			if (i->type == imprints_idx) {
 				sql_kc *ic = i->columns->h->data;
 				BAT *b = mvc_bind(sql, nt->s->base.name, nt->base.name, ic->c->base.name, 0);
-				BATimprints(b);
+				gdk_return r = BATimprints(b);
 				BBPunfix(b->batCacheid);
+				if (r != GDK_SUCCEED)
+					return sql_message("40002!CREATE IMPRINTS INDEX: cannot create imprints on column %s of type %s", ic->c->base.name, ic->c->type.type->sqlname);
 			}
 			mvc_copy_idx(sql, nt, i);
 		}
@@ -131,6 +131,9 @@ SQLrun(Client c, backend *be, mvc *m){
 	InstrPtr p=0;
 	int i,j, retc;
 	ValPtr val;
+#ifdef HAVE_EMBEDDED
+	int setprogress;
+#endif
 			
 	if ( *m->errstr)
 		return createException(PARSE, "SQLparser", "%s", m->errstr);
@@ -226,12 +229,17 @@ SQLrun(Client c, backend *be, mvc *m){
 		if (c->progress_callback) {
 			c->progress_callback(c, c->progress_data, c->progress_len, 0, 0);
 		}
-
+		// kernel progress on this thread goes to the client, set it
+		// once per query; nested queries keep the outer setting
+		if ((setprogress = GDKprogressarg == NULL) != 0)
+			GDKsetprogressarg(c);
 #endif
 		msg = runMAL(c, mb, 0, 0);
 
 		// TODO: lock?
 #ifdef HAVE_EMBEDDED
+		if (setprogress)
+			GDKsetprogressarg(NULL);
 		if (c->progress_callback) {
 			c->progress_callback(c, c->progress_data, c->progress_len, c->progress_len, 1);
 		}
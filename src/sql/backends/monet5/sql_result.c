@@ -871,21 +871,34 @@ mvc_import_table(Client cntxt, BAT ***bats, mvc *m, bstream *bs, sql_table *t, c
 			fmt[i].null_length = strlen(ns);
 			fmt[i].nildata = ATOMnilptr(fmt[i].adt);
 			fmt[i].skip = (col->base.name[0] == '%');
+			fmt[i].parse = TABLET_ATOM;
 			if (col->type.type->eclass == EC_DEC) {
 				fmt[i].tostr = &dec_tostr;
 				fmt[i].frstr = &dec_frstr;
+				fmt[i].parse = TABLET_DECIMAL;
+				fmt[i].scale = (int) col->type.scale;
+				fmt[i].precision = (int) col->type.digits;
 			} else if (col->type.type->eclass == EC_SEC) {
 				fmt[i].tostr = &dec_tostr;
 				fmt[i].frstr = &sec_frstr;
+				fmt[i].parse = TABLET_GENERIC;
 			}
 			fmt[i].size = ATOMsize(fmt[i].adt);
 
 			if (locked) {
-				BAT *b = store_funcs.bind_col(m->session->tr, col, RDONLY);
+				BAT *b;
+
+				/* we write into the main bat, not a merged copy */
+				store_funcs.unmerge_col(m->session->tr, col);
+				b = store_funcs.bind_col(m->session->tr, col, RDONLY);
 				if (b == NULL)
 					sql_error(m, 500, "failed to bind to table column");
 
+				/* the loader writes past the imprints and
+				 * order index */
 				HASHdestroy(b);
+				IMPSdestroy(b);
+				OIDXdestroy(b);
 
 				fmt[i].c = b;
 				cnt = BATcount(b);
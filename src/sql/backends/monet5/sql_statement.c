@@ -525,6 +525,7 @@ stmt_bat(backend *be, sql_column *c, int access, int partition)
 		if (c && (!isRemote(c->t) && !isMergeTable(c->t))) {
 			BUN rows = (BUN) store_funcs.count_col(tr, c, 1);
 			setRowCnt(mb,getArg(q,0),rows);
+			setRowSize(mb,getArg(q,0),store_funcs.width_col(tr, c));
 			if (c->t->p && 0)
 				setMitosisPartition(q, c->t->p->base.id);
 		}
@@ -482,6 +482,66 @@ sql_update_jul2017(Client c, mvc *sql)
 	return err;		/* usually MAL_SUCCEED */
 }
 
+static str
+sql_update_deltas(Client c, mvc *sql)
+{
+	size_t bufsize = 2048, pos = 0;
+	char *buf = GDKmalloc(bufsize), *err = NULL;
+	char *schema = stack_get_string(sql, "current_schema");
+
+	if (buf == NULL)
+		throw(SQL, "sql_update_deltas", MAL_MALLOC_FAIL);
+	pos += snprintf(buf + pos, bufsize - pos, "set schema \"sys\";\n");
+
+	/* 75_storagemodel.sql */
+	pos += snprintf(buf + pos, bufsize - pos,
+			"create function sys.deltas() "
+			"returns table (\"schema\" string, \"table\" string, \"column\" string, \"count\" bigint, inserts bigint, updates bigint, merged boolean, versions int) "
+			"external name sql.deltas;\n"
+			"create view sys.deltas as select * from sys.deltas();\n"
+			"insert into sys.systemfunctions (select id from sys.functions where name = 'deltas' and schema_id = (select id from sys.schemas where name = 'sys') and id not in (select function_id from sys.systemfunctions));\n"
+			"update sys._tables set system = true where name = 'deltas' and schema_id = (select id from sys.schemas where name = 'sys');\n");
+
+	if (schema)
+		pos += snprintf(buf + pos, bufsize - pos, "set schema \"%s\";\n", schema);
+	assert(pos < bufsize);
+
+	printf("Running database upgrade commands:\n%s\n", buf);
+	err = SQLstatementIntern(c, &buf, "update", 1, 0, NULL);
+	GDKfree(buf);
+	return err;		/* usually MAL_SUCCEED */
+}
+
+static str
+sql_update_lock_waits(Client c, mvc *sql)
+{
+	size_t bufsize = 2048, pos = 0;
+	char *buf = GDKmalloc(bufsize), *err = NULL;
+	char *schema = stack_get_string(sql, "current_schema");
+
+	if (buf == NULL)
+		throw(SQL, "sql_update_lock_waits", MAL_MALLOC_FAIL);
+	pos += snprintf(buf + pos, bufsize - pos, "set schema \"sys\";\n");
+
+	/* 75_storagemodel.sql */
+	pos += snprintf(buf + pos, bufsize - pos,
+			"create function sys.lock_waits() "
+			"returns table (\"schema\" string, \"table\" string, below_usec bigint, waits bigint) "
+			"external name sql.lock_waits;\n"
+			"create view sys.lock_waits as select * from sys.lock_waits();\n"
+			"insert into sys.systemfunctions (select id from sys.functions where name = 'lock_waits' and schema_id = (select id from sys.schemas where name = 'sys') and id not in (select function_id from sys.systemfunctions));\n"
+			"update sys._tables set system = true where name = 'lock_waits' and schema_id = (select id from sys.schemas where name = 'sys');\n");
+
+	if (schema)
+		pos += snprintf(buf + pos, bufsize - pos, "set schema \"%s\";\n", schema);
+	assert(pos < bufsize);
+
+	printf("Running database upgrade commands:\n%s\n", buf);
+	err = SQLstatementIntern(c, &buf, "update", 1, 0, NULL);
+	GDKfree(buf);
+	return err;		/* usually MAL_SUCCEED */
+}
+
 void
 SQLupgrades(Client c, mvc *m)
 {
@@ -519,4 +579,18 @@ SQLupgrades(Client c, mvc *m)
 			freeException(err);
 		}
 	}
+
+	if (sql_bind_func(m->sa, s, "deltas", NULL, NULL, F_UNION) == NULL) {
+		if ((err = sql_update_deltas(c, m)) != NULL) {
+			fprintf(stderr, "!%s\n", err);
+			freeException(err);
+		}
+	}
+
+	if (sql_bind_func(m->sa, s, "lock_waits", NULL, NULL, F_UNION) == NULL) {
+		if ((err = sql_update_lock_waits(c, m)) != NULL) {
+			fprintf(stderr, "!%s\n", err);
+			freeException(err);
+		}
+	}
 }
@@ -108,6 +108,38 @@ returns table (
 )
 external name sql."storage";
 
+-- The pending inserts and updates per column, which queries combine
+-- with the stored column until they are merged. Merged columns are read
+-- from a copy with the deltas applied (see gdk_delta_merge_rows), older
+-- versions are kept while transactions still use them.
+create function sys.deltas()
+returns table (
+	"schema" string,
+	"table" string,
+	"column" string,
+	"count" bigint,
+	inserts bigint,
+	updates bigint,
+	merged boolean,
+	versions int
+)
+external name sql.deltas;
+
+create view sys.deltas as select * from sys.deltas();
+
+-- The time commits waited for the store lock, per table written and
+-- counted in buckets of waits below 2^n microseconds.
+create function sys.lock_waits()
+returns table (
+	"schema" string,
+	"table" string,
+	below_usec bigint,
+	waits bigint
+)
+external name sql.lock_waits;
+
+create view sys.lock_waits as select * from sys.lock_waits();
+
 -- To determine the footprint of an arbitrary database, we first have
 -- to define its schema, followed by an indication of the properties of each column.
 -- A storage model input table for the size prediction is shown below:
@@ -1294,7 +1294,7 @@ copyfrom(mvc *sql, dlist *qname, dlist *columns, dlist *files, dlist *headers, d
 		if (headers)
 			return sql_error(sql, 02, "COPY INTO .. LOCKED: not allowed with column lists");
 		store_lock();
-		while (store_nr_active > 1) {
+		while (store_nr_active > 1 || store_flushing) {
 			store_unlock();
 			MT_sleep_ms(100);
 			store_lock();
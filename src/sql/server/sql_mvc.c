@@ -286,6 +286,8 @@ mvc_commit(mvc *m, int chain, const char *name)
 {
 	sql_trans *cur, *tr = m->session->tr, *ctr;
 	int ok = SQL_OK;//, wait = 0;
+	lng lsn = 0, t0, wait;
+	trans_stamps *stamps;
 
 	assert(tr);
 	assert(m->session->active);	/* only commit an active transaction */
@@ -335,7 +337,16 @@ build up the hash (not copied in the trans dup)) */
 	cur -> parent = tr;
 	tr = cur;
 
+	/* conflicts with already committed transactions are found without
+	 * queueing for the store lock */
+	if (!sql_trans_precommit(tr, &stamps)) {
+		(void)sql_error(m, 010, "40000!COMMIT: transaction is aborted because of concurrency conflicts, will ROLLBACK instead");
+		mvc_rollback(m, chain, name);
+		return -1;
+	}
+	t0 = GDKusec();
 	store_lock();
+	wait = GDKusec() - t0;
 	/* if there is nothing to commit reuse the current transaction */
 	if (tr->wtime == 0) {
 		if (!chain) 
@@ -346,6 +357,9 @@ build up the hash (not copied in the trans dup)) */
 		store_unlock();
 		return 0;
 	}
+	/* the store manager may be writing the bats we change */
+	store_wait_flush();
+	wait = GDKusec() - t0;
 
 	/*
 	while (tr->schema_updates && store_nr_active > 1) {
@@ -362,13 +376,14 @@ build up the hash (not copied in the trans dup)) */
 	 * */
 	/* validation phase */
 	if (sql_trans_validate(tr)) {
-		if ((ok = sql_trans_commit(tr)) != SQL_OK) {
+		if ((ok = sql_trans_commit_delayed(tr, &lsn)) != SQL_OK) {
 			char *msg = sql_message("40000!COMMIT: transaction commit failed (perhaps your disk is full?) exiting (kernel error: %s)", GDKerrbuf);
 			GDKfatal("%s", msg);
 			_DELETE(msg);
 		}
 	} else {
 		store_unlock();
+		sql_trans_postcommit(stamps, wait, 0);
 		(void)sql_error(m, 010, "40000!COMMIT: transaction is aborted because of concurrency conflicts, will ROLLBACK instead");
 		mvc_rollback(m, chain, name);
 		return -1;
@@ -377,6 +392,14 @@ build up the hash (not copied in the trans dup)) */
 	if (chain) 
 		sql_trans_begin(m->session);
 	store_unlock();
+	/* the commit statistics are kept outside the store lock */
+	sql_trans_postcommit(stamps, wait, 1);
+	/* group commit: wait for the log outside the store lock */
+	if (store_sync(lsn) != LOG_OK) {
+		char *msg = sql_message("40000!COMMIT: transaction commit failed (perhaps your disk is full?) exiting (kernel error: %s)", GDKerrbuf);
+		GDKfatal("%s", msg);
+		_DELETE(msg);
+	}
 	m->type = Q_TRANS;
 	if (mvc_debug)
 		fprintf(stderr, "#mvc_commit %s done\n", (name) ? name : "");
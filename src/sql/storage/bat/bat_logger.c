@@ -271,6 +271,16 @@ bl_changes(void)
 	return (int) MIN(logger_changes(bat_logger), GDK_int_max);
 }
 
+static int
+bl_flush(lng budget, lng *written, int *done)
+{
+	*written = 0;
+	*done = 1;
+	if (bat_logger == NULL)
+		return LOG_OK;
+	return logger_flush_dirty(bat_logger, budget, written, done) == GDK_SUCCEED ? LOG_OK : LOG_ERR;
+}
+
 static lng
 bl_read_last_transaction_id_shared(void)
 {
@@ -324,9 +334,26 @@ bl_tstart(void)
 }
 
 static int 
-bl_tend(void)
+bl_tend(lng *lsn)
 {
-	return log_tend(bat_logger) == GDK_SUCCEED ? LOG_OK : LOG_ERR;
+	return log_tend_delayed(bat_logger, lsn) == GDK_SUCCEED ? LOG_OK : LOG_ERR;
+}
+
+static int 
+bl_tsync(lng lsn)
+{
+	if (bat_logger == NULL)
+		return LOG_OK;
+	return log_tsync(bat_logger, lsn) == GDK_SUCCEED ? LOG_OK : LOG_ERR;
+}
+
+static void
+bl_get_stats(logger_stats *st)
+{
+	if (bat_logger == NULL)
+		memset(st, 0, sizeof(*st));
+	else
+		logger_get_stats(bat_logger, st);
 }
 
 static int 
@@ -355,10 +382,13 @@ bat_logger_init( logger_functions *lf )
 	lf->restart = bl_restart;
 	lf->cleanup = bl_cleanup;
 	lf->changes = bl_changes;
+	lf->flush = bl_flush;
 	lf->get_sequence = bl_get_sequence;
 	lf->log_isnew = bl_log_isnew;
 	lf->log_tstart = bl_tstart;
 	lf->log_tend = bl_tend;
+	lf->log_tsync = bl_tsync;
+	lf->get_stats = bl_get_stats;
 	lf->log_sequence = bl_sequence;
 	lf->log_isdestroyed = bl_isdestroyed;
 }
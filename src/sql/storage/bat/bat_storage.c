@@ -83,7 +83,7 @@ delta_bind_ubat(sql_delta *bat, int access, int type)
 	(void) access; /* satisfy compiler */
 #endif
 	assert(access == RD_UPD_ID || access == RD_UPD_VAL);
-	if (bat->uibid && bat->uvbid) {
+	if (bat->uibid && bat->uvbid && !bat->mbid) {
 		if (access == RD_UPD_ID)
 			b = temp_descriptor(bat->uibid);
 		else
@@ -143,6 +143,19 @@ delta_bind_bat( sql_delta *bat, int access, int temp)
 	assert(bat != NULL);
 	if (access == QUICK)
 		return quick_descriptor(bat->bid);
+	if (!temp && bat->mbid) {
+		/* inserts and updates are part of the merged copy */
+		b = temp_descriptor(bat->mbid);
+		if (b == NULL)
+			return NULL;
+		if (access == RD_INS) {
+			int tt = b->ttype;
+
+			bat_destroy(b);
+			b = e_BAT(tt);
+		}
+		return b;
+	}
 	if (temp || access == RD_INS) {
 		assert(bat->ibid);
 		b = temp_descriptor(bat->ibid);
@@ -963,8 +976,12 @@ count_col(sql_trans *tr, sql_column *c, int all)
         b = c->data;
 	if (!b)
 		return 1;
-	if (all) 
+	if (all)
 		return b->cnt;
+	else if (b->mbid)
+		/* the merged copy holds the inserts, bind_col returns it
+		 * for RDONLY and an empty bat for RD_INS */
+		return 0;
 	else
 		return b->cnt - b->ibase;
 }
@@ -1143,6 +1160,29 @@ double_elim_col(sql_trans *tr, sql_column *col)
 	return de;
 }
 
+static int
+width_col(sql_trans *tr, sql_column *col)
+{
+	int w = 0;
+
+	if (!isTable(col->t) || !col->t->s)
+		return 0;
+	/* fallback to central bat */
+	if (tr && tr->parent && !col->data && col->po) 
+		col = col->po;
+
+	if (col && col->data) {
+		BAT *b = bind_col(tr, col, QUICK);
+
+		if (b) {
+			w = b->twidth;
+			if (b->tvarsized && b->ttype && BATcount(b))
+				w += (int) (b->tvheap->free / BATcount(b));
+		}
+	}
+	return w;
+}
+
 static int
 load_delta(sql_delta *bat, int bid, int type)
 {
@@ -1536,9 +1576,11 @@ destroy_delta(sql_delta *b)
 		temp_destroy(b->uvbid);
 	if (b->bid) 
 		temp_destroy(b->bid);
+	if (b->mbid)
+		temp_destroy(b->mbid);
 	if (b->cached)
 		bat_destroy(b->cached);
-	b->bid = b->ibid = b->uibid = b->uvbid = 0;
+	b->bid = b->ibid = b->uibid = b->uvbid = b->mbid = 0;
 	b->name = NULL;
 	b->cached = NULL;
 	return LOG_OK;
@@ -1664,6 +1706,16 @@ log_destroy_del(sql_trans *tr, sql_table *t)
 	return LOG_OK;
 }
 
+/* the merged copy is stale once the bats it was made of change */
+static void
+drop_merged(sql_delta *bat)
+{
+	if (bat->mbid) {
+		temp_destroy(bat->mbid);
+		bat->mbid = 0;
+	}
+}
+
 static BUN
 clear_delta(sql_trans *tr, sql_delta *bat)
 {
@@ -1674,6 +1726,7 @@ clear_delta(sql_trans *tr, sql_delta *bat)
 		bat_destroy(bat->cached);
 		bat->cached = NULL;
 	}
+	drop_merged(bat);
 	if (bat->ibid) {
 		b = temp_descriptor(bat->ibid);
 		sz += BATcount(b);
@@ -1901,6 +1954,7 @@ gtr_update_delta( sql_trans *tr, sql_delta *cbat, int *changes)
 	(void)tr;
 	assert(store_nr_active==0);
 	
+	drop_merged(cbat);
 	cur = temp_descriptor(cbat->bid);
 	ins = temp_descriptor(cbat->ibid);
 	/* any inserts */
@@ -2130,6 +2184,7 @@ tr_update_delta( sql_trans *tr, sql_delta *obat, sql_delta *cbat, int unique)
 		bat_destroy(obat->cached);
 		obat->cached = NULL;
 	}
+	drop_merged(obat);
 	if (cbat->cached) {
 		bat_destroy(cbat->cached);
 		cbat->cached = NULL;
@@ -2241,6 +2296,7 @@ tr_merge_delta( sql_trans *tr, sql_delta *obat, int unique)
 		bat_destroy(obat->cached);
 		obat->cached = NULL;
 	}
+	drop_merged(obat);
 	if (obat->bid)
 		cur = temp_descriptor(obat->bid);
 	ins = temp_descriptor(obat->ibid);
@@ -2349,7 +2405,7 @@ tr_update_dbat(sql_trans *tr, sql_dbat *tdb, sql_dbat *fdb, int cleared)
 
 /* the central and transaction local bats need to be swapped */
 static int
-tr_update_dbat_swap(sql_dbat *tdb, sql_dbat *fdb)
+tr_update_dbat_swap(sql_dbat *tdb, sql_dbat *fdb, int cleared)
 {
 	/* The fdb holds the central bat, tdb has the proper new rows
 	 * Add these (new) rows to the fdb->dbid
@@ -2363,6 +2419,28 @@ tr_update_dbat_swap(sql_dbat *tdb, sql_dbat *fdb)
 		return ok;
 
 	db = temp_descriptor(tdb->dbid);
+	if (cleared) {
+		/* tdb only holds the rows deleted after the clear, so
+		 * fdb keeps a copy of the older deletes and the central
+		 * bat is cleared like the logger does */
+		BAT *odb = temp_descriptor(fdb->dbid);
+		log_bid obid = temp_copy(fdb->dbid, 0);
+
+		if (obid == BID_NIL) {
+			ok = LOG_ERR;
+		} else {
+			bat_clear(odb);
+			if (append_inserted(odb, db) == BUN_NONE)
+				ok = LOG_ERR;
+			BATcommit(odb);
+			temp_destroy(tdb->dbid);
+			tdb->dbid = fdb->dbid;
+			fdb->dbid = obid;
+		}
+		bat_destroy(odb);
+		bat_destroy(db);
+		return ok;
+	}
 	if (BUNlast(db) > db->batInserted) {
 		BAT *odb = temp_descriptor(fdb->dbid);
 
@@ -2447,7 +2525,7 @@ update_table(sql_trans *tr, sql_table *ft, sql_table *tt)
 				b = tt->data;
 				/* The central (as known to the logger) and 
 				 * transaction local bats need to be swapped */
-				tr_update_dbat_swap(tt->data, b->next);
+				tr_update_dbat_swap(tt->data, b->next, ft->cleared);
 			}
 		} else if (tt->data && ft->base.allocated) {
 			tr_update_dbat(tr, tt->data, ft->data, ft->cleared);
@@ -2743,6 +2821,180 @@ snapshot_table(sql_trans *tr, sql_table *ft)
 	return ok;
 }
 
+static void
+delta_col(sql_trans *tr, sql_column *c, sql_delta_stats *st)
+{
+	sql_delta *b;
+
+	memset(st, 0, sizeof(*st));
+	if (!isTable(c->t))
+		return;
+	if (!c->data && tr->parent) {
+		sql_column *oc = tr_find_column(tr->parent, c);
+		c->data = timestamp_delta(oc->data, tr->stime);
+	}
+	b = c->data;
+	if (!b)
+		return;
+	st->cnt = b->cnt;
+	st->ins = b->cnt - b->ibase;
+	st->upd = b->ucnt;
+	st->merged = b->mbid != 0;
+	for (; b; b = b->next)
+		st->versions++;
+}
+
+/* a merge in progress, it keeps the bats of the version it was made of */
+typedef struct sql_merge {
+	int bid, ibid, uibid, uvbid;
+	size_t cnt, ucnt;
+	int wtime;
+	int mbid;		/* the merged copy */
+} sql_merge;
+
+static void
+merge_destroy(sql_merge *m)
+{
+	if (m->bid)
+		temp_destroy(m->bid);
+	if (m->ibid)
+		temp_destroy(m->ibid);
+	if (m->uibid)
+		temp_destroy(m->uibid);
+	if (m->uvbid)
+		temp_destroy(m->uvbid);
+	if (m->mbid)
+		temp_destroy(m->mbid);
+	_DELETE(m);
+}
+
+static void *
+merge_col(sql_column *c)
+{
+	sql_delta *d = c->data;
+	sql_merge *m;
+
+	if (!d || !d->bid || d->mbid || isTemp(c) || 
+	    (d->cnt == d->ibase && !d->ucnt))
+		return NULL;
+	m = ZNEW(sql_merge);
+	if (m == NULL)
+		return NULL;
+	m->bid = d->bid;
+	m->ibid = d->ibid;
+	m->uibid = d->uibid;
+	m->uvbid = d->uvbid;
+	m->cnt = d->cnt;
+	m->ucnt = d->ucnt;
+	m->wtime = d->wtime;
+	temp_dup(m->bid);
+	if (m->ibid)
+		temp_dup(m->ibid);
+	if (m->uibid)
+		temp_dup(m->uibid);
+	if (m->uvbid)
+		temp_dup(m->uvbid);
+	return m;
+}
+
+/* same order as gtr_update_delta: append the inserts, then replace */
+static int
+merge_build(void *mp)
+{
+	sql_merge *m = mp;
+	BAT *b, *r, *i, *ui, *uv;
+
+	b = temp_descriptor(m->bid);
+	if (b == NULL)
+		return LOG_ERR;
+	r = COLcopy(b, b->ttype, TRUE, TRANSIENT);
+	bat_destroy(b);
+	if (r == NULL)
+		return LOG_ERR;
+	if (m->ibid) {
+		i = temp_descriptor(m->ibid);
+		if (i == NULL ||
+		    (BATcount(i) && BATappend(r, i, NULL, TRUE) != GDK_SUCCEED)) {
+			bat_destroy(i);
+			bat_destroy(r);
+			return LOG_ERR;
+		}
+		bat_destroy(i);
+	}
+	if (m->ucnt && m->uibid && m->uvbid) {
+		ui = temp_descriptor(m->uibid);
+		uv = temp_descriptor(m->uvbid);
+		if (ui == NULL || uv == NULL ||
+		    (BATcount(ui) && void_replace_bat(r, ui, uv, TRUE) == BUN_NONE)) {
+			bat_destroy(ui);
+			bat_destroy(uv);
+			bat_destroy(r);
+			return LOG_ERR;
+		}
+		bat_destroy(ui);
+		bat_destroy(uv);
+	}
+	if (BATcount(r) != m->cnt) {
+		bat_destroy(r);
+		return LOG_ERR;
+	}
+	bat_set_access(r, BAT_READ);
+	m->mbid = temp_create(r);
+	bat_destroy(r);
+	return LOG_OK;
+}
+
+static int
+merge_done(sql_column *c, void *mp)
+{
+	sql_merge *m = mp;
+	sql_delta *d = c ? c->data : NULL, *n;
+
+	/* only when nothing was committed to the column meanwhile */
+	if (!m->mbid || !d || d->mbid || d->wtime != m->wtime ||
+	    d->bid != m->bid || d->ibid != m->ibid || 
+	    d->uibid != m->uibid || d->uvbid != m->uvbid ||
+	    d->cnt != m->cnt || d->ucnt != m->ucnt) {
+		merge_destroy(m);
+		return LOG_OK;
+	}
+	/* older transactions keep reading d, new ones find n first */
+	n = ZNEW(sql_delta);
+	if (n == NULL) {
+		merge_destroy(m);
+		return LOG_ERR;
+	}
+	n->name = _STRDUP(d->name);
+	n->bid = m->bid;
+	n->ibase = d->ibase;
+	n->ibid = m->ibid;
+	n->uibid = m->uibid;
+	n->uvbid = m->uvbid;
+	n->cnt = d->cnt;
+	n->ucnt = d->ucnt;
+	n->mbid = m->mbid;
+	n->wtime = d->wtime;
+	n->next = d;
+	c->data = n;
+	_DELETE(m);
+	return LOG_OK;
+}
+
+/* only called without other active transactions (COPY INTO .. LOCKED),
+ * the caller writes into the main bats directly */
+static void
+unmerge_col(sql_trans *tr, sql_column *c)
+{
+	sql_column *oc = tr_find_column(tr->parent, c);
+	sql_delta *d;
+
+	assert(store_nr_active == 1);
+	if (!oc)
+		return;
+	for (d = oc->data; d; d = d->next)
+		drop_merged(d);
+}
+
 void
 bat_storage_init( store_functions *sf)
 {
@@ -2763,6 +3015,7 @@ bat_storage_init( store_functions *sf)
 	sf->dcount_col = (dcount_col_fptr)&dcount_col;
 	sf->sorted_col = (prop_col_fptr)&sorted_col;
 	sf->double_elim_col = (prop_col_fptr)&double_elim_col;
+	sf->width_col = (prop_col_fptr)&width_col;
 
 	sf->create_col = (create_col_fptr)&create_col;
 	sf->create_idx = (create_idx_fptr)&create_idx;
@@ -2797,5 +3050,11 @@ bat_storage_init( store_functions *sf)
 	sf->snapshot_table = (update_table_fptr)&snapshot_table;
 	sf->gtrans_update = (gtrans_update_fptr)&gtr_update;
 	sf->gtrans_minmax = (gtrans_update_fptr)&gtr_minmax;
+
+	sf->delta_col = (delta_col_fptr)&delta_col;
+	sf->merge_col = (merge_col_fptr)&merge_col;
+	sf->merge_build = (merge_build_fptr)&merge_build;
+	sf->merge_done = (merge_done_fptr)&merge_done;
+	sf->unmerge_col = (unmerge_col_fptr)&unmerge_col;
 }
 
@@ -21,6 +21,7 @@ typedef struct sql_delta {
 	int uvbid;		/* bat with updates */
 	size_t cnt;		/* number of tuples (excluding the deletes) */
 	size_t ucnt;		/* number of updates */
+	int mbid;		/* read-only copy with inserts and updates merged */
 	BAT *cached;		/* cached copy, used for schema bats only */
 	int wtime;		/* time stamp */
 	struct sql_delta *next;	/* possibly older version of the same column/idx */
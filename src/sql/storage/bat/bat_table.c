@@ -68,9 +68,12 @@ delta_full_bat_( sql_column *c, sql_delta *bat, int temp)
 		b := b.append(i);
 		b := b.replace(u);
 	*/
-	BAT *r, *b, *ui, *uv, *i = temp_descriptor(bat->ibid);
+	BAT *r, *b, *ui, *uv, *i;
 	int needcopy = 1;
 
+	if (!temp && bat->mbid)
+		return temp_descriptor(bat->mbid);
+	i = temp_descriptor(bat->ibid);
 	if (!i)
 		return NULL;
 	r = i; 
@@ -546,35 +549,217 @@ rids_diff(sql_trans *tr, rids *l, sql_column *lc, subrids *r, sql_column *rc )
 	return l;
 }
 
+static BAT *
+full_idx(sql_trans *tr, sql_idx *i)
+{
+	if (!i->data) {
+		sql_idx *oi = tr_find_idx(tr->parent, i);
+		i->data = timestamp_delta(oi->data, tr->stime);
+	}
+	return delta_full_bat(NULL, i->data, isTemp(i));
+}
+
+static void
+full_idx_destroy(sql_idx *i, BAT *b)
+{
+	sql_delta *d = i->data;
+	assert(d);
+	if (d->cached != b)
+		bat_destroy(b);
+}
+
+/* map old row positions onto their position after vacuum, deleted
+ * rows map to nil */
+static BAT *
+vacuum_map(BAT *tids, BUN cnt)
+{
+	BAT *map = BATconstant(0, TYPE_oid, &oid_nil, cnt, TRANSIENT);
+	const oid *o;
+	oid *m;
+	BUN p, q;
+
+	if (!map)
+		return NULL;
+	m = (oid *) Tloc(map, 0);
+	if (BATtdense(tids)) {
+		for (p = 0, q = BATcount(tids); p < q; p++)
+			m[tids->tseqbase + p] = p;
+	} else {
+		o = (const oid *) Tloc(tids, 0);
+		for (p = 0, q = BATcount(tids); p < q; p++)
+			m[o[p]] = p;
+	}
+	map->tkey = 0;
+	map->tsorted = map->trevsorted = 0;
+	map->tnonil = map->tnil = 0;
+	return map;
+}
+
+/* do foreign keys refer to row positions of t */
 static int
-table_vacuum(sql_trans *tr, sql_table *t)
+vacuum_referenced(sql_table *t)
 {
-	BAT *tids = delta_cands(tr, t);
-	BAT **cols;
 	node *n;
 
+	if (t->keys.set)
+	for (n = t->keys.set->h; n; n = n->next) {
+		sql_key *k = n->data;
+
+		if (k->type == fkey) {
+			if (((sql_fkey *) k)->rkey->k.t == t)
+				return 1;
+		} else if (!list_empty(((sql_ukey *) k)->keys)) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/* rewrite the join index of a foreign key referring to a vacuumed table */
+static int
+vacuum_fkey_idx(sql_trans *tr, sql_idx *i, BAT *map)
+{
+	BAT *v = full_idx(tr, i), *nv, *tids, *upd;
+	const oid *o, *n;
+	BUN p, q;
+	int ok = LOG_OK;
+
+	if (!v)
+		return LOG_ERR;
+	nv = BATproject(v, map);
+	if (nv && nv->ttype == TYPE_void) {
+		BAT *r = COLcopy(nv, TYPE_oid, 1, TRANSIENT);
+
+		bat_destroy(nv);
+		nv = r;
+	}
+	if (v->ttype == TYPE_void) {
+		BAT *r = COLcopy(v, TYPE_oid, 1, TRANSIENT);
+
+		full_idx_destroy(i, v);
+		if ((v = r) == NULL) {
+			bat_destroy(nv);
+			return LOG_ERR;
+		}
+	}
+	tids = COLnew(0, TYPE_oid, 0, TRANSIENT);
+	upd = COLnew(0, TYPE_oid, 0, TRANSIENT);
+	if (!nv || !tids || !upd) {
+		ok = LOG_ERR;
+		goto bailout;
+	}
+	o = (const oid *) Tloc(v, 0);
+	n = (const oid *) Tloc(nv, 0);
+	for (p = 0, q = BATcount(v); p < q && ok == LOG_OK; p++) {
+		if (o[p] == n[p])
+			continue;
+		if (BUNappend(tids, &p, FALSE) != GDK_SUCCEED ||
+		    BUNappend(upd, &n[p], FALSE) != GDK_SUCCEED)
+			ok = LOG_ERR;
+	}
+	if (ok == LOG_OK)
+		ok = store_funcs.update_idx(tr, i, tids, upd, TYPE_bat);
+  bailout:
+	full_idx_destroy(i, v);
+	bat_destroy(nv);
+	bat_destroy(tids);
+	bat_destroy(upd);
+	return ok;
+}
+
+static int
+table_vacuum(sql_trans *tr, sql_table *t)
+{
+	BAT *tids = delta_cands(tr, t), *map = NULL;
+	BAT **cols, **idxs = NULL;
+	sql_column *fc = t->columns.set->h->data;
+	BUN cnt = store_funcs.count_col(tr, fc, 1);
+	int ok = LOG_OK, nr;
+	node *n, *m;
+
 	if (!tids)
 		return SQL_ERR;
-	// FIXME unchecked_malloc NEW_ARRAY can return NULL
-	cols = NEW_ARRAY(BAT*, cs_size(&t->columns));
-	for (n = t->columns.set->h; n; n = n->next) {
+	if (vacuum_referenced(t) && (map = vacuum_map(tids, cnt)) == NULL)
+		ok = LOG_ERR;
+	cols = (BAT **) GDKzalloc(cs_size(&t->columns) * sizeof(BAT *));
+	if (t->idxs.set)
+		idxs = (BAT **) GDKzalloc(cs_size(&t->idxs) * sizeof(BAT *));
+	if (ok != LOG_OK || !cols || (t->idxs.set && !idxs)) {
+		ok = LOG_ERR;
+		goto bailout;
+	}
+	for (n = t->columns.set->h; n && ok == LOG_OK; n = n->next) {
 		sql_column *c = n->data;
-		BAT *v = store_funcs.bind_col(tr, c, RDONLY);
+		BAT *v = full_column(tr, c);
 
-		if (!v)
-			return SQL_ERR;
-		cols[c->colnr] = BATproject(tids, v);
-		BBPunfix(v->batCacheid);
+		if (!v || (cols[c->colnr] = BATproject(tids, v)) == NULL)
+			ok = LOG_ERR;
+		if (v)
+			full_destroy(c, v);
+	}
+	if (t->idxs.set)
+	for (n = t->idxs.set->h, nr = 0; n && ok == LOG_OK; n = n->next, nr++) {
+		sql_idx *i = n->data;
+		BAT *v, *p;
+
+		if (!isTable(i->t) || !idx_has_column(i->type) ||
+		    (hash_index(i->type) && list_length(i->columns) <= 1))
+			continue;
+		if ((v = full_idx(tr, i)) == NULL) {
+			ok = LOG_ERR;
+			break;
+		}
+		p = BATproject(tids, v);
+		full_idx_destroy(i, v);
+		/* a foreign key onto the table itself */
+		if (p && i->key && i->key->type == fkey &&
+		    ((sql_fkey *) i->key)->rkey->k.t == t) {
+			v = p;
+			p = BATproject(v, map);
+			bat_destroy(v);
+		}
+		if ((idxs[nr] = p) == NULL)
+			ok = LOG_ERR;
 	}
+	if (ok != LOG_OK)
+		goto bailout;
+
 	sql_trans_clear_table(tr, t);
-	for (n = t->columns.set->h; n; n = n->next) {
+	for (n = t->columns.set->h; n && ok == LOG_OK; n = n->next) {
 		sql_column *c = n->data;
 
-		store_funcs.append_col(tr, c, cols[c->colnr], TYPE_bat);
-		BBPunfix(cols[c->colnr]->batCacheid);
+		ok = store_funcs.append_col(tr, c, cols[c->colnr], TYPE_bat);
 	}
+	if (t->idxs.set)
+	for (n = t->idxs.set->h, nr = 0; n && ok == LOG_OK; n = n->next, nr++)
+		if (idxs[nr])
+			ok = store_funcs.append_idx(tr, n->data, idxs[nr], TYPE_bat);
+	/* foreign keys of other tables hold row positions of this table */
+	if (map)
+	for (n = t->keys.set->h; n && ok == LOG_OK; n = n->next) {
+		sql_key *k = n->data;
+
+		if (k->type == fkey || !((sql_ukey *) k)->keys)
+			continue;
+		for (m = ((sql_ukey *) k)->keys->h; m && ok == LOG_OK; m = m->next) {
+			sql_key *fk = m->data;
+
+			if (fk->t != t && fk->idx && isTable(fk->t))
+				ok = vacuum_fkey_idx(tr, fk->idx, map);
+		}
+	}
+  bailout:
+	if (cols)
+		for (n = t->columns.set->h; n; n = n->next)
+			bat_destroy(cols[((sql_column *) n->data)->colnr]);
+	if (idxs)
+		for (nr = 0; nr < cs_size(&t->idxs); nr++)
+			bat_destroy(idxs[nr]);
 	_DELETE(cols);
-	return LOG_OK;
+	_DELETE(idxs);
+	bat_destroy(map);
+	bat_destroy(tids);
+	return ok == LOG_OK ? SQL_OK : SQL_ERR;
 }
 
 void
@@ -39,6 +39,7 @@ typedef enum store_type {
 extern sql_trans *gtrans;
 extern list *active_sessions;
 extern int store_nr_active;
+extern int store_flushing;
 extern store_type active_store_type;
 extern int store_readonly;
 extern int store_singleuser;
@@ -199,6 +200,32 @@ typedef int (*idx_upd_fptr) (sql_trans *tr, sql_idx *c, void *rows, void *data);
 */
 typedef int (*del_fptr) (sql_trans *tr, sql_table *c, void *rows);
 
+/*
+-- delta_col reports the pending inserts and updates of a column
+*/
+typedef struct sql_delta_stats {
+	size_t cnt;		/* number of tuples (including the deletes) */
+	size_t ins;		/* tuples in the insert delta */
+	size_t upd;		/* pending updates */
+	int merged;		/* readers see a merged copy */
+	int versions;		/* versions kept for active transactions */
+} sql_delta_stats;
+
+typedef void (*delta_col_fptr) (sql_trans *tr, sql_column *c, sql_delta_stats *s);
+
+/*
+-- background merge of the deltas of a column into a read-only copy:
+-- merge_col references the bats of the current version (store locked),
+-- merge_build builds the copy (store unlocked) and merge_done publishes
+-- it unless the column changed meanwhile (c is NULL when it was dropped)
+-- and frees the handle. unmerge_col drops the published copies again.
+-- returns LOG_OK, LOG_ERR
+*/
+typedef void *(*merge_col_fptr) (sql_column *c);
+typedef int (*merge_build_fptr) (void *m);
+typedef int (*merge_done_fptr) (sql_column *c, void *m);
+typedef void (*unmerge_col_fptr) (sql_trans *tr, sql_column *c);
+
 /* backing struct for this interface */
 typedef struct store_functions {
 
@@ -219,6 +246,7 @@ typedef struct store_functions {
 	dcount_col_fptr dcount_col;
 	prop_col_fptr sorted_col;
 	prop_col_fptr double_elim_col; /* varsize col with double elimination */
+	prop_col_fptr width_col; /* average bytes per row, var heap included */
 
 	create_col_fptr create_col;
 	create_idx_fptr create_idx;
@@ -268,6 +296,12 @@ typedef struct store_functions {
 	idx_upd_fptr idx_upd;
 
 	del_fptr del;
+
+	delta_col_fptr delta_col;
+	merge_col_fptr merge_col;
+	merge_build_fptr merge_build;
+	merge_done_fptr merge_done;
+	unmerge_col_fptr unmerge_col;
 } store_functions;
 
 sqlstore_export store_functions store_funcs;
@@ -280,6 +314,7 @@ typedef int (*logger_restart_fptr) (void);
 typedef int (*logger_cleanup_fptr) (int keep_persisted_log_files);
 
 typedef int (*logger_changes_fptr)(void);
+typedef int (*logger_flush_fptr)(lng budget, lng *written, int *done);
 typedef int (*logger_get_sequence_fptr) (int seq, lng *id);
 typedef lng (*logger_read_last_transaction_id_fptr)(void);
 typedef lng (*logger_get_transaction_drift_fptr)(void);
@@ -288,7 +323,9 @@ typedef int (*logger_reload_fptr) (void);
 
 typedef int (*log_isnew_fptr)(void);
 typedef int (*log_tstart_fptr) (void);
-typedef int (*log_tend_fptr) (void);
+typedef int (*log_tend_fptr) (lng *lsn);
+typedef int (*log_tsync_fptr) (lng lsn);
+typedef void (*logger_get_stats_fptr) (logger_stats *st);
 typedef int (*log_sequence_fptr) (int seq, lng id);
 typedef int (*log_isdestroyed_fptr)(void);
 
@@ -301,6 +338,7 @@ typedef struct logger_functions {
 	logger_cleanup_fptr cleanup;
 
 	logger_changes_fptr changes;
+	logger_flush_fptr flush;
 	logger_get_sequence_fptr get_sequence;
 	logger_read_last_transaction_id_fptr read_last_transaction_id;
 	logger_get_transaction_drift_fptr get_transaction_drift;
@@ -310,6 +348,8 @@ typedef struct logger_functions {
 	log_isnew_fptr log_isnew;
 	log_tstart_fptr log_tstart;
 	log_tend_fptr log_tend;
+	log_tsync_fptr log_tsync;
+	logger_get_stats_fptr get_stats;
 	log_sequence_fptr log_sequence;
 	log_isdestroyed_fptr log_isdestroyed;
 
@@ -333,17 +373,26 @@ extern void store_exit(void);
 
 extern void store_apply_deltas(void);
 extern void store_flush_log(void);
+extern int store_sync(lng lsn);
 extern void store_manager(void);
 extern void idle_manager(void);
 
 extern void store_lock(void);
 extern void store_unlock(void);
+extern void store_wait_flush(void);
+
+#define LOCK_WAIT_BUCKETS 24	/* store lock waits up to 2^23 usec */
+extern int store_lock_waits(int id, lng *waits);
 extern int store_next_oid(void);
 
 extern sql_trans *sql_trans_create(backend_stack stk, sql_trans *parent, const char *name);
 extern sql_trans *sql_trans_destroy(sql_trans *tr);
 extern int sql_trans_validate(sql_trans *tr);
+typedef struct trans_stamps trans_stamps;
+extern int sql_trans_precommit(sql_trans *tr, trans_stamps **stamps);
+extern void sql_trans_postcommit(trans_stamps *stamps, lng usec, int committed);
 extern int sql_trans_commit(sql_trans *tr);
+extern int sql_trans_commit_delayed(sql_trans *tr, lng *lsn);
 
 extern sql_type *sql_trans_create_type(sql_trans *tr, sql_schema * s, const char *sqlname, int digits, int scale, int radix, const char *impl);
 extern int sql_trans_drop_type(sql_trans *tr, sql_schema * s, int id, int drop_action);
@@ -22,6 +22,7 @@
 int catalog_version = 0;
 
 static MT_Lock bs_lock MT_LOCK_INITIALIZER("bs_lock");
+static MT_Lock table_stats_lock MT_LOCK_INITIALIZER("table_stats_lock");
 static int store_oid = 0;
 static int prev_oid = 0;
 static int nr_sessions = 0;
@@ -29,6 +30,7 @@ static int transactions = 0;
 sql_trans *gtrans = NULL;
 list *active_sessions = NULL;
 int store_nr_active = 0;
+int store_flushing = 0;
 store_type active_store_type = store_bat;
 int store_readonly = 0;
 int store_singleuser = 0;
@@ -1580,6 +1582,7 @@ store_init(int debug, store_type store, int readonly, int singleuser, logger_set
 
 #ifdef NEED_MT_LOCK_INIT
 	MT_lock_init(&bs_lock, "SQL_bs_lock");
+	MT_lock_init(&table_stats_lock, "SQL_table_stats_lock");
 #endif
 	MT_lock_set(&bs_lock);
 
@@ -1623,6 +1626,202 @@ store_init(int debug, store_type store, int readonly, int singleuser, logger_set
 
 static int logging = 0;
 
+/* Per table commit statistics. Commits of a table are stamped with the
+ * read and write times they leave on the global table, so that
+ * conflicts can be found before waiting for the store lock. */
+#define TABLE_STATS_HASH 256
+
+typedef struct table_stats {
+	int id;
+	int rtime;
+	int wtime;
+	lng waits[LOCK_WAIT_BUCKETS];	/* store lock waits by 2log usec */
+	struct table_stats *next;
+} table_stats;
+
+static table_stats *table_stats_hash[TABLE_STATS_HASH];
+
+static table_stats *
+table_stats_find(int id, int create)
+{
+	table_stats **h = &table_stats_hash[id & (TABLE_STATS_HASH - 1)];
+	table_stats *ts;
+
+	for (ts = *h; ts; ts = ts->next)
+		if (ts->id == id)
+			return ts;
+	if (!create || (ts = ZNEW(table_stats)) == NULL)
+		return NULL;
+	ts->id = id;
+	ts->next = *h;
+	*h = ts;
+	return ts;
+}
+
+static void
+table_stats_destroy(void)
+{
+	int i;
+
+	for (i = 0; i < TABLE_STATS_HASH; i++) {
+		table_stats *ts = table_stats_hash[i], *nxt;
+
+		for (; ts; ts = nxt) {
+			nxt = ts->next;
+			_DELETE(ts);
+		}
+		table_stats_hash[i] = NULL;
+	}
+}
+
+/* call f for the tables read or written by tr */
+static int
+trans_tables(sql_trans *tr, int (*f)(sql_table *t, void *arg), void *arg)
+{
+	node *n, *m;
+
+	if (!cs_size(&tr->schemas))
+		return 1;
+	for (n = tr->schemas.set->h; n; n = n->next) {
+		sql_schema *s = n->data;
+
+		if (isTempSchema(s) || (!s->base.wtime && !s->base.rtime) ||
+		    !cs_size(&s->tables))
+			continue;
+		for (m = s->tables.set->h; m; m = m->next) {
+			sql_table *t = m->data;
+
+			if ((t->base.wtime || t->base.rtime) && !f(t, arg))
+				return 0;
+		}
+	}
+	return 1;
+}
+
+/* the tables a commit writes, with the times it leaves on them */
+typedef struct table_stamp {
+	int id;
+	int rtime;
+	int wtime;
+} table_stamp;
+
+struct trans_stamps {
+	int cnt;
+	int sz;
+	table_stamp *t;
+};
+
+static int
+table_precommit(sql_table *t, void *arg)
+{
+	trans_stamps *st = arg;
+	table_stats *ts = table_stats_find(t->base.id, 0);
+
+	/* the same table level checks as sql_trans_validate */
+	if (ts &&
+	    ((t->base.wtime && (t->base.wtime < ts->rtime || t->base.wtime < ts->wtime)) ||
+	     (t->base.rtime && t->base.rtime < ts->wtime)))
+		return 0;
+	if (!t->base.wtime || !st->t)
+		return 1;
+	if (st->cnt == st->sz) {
+		table_stamp *p = RENEW_ARRAY(table_stamp, st->t, 2 * st->sz);
+
+		if (p == NULL) {
+			/* the statistics are not essential */
+			_DELETE(st->t);
+			return 1;
+		}
+		st->t = p;
+		st->sz *= 2;
+	}
+	st->t[st->cnt].id = t->base.id;
+	st->t[st->cnt].rtime = t->base.rtime;
+	st->t[st->cnt].wtime = t->base.wtime;
+	st->cnt++;
+	return 1;
+}
+
+/* Validate tr against the commits of the tables it uses, without the
+ * store lock. A transaction rejected here would also fail
+ * sql_trans_validate, the reverse does not hold. The tables tr writes
+ * are returned in *stamps, to be passed to sql_trans_postcommit once
+ * the store lock is released. */
+int
+sql_trans_precommit(sql_trans *tr, trans_stamps **stamps)
+{
+	trans_stamps *st;
+	int ok;
+
+	*stamps = NULL;
+	if (!tr->wtime)
+		return 1;
+	if ((st = ZNEW(trans_stamps)) != NULL) {
+		st->sz = 8;
+		if ((st->t = NEW_ARRAY(table_stamp, st->sz)) == NULL)
+			_DELETE(st);
+	}
+	if (st == NULL)
+		return 1;
+	MT_lock_set(&table_stats_lock);
+	ok = trans_tables(tr, &table_precommit, st);
+	MT_lock_unset(&table_stats_lock);
+	if (!ok || !st->t) {
+		_DELETE(st->t);
+		_DELETE(st);
+	}
+	*stamps = st;
+	return ok;
+}
+
+/* Account the time a commit waited for the store lock to the tables
+ * it writes and, if it committed, stamp them with its times. This is
+ * done after the store lock is released, stamps that show up late only
+ * let sql_trans_precommit reject less. */
+void
+sql_trans_postcommit(trans_stamps *stamps, lng usec, int committed)
+{
+	int i, b = 0;
+
+	if (stamps == NULL)
+		return;
+	while (usec > 0 && b < LOCK_WAIT_BUCKETS - 1) {
+		usec >>= 1;
+		b++;
+	}
+	MT_lock_set(&table_stats_lock);
+	for (i = 0; i < stamps->cnt; i++) {
+		table_stats *ts = table_stats_find(stamps->t[i].id, 1);
+
+		if (ts == NULL)
+			continue;
+		ts->waits[b]++;
+		if (!committed)
+			continue;
+		if (stamps->t[i].rtime > ts->rtime)
+			ts->rtime = stamps->t[i].rtime;
+		if (stamps->t[i].wtime > ts->wtime)
+			ts->wtime = stamps->t[i].wtime;
+	}
+	MT_lock_unset(&table_stats_lock);
+	_DELETE(stamps->t);
+	_DELETE(stamps);
+}
+
+/* copy the store lock waits of table id, returns 0 when it has none */
+int
+store_lock_waits(int id, lng *waits)
+{
+	table_stats *ts;
+
+	MT_lock_set(&table_stats_lock);
+	ts = table_stats_find(id, 0);
+	if (ts)
+		memcpy(waits, ts->waits, sizeof(ts->waits));
+	MT_lock_unset(&table_stats_lock);
+	return ts != NULL;
+}
+
 void
 store_exit(void)
 {
@@ -1633,7 +1832,7 @@ store_exit(void)
 #endif
 
 	/* busy wait till the logmanager is ready */
-	while (logging) {
+	while (logging || store_flushing) {
 		MT_lock_unset(&bs_lock);
 		MT_sleep_ms(100);
 		MT_lock_set(&bs_lock);
@@ -1664,6 +1863,9 @@ store_exit(void)
 
 	// this is required to not create phantom dependencies after same-process restart
 	store_oid = 0;
+	MT_lock_set(&table_stats_lock);
+	table_stats_destroy();
+	MT_lock_unset(&table_stats_lock);
 
 #ifdef STORE_DEBUG
 	fprintf(stderr, "#store exit unlocked\n");
@@ -1696,6 +1898,90 @@ store_flush_log(void)
 	need_flush = 1;
 }
 
+/* wait for the commit with log sequence number lsn to be durable;
+ * see log_tsync, this should not be called with the store lock held */
+int
+store_sync(lng lsn)
+{
+	if (lsn == 0)
+		return LOG_OK;
+	return logger_funcs.log_tsync(lsn);
+}
+
+/* number of logged changes after which the store manager checkpoints */
+#define CHECKPOINT_CHANGES 1000000
+
+/* Between checkpoints the store manager writes the dirty bats in the
+ * background, in small batches, so a checkpoint has little left to
+ * write while it blocks the writers.  A batch is written without the
+ * store lock, new transactions and readers carry on, only those that
+ * change the bats of the global transaction wait for store_flushing
+ * to clear (store_wait_flush).  A pass over
+ * the logger catalog is started once a quarter of the changes that
+ * trigger a checkpoint has been logged since the previous pass.  The
+ * amount written is limited to gdk_checkpoint_rate MB per second (0
+ * disables this); a batch can overdraw, as a bat is written as a
+ * whole, after which the next batches wait for the credit to recover.
+ */
+typedef struct store_flusher {
+	lng rate;		/* bytes per second */
+	lng credit;		/* bytes the next batch may write */
+	lng changes;		/* logger changes at the start of the last pass */
+	int active;		/* a pass is in progress */
+} store_flusher;
+
+static void
+store_flush_dirty(store_flusher *f, int ms)
+{
+	lng changes, written;
+	int done, res;
+
+	f->credit = MIN(f->credit + f->rate * ms / 1000, f->rate);
+	if (f->credit <= 0)
+		return;
+	MT_lock_set(&bs_lock);
+	if (logging || GDKexiting() || logger_funcs.log_isdestroyed()) {
+		MT_lock_unset(&bs_lock);
+		return;
+	}
+	changes = logger_funcs.changes();
+	if (changes < f->changes)	/* there was a checkpoint */
+		f->changes = f->active = 0;
+	if (!f->active && changes - f->changes >= CHECKPOINT_CHANGES / 4) {
+		f->active = 1;
+		f->changes = changes;
+	}
+	if (!f->active) {
+		MT_lock_unset(&bs_lock);
+		return;
+	}
+	store_flushing = 1;
+	MT_lock_unset(&bs_lock);
+
+	res = logger_funcs.flush(f->credit, &written, &done);
+
+	MT_lock_set(&bs_lock);
+	store_flushing = 0;
+	MT_lock_unset(&bs_lock);
+	if (res != LOG_OK)
+		GDKfatal("write-ahead logging failure, disk full?");
+	f->credit -= written;
+	if (done)
+		f->active = 0;
+}
+
+/* called with the store lock held before changing the bats of the
+ * global transaction */
+void
+store_wait_flush(void)
+{
+	while (store_flushing) {
+		MT_lock_unset(&bs_lock);
+		MT_sleep_ms(1);
+		MT_lock_set(&bs_lock);
+	}
+}
+
 static int
 store_needs_vacuum( sql_trans *tr )
 {
@@ -1750,6 +2036,10 @@ store_manager(void)
 {
 	const int sleeptime = GDKdebug & FORCEMITOMASK ? 10 : 50;
 	const int timeout = GDKdebug & FORCEMITOMASK ? 500 : 50000;
+	store_flusher flusher;
+
+	memset(&flusher, 0, sizeof(flusher));
+	flusher.rate = (lng) GDKgetenv_int("gdk_checkpoint_rate", 32) << 20;
 
 	while (!GDKexiting() && !logger_funcs.log_isdestroyed()) {
 		int res = LOG_OK;
@@ -1760,6 +2050,10 @@ store_manager(void)
 			MT_sleep_ms(sleeptime);
 			if (GDKexiting())
 				return;
+			/* commits left unsynced by the sync interval */
+			(void) logger_funcs.log_tsync(0);
+			if (flusher.rate > 0 && !create_shared_logger)
+				store_flush_dirty(&flusher, sleeptime);
 		}
 		/* check if we have a shared logger as well */
 		if (create_shared_logger) {
@@ -1778,7 +2072,7 @@ store_manager(void)
 			MT_lock_unset(&bs_lock);
 			return;
 		}
-		if ((!need_flush && logger_funcs.changes() < 1000000 && shared_transactions_drift < shared_drift_threshold)) {
+		if ((!need_flush && logger_funcs.changes() < CHECKPOINT_CHANGES && shared_transactions_drift < shared_drift_threshold)) {
 			MT_lock_unset(&bs_lock);
 			continue;
 		}
@@ -1838,11 +2132,238 @@ store_manager(void)
 	}
 }
 
+#define DELTA_MERGE_RATIO 8	/* delta rows * ratio must reach the main bat */
+#define DELTA_MERGE_MAX 64	/* columns merged per idle_manager round */
+
+/* the column with the largest delta worth merging */
+static sql_column *
+store_merge_candidate(sql_trans *tr, size_t min_rows)
+{
+	sql_column *best = NULL;
+	size_t best_rows = 0;
+	node *n, *m, *o;
+
+	for (n = tr->schemas.set->h; n; n = n->next) {
+		sql_schema *s = n->data;
+
+		if (isTempSchema(s) || !s->tables.set)
+			continue;
+		for (m = s->tables.set->h; m; m = m->next) {
+			sql_table *t = m->data;
+
+			if (!isTable(t) || t->system || isTempTable(t))
+				continue;
+			for (o = t->columns.set->h; o; o = o->next) {
+				sql_column *c = o->data;
+				sql_delta_stats st;
+				size_t rows;
+
+				store_funcs.delta_col(tr, c, &st);
+				rows = st.ins + st.upd;
+				if (st.merged || rows < min_rows || rows <= best_rows ||
+				    rows * DELTA_MERGE_RATIO < st.cnt - st.ins)
+					continue;
+				best = c;
+				best_rows = rows;
+			}
+		}
+	}
+	return best;
+}
+
+/* Merge the inserts and updates of one column into a read-only copy
+ * for new readers. A session stays active meanwhile, which keeps
+ * commits from changing the global bats in place. Returns 1 when a
+ * column was merged. */
+static int
+store_merge_deltas(size_t min_rows)
+{
+	sql_session *s;
+	sql_column *c;
+	sql_schema *sc;
+	sql_table *t;
+	int sid, tid, cid, ok;
+	void *m;
+
+	MT_lock_set(&bs_lock);
+	if (logging || GDKexiting() || !store_funcs.merge_col ||
+	    (c = store_merge_candidate(gtrans, min_rows)) == NULL ||
+	    (m = store_funcs.merge_col(c)) == NULL) {
+		MT_lock_unset(&bs_lock);
+		return 0;
+	}
+	sid = c->t->s->base.id;
+	tid = c->t->base.id;
+	cid = c->base.id;
+	s = sql_session_create(gtrans->stk, 0);
+	if (s == NULL) {
+		(void) store_funcs.merge_done(NULL, m);
+		MT_lock_unset(&bs_lock);
+		return 0;
+	}
+	sql_trans_begin(s);
+	MT_lock_unset(&bs_lock);
+
+	ok = store_funcs.merge_build(m);
+
+	MT_lock_set(&bs_lock);
+	store_wait_flush();
+	c = NULL;
+	if (ok == LOG_OK &&
+	    (sc = find_sql_schema_id(gtrans, sid)) != NULL &&
+	    (t = find_sql_table_id(sc, tid)) != NULL) {
+		node *n = list_find_base_id(t->columns.set, cid);
+
+		if (n)
+			c = n->data;
+	}
+	if (store_funcs.merge_done(c, m) != LOG_OK)
+		c = NULL;
+	/* running sessions that read the column rebind it when they
+	 * start their next transaction */
+	if (c)
+		gtrans->wstime = timestamp();
+	sql_trans_end(s);
+	sql_session_destroy(s);
+	MT_lock_unset(&bs_lock);
+	return c != NULL;
+}
+
+#define VACUUM_MIN_DELS 1024	/* deleted rows before a table is vacuumed */
+
+/* the user table with the most deleted rows, once these make up
+ * ratio percent of the table */
+static sql_table *
+store_vacuum_candidate(sql_trans *tr, int ratio)
+{
+	sql_table *best = NULL;
+	size_t best_dels = 0;
+	node *n, *m;
+
+	for (n = tr->schemas.set->h; n; n = n->next) {
+		sql_schema *s = n->data;
+
+		if (isTempSchema(s) || !s->tables.set)
+			continue;
+		for (m = s->tables.set->h; m; m = m->next) {
+			sql_table *t = m->data;
+			size_t cnt, dels;
+
+			if (!isTable(t) || t->system || isTempTable(t) ||
+			    !t->columns.set || !t->columns.set->h)
+				continue;
+			dels = store_funcs.count_del(tr, t);
+			if (dels < VACUUM_MIN_DELS || dels <= best_dels)
+				continue;
+			cnt = store_funcs.count_col(tr, t->columns.set->h->data, 1);
+			if (dels * 100 < cnt * (size_t) ratio)
+				continue;
+			best = t;
+			best_dels = dels;
+		}
+	}
+	return best;
+}
+
+/* does an active transaction other than tr use table t; transactions
+ * changing the schema are not looked into, their catalog may change
+ * underneath us */
+static int
+store_table_in_use(sql_trans *tr, sql_table *t)
+{
+	node *n;
+
+	for (n = active_sessions->h; n; n = n->next) {
+		sql_session *as = n->data;
+		sql_schema *os;
+		sql_table *ot;
+
+		if (as->tr == tr)
+			continue;
+		if (as->tr->schema_updates)
+			return 1;
+		if ((os = find_sql_schema_id(as->tr, t->s->base.id)) != NULL &&
+		    (ot = find_sql_table_id(os, t->base.id)) != NULL &&
+		    (ot->base.rtime || ot->base.wtime))
+			return 1;
+	}
+	return 0;
+}
+
+/* does an active transaction other than tr use one of the tables tr
+ * wrote */
+static int
+store_tables_in_use(sql_trans *tr)
+{
+	node *n, *m;
+
+	for (n = tr->schemas.set->h; n; n = n->next) {
+		sql_schema *s = n->data;
+
+		if (!s->base.wtime || !s->tables.set)
+			continue;
+		for (m = s->tables.set->h; m; m = m->next) {
+			sql_table *t = m->data;
+
+			if (t->base.wtime && store_table_in_use(tr, t))
+				return 1;
+		}
+	}
+	return 0;
+}
+
+/* Compact the table with the largest share of deleted rows. The
+ * rewrite runs in a transaction of its own, outside the store lock.
+ * It is only committed when no concurrent commit touched the tables it
+ * read or wrote and no active transaction uses the tables it wrote, as
+ * these would fail to validate afterwards. Other transactions keep
+ * their snapshot. Returns 1 when a table was vacuumed. */
+static int
+store_autovacuum(int ratio)
+{
+	sql_session *s;
+	sql_table *t;
+	lng lsn = 0;
+	int ok = 0;
+
+	MT_lock_set(&bs_lock);
+	if (logging || GDKexiting() ||
+	    store_vacuum_candidate(gtrans, ratio) == NULL ||
+	    (s = sql_session_create(gtrans->stk, 0)) == NULL) {
+		MT_lock_unset(&bs_lock);
+		return 0;
+	}
+	sql_trans_begin(s);
+	t = store_vacuum_candidate(s->tr, ratio);
+	if (t && store_table_in_use(s->tr, t))
+		t = NULL;
+	MT_lock_unset(&bs_lock);
+
+	if (t && table_funcs.table_vacuum(s->tr, t) == SQL_OK)
+		ok = 1;
+
+	MT_lock_set(&bs_lock);
+	store_wait_flush();
+	if (ok && !GDKexiting() && !store_tables_in_use(s->tr) &&
+	    sql_trans_validate(s->tr))
+		ok = sql_trans_commit_delayed(s->tr, &lsn) == SQL_OK;
+	else
+		ok = 0;
+	sql_trans_end(s);
+	sql_session_destroy(s);
+	MT_lock_unset(&bs_lock);
+	if (ok && store_sync(lsn) != LOG_OK)
+		ok = 0;
+	return ok;
+}
+
 void
 idle_manager(void)
 {
 	const int sleeptime = GDKdebug & FORCEMITOMASK ? 10 : 50;
 	const int timeout = GDKdebug & FORCEMITOMASK ? 50 : 5000;
+	int merge_rows = GDKgetenv_int("gdk_delta_merge_rows", 1 << 16);
+	int vacuum_ratio = GDKgetenv_int("gdk_vacuum_ratio", 25);
 
 	while (!GDKexiting()) {
 		sql_session *s;
@@ -1853,7 +2374,13 @@ idle_manager(void)
 			if (GDKexiting())
 				return;
 		}
+		for (t = 0; merge_rows > 0 && t < DELTA_MERGE_MAX && !GDKexiting(); t++)
+			if (!store_merge_deltas((size_t) merge_rows))
+				break;
+		if (vacuum_ratio > 0 && !GDKexiting())
+			(void) store_autovacuum(vacuum_ratio);
 		MT_lock_set(&bs_lock);
+		store_wait_flush();
 		if (store_nr_active || GDKexiting() || !store_needs_vacuum(gtrans)) {
 			MT_lock_unset(&bs_lock);
 			continue;
@@ -3589,6 +4116,19 @@ catalog_corrupt( sql_trans *tr )
 
 int
 sql_trans_commit(sql_trans *tr)
+{
+	lng lsn = 0;
+	int ok = sql_trans_commit_delayed(tr, &lsn);
+
+	if (ok == SQL_OK && store_sync(lsn) != LOG_OK)
+		ok = SQL_ERR;
+	return ok;
+}
+
+/* Commit tr, but leave the sync of the log to store_sync(*lsn), so
+ * that it can be done after releasing the store lock. */
+int
+sql_trans_commit_delayed(sql_trans *tr, lng *lsn)
 {
 	int ok = LOG_OK;
 
@@ -3607,7 +4147,7 @@ sql_trans_commit(sql_trans *tr)
 			ok = logger_funcs.log_sequence(OBJ_SID, store_oid);
 		prev_oid = store_oid;
 		if (ok == LOG_OK)
-			ok = logger_funcs.log_tend();
+			ok = logger_funcs.log_tend(lsn);
 		tr->schema_number = store_schema_number();
 	}
 	if (ok == LOG_OK) {